@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -239,6 +239,32 @@ int fwk_arch_deinit(void);
  */
 void fwk_arch_suspend(void);
 
+/*!
+ * \brief Set the idle handler.
+ *
+ * \details When set, the idle handler is called instead of
+ *      ::fwk_arch_suspend when the framework has no more events to process.
+ *      It chooses how to wait for the next interrupt and returns once the
+ *      system has been woken up.
+ *
+ *      Only one idle handler can be set at a time. A module must clear its own
+ *      handler before another one can be set.
+ *
+ * \param handler Idle handler, or \c NULL to restore the architecture
+ *      suspend.
+ *
+ * \retval ::FWK_SUCCESS The idle handler was set.
+ * \retval ::FWK_E_STATE A different idle handler is already set.
+ * \return Status code representing the result of the operation.
+ */
+int fwk_arch_set_idle_handler(void (*handler)(void));
+
+/*!
+ * \brief Wait for the next interrupt through the idle handler if one is set,
+ *      else through ::fwk_arch_suspend.
+ */
+void fwk_arch_idle(void);
+
 /*!
  * \}
  */
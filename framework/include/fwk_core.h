@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -72,6 +72,20 @@
  */
 void fwk_process_event_queue(void);
 
+/*!
+ * \brief Check if an event is waiting to be processed.
+ *
+ * \details Checks both the event queue and the queue of the events raised by
+ *      interrupt handlers. An idle handler calls this function with the
+ *      interrupts masked, before it enters an idle state, so that an event put
+ *      by an interrupt handler after the last processing of the queues is not
+ *      left waiting for the next wake-up.
+ *
+ * \retval true At least one event is waiting to be processed.
+ * \retval false No event is waiting to be processed.
+ */
+bool fwk_is_event_pending(void);
+
 /*!
  * \brief Get a copy of a delayed response event.
  *
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2020-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2020-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -173,6 +173,23 @@ fwk_duration_ns_t fwk_time_stamp_duration(fwk_timestamp_t timestamp);
  */
 fwk_duration_ns_t fwk_time_duration(fwk_timestamp_t start, fwk_timestamp_t end);
 
+/*!
+ * \brief Get the time elapsed between two points.
+ *
+ * \details Unlike ::fwk_time_duration(), the end of the measurement may be
+ *      equal to its beginning, as happens when both timestamps are taken
+ *      within the resolution of the time driver or when there is no time
+ *      driver. The difference is computed modulo the range of the
+ *      timestamps, so that a wrap-around of the time driver between the two
+ *      points is accounted for.
+ *
+ * \param[in] start Timestamp representing the beginning of the measurement.
+ * \param[in] end Timestamp representing the end of the measurement.
+ *
+ * \return Time elapsed between the two points in nanoseconds.
+ */
+fwk_duration_ns_t fwk_time_elapsed(fwk_timestamp_t start, fwk_timestamp_t end);
+
 /*!
  * \brief Convert a nanosecond duration to a microsecond duration.
  *
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -28,6 +28,8 @@
 
 #include <string.h>
 
+static void (*idle_handler)(void);
+
 extern int fwk_interrupt_init(const struct fwk_arch_interrupt_driver *driver);
 
 static int fwk_arch_interrupt_init(int (*interrupt_init_handler)(
@@ -127,3 +129,24 @@ void fwk_arch_suspend(void)
     arch_suspend();
 #endif
 }
+
+int fwk_arch_set_idle_handler(void (*handler)(void))
+{
+    if ((handler != NULL) && (idle_handler != NULL) &&
+        (idle_handler != handler)) {
+        return FWK_E_STATE;
+    }
+
+    idle_handler = handler;
+
+    return FWK_SUCCESS;
+}
+
+void fwk_arch_idle(void)
+{
+    if (idle_handler != NULL) {
+        idle_handler();
+    } else {
+        fwk_arch_suspend();
+    }
+}
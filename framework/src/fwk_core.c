@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -319,12 +319,18 @@ void fwk_process_event_queue(void)
     }
 }
 
+bool fwk_is_event_pending(void)
+{
+    return !fwk_list_is_empty(&ctx.event_queue) ||
+        !fwk_list_is_empty(&ctx.isr_event_queue);
+}
+
 noreturn void __fwk_run_main_loop(void)
 {
     for (;;) {
         fwk_process_event_queue();
         if (fwk_log_unbuffer() == FWK_SUCCESS) {
-            fwk_arch_suspend();
+            fwk_arch_idle();
         }
     }
 }
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2020-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2020-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -45,6 +45,12 @@ fwk_duration_ns_t fwk_time_duration(fwk_timestamp_t start, fwk_timestamp_t end)
     return end - start;
 }
 
+fwk_duration_ns_t fwk_time_elapsed(fwk_timestamp_t start, fwk_timestamp_t end)
+{
+    /* Unsigned arithmetic accounts for a wrap-around between the points */
+    return FWK_NS(end - start);
+}
+
 fwk_duration_us_t fwk_time_duration_us(fwk_duration_ns_t duration)
 {
     return duration / FWK_US(1);
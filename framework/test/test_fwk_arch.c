@@ -0,0 +1,117 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <fwk_arch.h>
+#include <fwk_assert.h>
+#include <fwk_macros.h>
+#include <fwk_status.h>
+#include <fwk_test.h>
+
+#include <stddef.h>
+
+static unsigned int idle_handler_a_calls;
+static unsigned int idle_handler_b_calls;
+
+static void idle_handler_a(void)
+{
+    idle_handler_a_calls++;
+}
+
+static void idle_handler_b(void)
+{
+    idle_handler_b_calls++;
+}
+
+static void test_case_setup(void)
+{
+    idle_handler_a_calls = 0;
+    idle_handler_b_calls = 0;
+
+    fwk_arch_set_idle_handler(NULL);
+}
+
+static void test_fwk_arch_idle_without_handler(void)
+{
+    fwk_arch_idle();
+
+    assert(idle_handler_a_calls == 0);
+    assert(idle_handler_b_calls == 0);
+}
+
+static void test_fwk_arch_idle_calls_handler(void)
+{
+    int status;
+
+    status = fwk_arch_set_idle_handler(idle_handler_a);
+    assert(status == FWK_SUCCESS);
+
+    fwk_arch_idle();
+
+    assert(idle_handler_a_calls == 1);
+    assert(idle_handler_b_calls == 0);
+}
+
+static void test_fwk_arch_set_idle_handler_again(void)
+{
+    int status;
+
+    status = fwk_arch_set_idle_handler(idle_handler_a);
+    assert(status == FWK_SUCCESS);
+
+    status = fwk_arch_set_idle_handler(idle_handler_a);
+    assert(status == FWK_SUCCESS);
+}
+
+static void test_fwk_arch_set_idle_handler_already_set(void)
+{
+    int status;
+
+    status = fwk_arch_set_idle_handler(idle_handler_a);
+    assert(status == FWK_SUCCESS);
+
+    status = fwk_arch_set_idle_handler(idle_handler_b);
+    assert(status == FWK_E_STATE);
+
+    fwk_arch_idle();
+
+    assert(idle_handler_a_calls == 1);
+    assert(idle_handler_b_calls == 0);
+}
+
+static void test_fwk_arch_set_idle_handler_cleared(void)
+{
+    int status;
+
+    status = fwk_arch_set_idle_handler(idle_handler_a);
+    assert(status == FWK_SUCCESS);
+
+    status = fwk_arch_set_idle_handler(NULL);
+    assert(status == FWK_SUCCESS);
+
+    status = fwk_arch_set_idle_handler(idle_handler_b);
+    assert(status == FWK_SUCCESS);
+
+    fwk_arch_idle();
+
+    assert(idle_handler_a_calls == 0);
+    assert(idle_handler_b_calls == 1);
+}
+
+static const struct fwk_test_case_desc test_case_table[] = {
+    FWK_TEST_CASE(test_fwk_arch_idle_without_handler),
+    FWK_TEST_CASE(test_fwk_arch_idle_calls_handler),
+    FWK_TEST_CASE(test_fwk_arch_set_idle_handler_again),
+    FWK_TEST_CASE(test_fwk_arch_set_idle_handler_already_set),
+    FWK_TEST_CASE(test_fwk_arch_set_idle_handler_cleared),
+};
+
+struct fwk_test_suite_desc test_suite = {
+    .name = "fwk_arch",
+    .test_case_setup = test_case_setup,
+    .test_case_count = FWK_ARRAY_SIZE(test_case_table),
+    .test_case_table = test_case_table,
+};
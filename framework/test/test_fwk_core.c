@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -520,12 +520,40 @@ static void test___fwk_put_notification(void)
     assert(result_event->is_notification == true);
 }
 
+static void test_fwk_is_event_pending(void)
+{
+    struct fwk_event event1 = {
+        .source_id = FWK_ID_MODULE(0x1),
+        .target_id = FWK_ID_MODULE(0x2),
+        .id = FWK_ID_EVENT(0x2, 0x7),
+    };
+
+    struct fwk_event event2 = {
+        .source_id = FWK_ID_MODULE(0x3),
+        .target_id = FWK_ID_MODULE(0x4),
+        .id = FWK_ID_EVENT(0x4, 0x8),
+    };
+
+    assert(!fwk_is_event_pending());
+
+    __real___fwk_slist_push_tail(&ctx->isr_event_queue, &(event1.slist_node));
+    assert(fwk_is_event_pending());
+
+    fwk_list_init(&ctx->isr_event_queue);
+    __real___fwk_slist_push_tail(&ctx->event_queue, &(event2.slist_node));
+    assert(fwk_is_event_pending());
+
+    fwk_list_init(&ctx->event_queue);
+    assert(!fwk_is_event_pending());
+}
+
 static const struct fwk_test_case_desc test_case_table[] = {
     FWK_TEST_CASE(test___fwk_init),
     FWK_TEST_CASE(test___fwk_run_main_loop),
     FWK_TEST_CASE(test_fwk_put_event),
     FWK_TEST_CASE(test_fwk_put_event_light),
-    FWK_TEST_CASE(test___fwk_put_notification)
+    FWK_TEST_CASE(test___fwk_put_notification),
+    FWK_TEST_CASE(test_fwk_is_event_pending)
 };
 
 struct fwk_test_suite_desc test_suite = {
@@ -0,0 +1,41 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <fwk_assert.h>
+#include <fwk_test.h>
+#include <fwk_time.h>
+
+#include <stdint.h>
+
+static void test_fwk_time_elapsed_equal(void)
+{
+    assert(fwk_time_elapsed(1000, 1000) == FWK_NS(0));
+}
+
+static void test_fwk_time_elapsed_forward(void)
+{
+    assert(fwk_time_elapsed(1000, 3500) == FWK_NS(2500));
+}
+
+static void test_fwk_time_elapsed_wrap_around(void)
+{
+    fwk_timestamp_t start = UINT64_MAX - 99;
+
+    assert(fwk_time_elapsed(start, 400) == FWK_NS(500));
+}
+
+static const struct fwk_test_case_desc test_case_table[] = {
+    FWK_TEST_CASE(test_fwk_time_elapsed_equal),
+    FWK_TEST_CASE(test_fwk_time_elapsed_forward),
+    FWK_TEST_CASE(test_fwk_time_elapsed_wrap_around),
+};
+
+struct fwk_test_suite_desc test_suite = {
+    .name = "fwk_time",
+    .test_case_count = FWK_ARRAY_SIZE(test_case_table),
+    .test_case_table = test_case_table,
+};
@@ -0,0 +1,111 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *      Host mailbox driver, backing transport channels with POSIX shared
+ *      memory and a UNIX socket doorbell.
+ */
+
+#ifndef MOD_HOST_MBX_H
+#define MOD_HOST_MBX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*!
+ * \addtogroup GroupModules Modules
+ * \{
+ */
+
+/*!
+ * \defgroup GroupHostMbx Host Mailbox Driver
+ *
+ * \details Mailbox driver for firmware built for the host architecture. The
+ *      out-band mailbox of each transport channel is a POSIX shared memory
+ *      object that a host program maps to act as an SCMI agent. Doorbells are
+ *      datagrams exchanged on UNIX domain sockets.
+ *
+ * \{
+ */
+
+/*!
+ * \brief Host mailbox API indices.
+ */
+enum mod_host_mbx_api_idx {
+    /*! Transport driver API */
+    MOD_HOST_MBX_API_IDX_TRANSPORT_DRIVER,
+
+    /*! Number of APIs */
+    MOD_HOST_MBX_API_IDX_COUNT,
+};
+
+/*!
+ * \brief Doorbell datagram.
+ *
+ * \details Sent by the agent to the firmware socket to signal a message on a
+ *      channel, and by the firmware to the agent socket of a channel to
+ *      signal a message or a response on that channel.
+ */
+struct mod_host_mbx_doorbell {
+    /*! Index of the channel, as the index of its host mailbox element */
+    uint32_t channel;
+};
+
+/*!
+ * \brief Module configuration.
+ */
+struct mod_host_mbx_config {
+    /*!
+     * \brief Path of the UNIX datagram socket the firmware receives the
+     *      doorbells on.
+     *
+     * \details Any file at that path is removed when the module starts.
+     */
+    const char *socket_path;
+
+    /*!
+     * \brief Time, in milliseconds, the firmware waits for a doorbell when it
+     *      has no events to process.
+     *
+     * \details Zero busy-polls the socket, which gives the lowest latency at
+     *      the cost of a host CPU. A negative value waits until a doorbell is
+     *      received.
+     */
+    int poll_timeout_ms;
+};
+
+/*!
+ * \brief Channel configuration.
+ */
+struct mod_host_mbx_channel_config {
+    /*! Name of the POSIX shared memory object backing the mailbox */
+    const char *shm_name;
+
+    /*!
+     * \brief Address the shared memory is mapped at.
+     *
+     * \details Must be the out-band mailbox address of the transport channel
+     *      using this mailbox, and must not overlap any other mapping of the
+     *      firmware process.
+     */
+    uintptr_t shm_address;
+
+    /*! Size in bytes of the shared memory */
+    size_t shm_size;
+
+    /*! Path of the UNIX datagram socket of the agent using the channel */
+    const char *peer_socket_path;
+};
+
+/*!
+ * \}
+ */
+
+/*!
+ * \}
+ */
+
+#endif /* MOD_HOST_MBX_H */
@@ -0,0 +1,415 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *      Host mailbox driver, backing transport channels with POSIX shared
+ *      memory and a UNIX socket doorbell.
+ */
+
+#include <mod_host_mbx.h>
+#include <mod_transport.h>
+
+#include <fwk_arch.h>
+#include <fwk_core.h>
+#include <fwk_event.h>
+#include <fwk_id.h>
+#include <fwk_log.h>
+#include <fwk_mm.h>
+#include <fwk_module.h>
+#include <fwk_module_idx.h>
+#include <fwk_status.h>
+#include <fwk_string.h>
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <poll.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#define MOD_NAME "[HOST_MBX] "
+
+/* Maximum number of doorbells handled per poll */
+#define HOST_MBX_DOORBELL_BATCH_MAX 16
+
+/* Host mailbox event indices */
+enum host_mbx_event_idx {
+    /* Poll the doorbell socket */
+    HOST_MBX_EVENT_IDX_POLL,
+
+    HOST_MBX_EVENT_IDX_COUNT,
+};
+
+/* Host mailbox channel context */
+struct host_mbx_channel_ctx {
+    /* Pointer to the channel configuration */
+    const struct mod_host_mbx_channel_config *config;
+
+    /* Identifier of the transport channel bound to the mailbox */
+    fwk_id_t bound_id;
+
+    /* Driver input API of the transport channel bound to the mailbox */
+    const struct mod_transport_driver_input_api *driver_input_api;
+
+    /* Address of the agent socket */
+    struct sockaddr_un peer_address;
+};
+
+/* Host mailbox context */
+static struct host_mbx_ctx {
+    /* Module configuration */
+    const struct mod_host_mbx_config *config;
+
+    /* Table of channel contexts */
+    struct host_mbx_channel_ctx *channel_ctx_table;
+
+    /* Number of channels */
+    unsigned int channel_count;
+
+    /* Doorbell socket of the firmware */
+    int socket_fd;
+} host_mbx_ctx = {
+    .socket_fd = -1,
+};
+
+static int host_mbx_socket_address(
+    const char *path,
+    struct sockaddr_un *address)
+{
+    if ((path == NULL) || (strlen(path) >= sizeof(address->sun_path))) {
+        return FWK_E_DATA;
+    }
+
+    fwk_str_memset(address, 0, sizeof(*address));
+    address->sun_family = AF_UNIX;
+    fwk_str_strncpy(address->sun_path, path, sizeof(address->sun_path) - 1);
+
+    return FWK_SUCCESS;
+}
+
+static int host_mbx_poll_event(void)
+{
+    struct fwk_event_light event = (struct fwk_event_light){
+        .id = FWK_ID_EVENT(FWK_MODULE_IDX_HOST_MBX, HOST_MBX_EVENT_IDX_POLL),
+        .source_id = FWK_ID_MODULE(FWK_MODULE_IDX_HOST_MBX),
+        .target_id = FWK_ID_MODULE(FWK_MODULE_IDX_HOST_MBX),
+    };
+
+    return fwk_put_event(&event);
+}
+
+/*
+ * Receive the doorbells sent by the agents, without waiting, and signal the
+ * messages to the transport channels they are for. Return whether any doorbell
+ * was received.
+ */
+static bool host_mbx_poll(void)
+{
+    struct mod_host_mbx_doorbell doorbell;
+    struct host_mbx_channel_ctx *channel_ctx;
+    unsigned int count;
+    ssize_t size;
+    int status;
+
+    for (count = 0; count < HOST_MBX_DOORBELL_BATCH_MAX; count++) {
+        size = recv(
+            host_mbx_ctx.socket_fd,
+            &doorbell,
+            sizeof(doorbell),
+            MSG_DONTWAIT);
+        if (size < 0) {
+            break;
+        }
+
+        if ((size != (ssize_t)sizeof(doorbell)) ||
+            (doorbell.channel >= host_mbx_ctx.channel_count)) {
+            FWK_LOG_WARN(MOD_NAME "Invalid doorbell discarded");
+            continue;
+        }
+
+        channel_ctx = &host_mbx_ctx.channel_ctx_table[doorbell.channel];
+        if (channel_ctx->driver_input_api == NULL) {
+            continue;
+        }
+
+        status = channel_ctx->driver_input_api->signal_message(
+            channel_ctx->bound_id);
+        if (status != FWK_SUCCESS) {
+            FWK_LOG_DEBUG(
+                MOD_NAME "Channel %" PRIu32 " signal failed (%s)",
+                doorbell.channel,
+                fwk_status_str(status));
+        }
+    }
+
+    return (count != 0);
+}
+
+/*
+ * Idle handler of the framework, called when there are no more events to
+ * process. The host architecture has no interrupts, so wait here for the next
+ * doorbell and queue a poll event once one has been received.
+ */
+static void host_mbx_idle(void)
+{
+    struct pollfd poll_fd = {
+        .fd = host_mbx_ctx.socket_fd,
+        .events = POLLIN,
+    };
+
+    if (poll(&poll_fd, 1, host_mbx_ctx.config->poll_timeout_ms) <= 0) {
+        return;
+    }
+
+    if (host_mbx_poll_event() != FWK_SUCCESS) {
+        FWK_LOG_ERR(MOD_NAME "Unable to queue the poll event");
+    }
+}
+
+/*
+ * Transport module driver API
+ */
+static int host_mbx_trigger_event(fwk_id_t device_id)
+{
+    struct host_mbx_channel_ctx *channel_ctx;
+    struct mod_host_mbx_doorbell doorbell;
+    ssize_t size;
+
+    doorbell.channel = fwk_id_get_element_idx(device_id);
+    channel_ctx = &host_mbx_ctx.channel_ctx_table[doorbell.channel];
+
+    size = sendto(
+        host_mbx_ctx.socket_fd,
+        &doorbell,
+        sizeof(doorbell),
+        MSG_DONTWAIT,
+        (const struct sockaddr *)&channel_ctx->peer_address,
+        sizeof(channel_ctx->peer_address));
+
+    /* The agent is not listening, it will find the message when it polls */
+    return (size == (ssize_t)sizeof(doorbell)) ? FWK_SUCCESS : FWK_E_DEVICE;
+}
+
+static const struct mod_transport_driver_api host_mbx_transport_driver_api = {
+    .trigger_event = host_mbx_trigger_event,
+};
+
+/*
+ * Framework handlers
+ */
+static int host_mbx_init(
+    fwk_id_t module_id,
+    unsigned int channel_count,
+    const void *data)
+{
+    const struct mod_host_mbx_config *config = data;
+
+    if ((config == NULL) || (channel_count == 0)) {
+        return FWK_E_DATA;
+    }
+
+    host_mbx_ctx.config = config;
+    host_mbx_ctx.channel_count = channel_count;
+    host_mbx_ctx.channel_ctx_table = fwk_mm_calloc(
+        channel_count, sizeof(host_mbx_ctx.channel_ctx_table[0]));
+
+    return FWK_SUCCESS;
+}
+
+static int host_mbx_channel_init(
+    fwk_id_t channel_id,
+    unsigned int unused,
+    const void *data)
+{
+    const struct mod_host_mbx_channel_config *config = data;
+    struct host_mbx_channel_ctx *channel_ctx;
+    void *address;
+    int status;
+    int fd;
+
+    if ((config == NULL) || (config->shm_name == NULL) ||
+        (config->shm_address == 0) || (config->shm_size == 0)) {
+        return FWK_E_DATA;
+    }
+
+    channel_ctx =
+        &host_mbx_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+    channel_ctx->config = config;
+    channel_ctx->bound_id = FWK_ID_NONE;
+
+    status = host_mbx_socket_address(
+        config->peer_socket_path, &channel_ctx->peer_address);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    /*
+     * The shared memory is mapped before the transport module initializes
+     * the mailbox, at the address the transport channel is configured with.
+     */
+    fd = shm_open(config->shm_name, O_RDWR | O_CREAT, 0600);
+    if (fd < 0) {
+        FWK_LOG_ERR(MOD_NAME "Unable to open %s", config->shm_name);
+        return FWK_E_DEVICE;
+    }
+
+    if (ftruncate(fd, (off_t)config->shm_size) != 0) {
+        close(fd);
+        return FWK_E_DEVICE;
+    }
+
+    address = mmap(
+        (void *)config->shm_address,
+        config->shm_size,
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED,
+        fd,
+        0);
+    close(fd);
+
+    if (address == MAP_FAILED) {
+        return FWK_E_NOMEM;
+    }
+
+    if (address != (void *)config->shm_address) {
+        FWK_LOG_ERR(
+            MOD_NAME "Unable to map %s at %p",
+            config->shm_name,
+            (void *)config->shm_address);
+        munmap(address, config->shm_size);
+        return FWK_E_NOMEM;
+    }
+
+    return FWK_SUCCESS;
+}
+
+static int host_mbx_bind(fwk_id_t id, unsigned int round)
+{
+    struct host_mbx_channel_ctx *channel_ctx;
+
+    if ((round == 1) && fwk_id_is_type(id, FWK_ID_TYPE_ELEMENT)) {
+        channel_ctx =
+            &host_mbx_ctx.channel_ctx_table[fwk_id_get_element_idx(id)];
+
+        if (fwk_id_is_equal(channel_ctx->bound_id, FWK_ID_NONE)) {
+            return FWK_SUCCESS;
+        }
+
+        return fwk_module_bind(
+            channel_ctx->bound_id,
+            FWK_ID_API(
+                FWK_MODULE_IDX_TRANSPORT, MOD_TRANSPORT_API_IDX_DRIVER_INPUT),
+            &channel_ctx->driver_input_api);
+    }
+
+    return FWK_SUCCESS;
+}
+
+static int host_mbx_process_bind_request(
+    fwk_id_t source_id,
+    fwk_id_t target_id,
+    fwk_id_t api_id,
+    const void **api)
+{
+    struct host_mbx_channel_ctx *channel_ctx;
+
+    if (!fwk_id_is_type(target_id, FWK_ID_TYPE_ELEMENT) ||
+        (fwk_id_get_api_idx(api_id) != MOD_HOST_MBX_API_IDX_TRANSPORT_DRIVER)) {
+        return FWK_E_ACCESS;
+    }
+
+    channel_ctx =
+        &host_mbx_ctx.channel_ctx_table[fwk_id_get_element_idx(target_id)];
+    if (!fwk_id_is_equal(channel_ctx->bound_id, FWK_ID_NONE)) {
+        /* Only one transport channel can use a mailbox */
+        return FWK_E_ACCESS;
+    }
+
+    channel_ctx->bound_id = source_id;
+    *api = &host_mbx_transport_driver_api;
+
+    return FWK_SUCCESS;
+}
+
+static int host_mbx_start(fwk_id_t id)
+{
+    struct sockaddr_un address;
+    int status;
+
+    if (!fwk_id_is_type(id, FWK_ID_TYPE_MODULE)) {
+        return FWK_SUCCESS;
+    }
+
+    status =
+        host_mbx_socket_address(host_mbx_ctx.config->socket_path, &address);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    host_mbx_ctx.socket_fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+    if (host_mbx_ctx.socket_fd < 0) {
+        return FWK_E_DEVICE;
+    }
+
+    unlink(address.sun_path);
+    if (bind(
+            host_mbx_ctx.socket_fd,
+            (const struct sockaddr *)&address,
+            sizeof(address)) != 0) {
+        FWK_LOG_ERR(MOD_NAME "Unable to bind %s", address.sun_path);
+        close(host_mbx_ctx.socket_fd);
+        host_mbx_ctx.socket_fd = -1;
+        return FWK_E_DEVICE;
+    }
+
+    FWK_LOG_INFO(MOD_NAME "Doorbells on %s", address.sun_path);
+
+    status = fwk_arch_set_idle_handler(host_mbx_idle);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_ERR(MOD_NAME "Another idle handler is already set");
+        close(host_mbx_ctx.socket_fd);
+        host_mbx_ctx.socket_fd = -1;
+        return status;
+    }
+
+    return host_mbx_poll_event();
+}
+
+static int host_mbx_process_event(
+    const struct fwk_event *event,
+    struct fwk_event *resp_event)
+{
+    if (fwk_id_get_event_idx(event->id) != HOST_MBX_EVENT_IDX_POLL) {
+        return FWK_E_PARAM;
+    }
+
+    /*
+     * More doorbells may be waiting, poll again once the events queued in the
+     * meantime have been processed. Otherwise, wait in the idle handler.
+     */
+    if (host_mbx_poll()) {
+        return host_mbx_poll_event();
+    }
+
+    return FWK_SUCCESS;
+}
+
+const struct fwk_module module_host_mbx = {
+    .type = FWK_MODULE_TYPE_DRIVER,
+    .api_count = (unsigned int)MOD_HOST_MBX_API_IDX_COUNT,
+    .event_count = (unsigned int)HOST_MBX_EVENT_IDX_COUNT,
+    .init = host_mbx_init,
+    .element_init = host_mbx_channel_init,
+    .bind = host_mbx_bind,
+    .process_bind_request = host_mbx_process_bind_request,
+    .start = host_mbx_start,
+    .process_event = host_mbx_process_event,
+};
@@ -0,0 +1,155 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *     Idle governor.
+ */
+
+#ifndef MOD_IDLE_GOVERNOR_H
+#define MOD_IDLE_GOVERNOR_H
+
+#include <fwk_id.h>
+
+#include <stdint.h>
+
+/*!
+ * \addtogroup GroupModules Modules
+ * \{
+ */
+
+/*!
+ * \defgroup GroupModuleIdleGovernor Idle Governor
+ *
+ * \brief Idle state selection for the SCP.
+ *
+ * \details When the framework has no more events to process, the idle
+ *      governor reads the time left until the next timer alarm and enters
+ *      the deepest idle state that can be left again before that alarm is
+ *      due. Each element of the module describes one idle state, and the
+ *      elements are ordered from the shallowest to the deepest state.
+ *
+ * \{
+ */
+
+/*!
+ * \brief Idle governor API indices.
+ */
+enum mod_idle_governor_api_idx {
+    /*! Statistics API index */
+    MOD_IDLE_GOVERNOR_API_IDX_STATS,
+
+    /*! Number of APIs */
+    MOD_IDLE_GOVERNOR_API_IDX_COUNT,
+};
+
+/*!
+ * \brief Module configuration.
+ */
+struct mod_idle_governor_config {
+    /*! Identifier of the timer device whose alarms bound the idle periods */
+    fwk_id_t timer_id;
+};
+
+/*!
+ * \brief Idle state configuration.
+ */
+struct mod_idle_governor_state_config {
+    /*! Time, in microseconds, needed to resume from the idle state */
+    uint32_t exit_latency;
+
+    /*!
+     * \brief Minimum time, in microseconds, worth spending in the idle state
+     *      on top of its exit latency.
+     */
+    uint32_t min_residency;
+
+    /*!
+     * \brief Identifier of the driver entering the idle state.
+     *
+     * \details When set to ::FWK_ID_NONE, the idle state is entered through
+     *      the architecture suspend.
+     */
+    fwk_id_t driver_id;
+
+    /*! Identifier of the driver API */
+    fwk_id_t driver_api_id;
+};
+
+/*!
+ * \brief Idle state driver interface.
+ */
+struct mod_idle_governor_driver_api {
+    /*!
+     * \brief Enter the idle state and return once the system is woken up.
+     *
+     * \details The driver must have the system running again no later than
+     *      \p wakeup_timestamp, so that the next timer alarm is not delayed.
+     *
+     * \note This function is called with the interrupts masked. A pending
+     *      interrupt must wake the system up, and the driver must return at
+     *      once if an interrupt is already pending. A driver which cannot
+     *      ensure this must return an error, in which case the system is
+     *      suspended through ::fwk_arch_suspend instead.
+     *
+     * \param driver_id Identifier of the driver.
+     * \param wakeup_timestamp Latest wake-up time, in ticks of the timer of
+     *      the governor, or \c UINT64_MAX if no alarm is pending.
+     *
+     * \retval ::FWK_SUCCESS The idle state was entered and left.
+     * \return One of the standard framework error codes.
+     */
+    int (*enter)(fwk_id_t driver_id, uint64_t wakeup_timestamp);
+};
+
+/*!
+ * \brief Idle state statistics.
+ *
+ * \details The times are expressed in ticks of the timer of the governor.
+ */
+struct mod_idle_governor_state_stats {
+    /*! Number of times the idle state was entered */
+    uint32_t entry_count;
+
+    /*! Total time spent in the idle state */
+    uint64_t residency;
+
+    /*! Number of times the idle state lasted until the next alarm */
+    uint32_t timer_wakeup_count;
+
+    /*! Total time from the next alarm to the return from the idle state */
+    uint64_t total_wakeup_latency;
+
+    /*! Longest time from the next alarm to the return from the idle state */
+    uint64_t max_wakeup_latency;
+};
+
+/*!
+ * \brief Statistics API.
+ */
+struct mod_idle_governor_api {
+    /*!
+     * \brief Get the statistics of an idle state.
+     *
+     * \param state_id Element identifier of the idle state.
+     * \param[out] stats Statistics of the idle state.
+     *
+     * \retval ::FWK_SUCCESS The statistics were returned.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered.
+     */
+    int (*get_state_stats)(
+        fwk_id_t state_id,
+        struct mod_idle_governor_state_stats *stats);
+};
+
+/*!
+ * \}
+ */
+
+/*!
+ * \}
+ */
+
+#endif /* MOD_IDLE_GOVERNOR_H */
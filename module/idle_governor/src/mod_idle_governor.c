@@ -0,0 +1,355 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *     Idle governor.
+ */
+
+#include <mod_idle_governor.h>
+#include <mod_timer.h>
+
+#include <fwk_arch.h>
+#include <fwk_assert.h>
+#include <fwk_core.h>
+#include <fwk_id.h>
+#include <fwk_interrupt.h>
+#include <fwk_log.h>
+#include <fwk_mm.h>
+#include <fwk_module.h>
+#include <fwk_module_idx.h>
+#include <fwk_status.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Idle state context (element) */
+struct idle_governor_state_ctx {
+    /* Pointer to the idle state configuration */
+    const struct mod_idle_governor_state_config *config;
+
+    /* Driver API, NULL when the state is entered through the arch suspend */
+    const struct mod_idle_governor_driver_api *driver_api;
+
+    /* Exit latency, in timer ticks */
+    uint64_t exit_latency;
+
+    /* Shortest idle period, in timer ticks, for which the state is chosen */
+    uint64_t threshold;
+
+    /* Statistics */
+    struct mod_idle_governor_state_stats stats;
+};
+
+/* Module context */
+struct idle_governor_ctx {
+    /* Pointer to the module configuration */
+    const struct mod_idle_governor_config *config;
+
+    /* Timer API */
+    const struct mod_timer_api *timer_api;
+
+    /* Table of idle state contexts, from the shallowest to the deepest */
+    struct idle_governor_state_ctx *state_table;
+
+    /* Number of idle states */
+    unsigned int state_count;
+};
+
+static struct idle_governor_ctx idle_governor_ctx;
+
+/*
+ * Helper functions
+ */
+
+/*
+ * Get the timestamp of the next alarm of the governor's timer, UINT64_MAX if
+ * no alarm is pending.
+ */
+static uint64_t idle_governor_deadline(uint64_t now)
+{
+    int status;
+    bool has_alarm = true;
+    uint64_t remaining;
+
+    status = idle_governor_ctx.timer_api->get_next_alarm_remaining(
+        idle_governor_ctx.config->timer_id, &has_alarm, &remaining);
+    if (!has_alarm) {
+        return UINT64_MAX;
+    }
+
+    if (status != FWK_SUCCESS) {
+        return now;
+    }
+
+    return now + remaining;
+}
+
+/* Find the deepest idle state whose threshold fits in the idle period */
+static unsigned int idle_governor_select(uint64_t idle_period)
+{
+    unsigned int state_idx;
+
+    for (state_idx = idle_governor_ctx.state_count - 1; state_idx > 0;
+         state_idx--) {
+        if (idle_governor_ctx.state_table[state_idx].threshold <=
+            idle_period) {
+            break;
+        }
+    }
+
+    return state_idx;
+}
+
+static void idle_governor_stats_update(
+    struct idle_governor_state_ctx *state,
+    uint64_t start,
+    uint64_t end,
+    uint64_t deadline)
+{
+    struct mod_idle_governor_state_stats *stats = &state->stats;
+    uint64_t latency;
+
+    stats->entry_count++;
+    stats->residency += end - start;
+
+    if (end >= deadline) {
+        latency = end - deadline;
+
+        stats->timer_wakeup_count++;
+        stats->total_wakeup_latency += latency;
+        if (latency > stats->max_wakeup_latency) {
+            stats->max_wakeup_latency = latency;
+        }
+    }
+}
+
+/* Select and enter an idle state, called with the interrupts masked */
+static void idle_governor_enter(void)
+{
+    int status;
+    struct idle_governor_state_ctx *state;
+    fwk_id_t timer_id = idle_governor_ctx.config->timer_id;
+    uint64_t start, end, deadline, wakeup;
+
+    status = idle_governor_ctx.timer_api->get_counter(timer_id, &start);
+    if (status != FWK_SUCCESS) {
+        fwk_arch_suspend();
+        return;
+    }
+
+    deadline = idle_governor_deadline(start);
+    state = &idle_governor_ctx.state_table[idle_governor_select(
+        deadline - start)];
+
+    status = FWK_E_SUPPORT;
+    if (state->driver_api != NULL) {
+        /* Wake up early enough to resume before the alarm is due */
+        wakeup = (deadline == UINT64_MAX) ? UINT64_MAX :
+                                            deadline - state->exit_latency;
+
+        status = state->driver_api->enter(state->config->driver_id, wakeup);
+    }
+
+    if (status != FWK_SUCCESS) {
+        state = &idle_governor_ctx.state_table[0];
+        fwk_arch_suspend();
+    }
+
+    status = idle_governor_ctx.timer_api->get_counter(timer_id, &end);
+    if (status == FWK_SUCCESS) {
+        idle_governor_stats_update(state, start, end, deadline);
+    }
+}
+
+/*
+ * Idle handler, called by the framework when it has no more events to
+ * process.
+ */
+static void idle_governor_idle(void)
+{
+    unsigned int flags;
+
+    /*
+     * An interrupt taken between the read of the next alarm and the entry in
+     * the idle state could start an earlier alarm or put an event, which would
+     * then wait for the next wake-up. The interrupts are masked until the idle
+     * state is left, a pending interrupt being taken once they are unmasked.
+     * An event put by an interrupt handler after the last processing of the
+     * queues is processed before the governor idles.
+     */
+    flags = fwk_interrupt_global_disable();
+    if (!fwk_is_event_pending()) {
+        idle_governor_enter();
+    }
+    fwk_interrupt_global_enable(flags);
+}
+
+/*
+ * Statistics API
+ */
+
+static int idle_governor_get_state_stats(
+    fwk_id_t state_id,
+    struct mod_idle_governor_state_stats *stats)
+{
+    struct idle_governor_state_ctx *state;
+
+    if (stats == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    if (!fwk_module_is_valid_element_id(state_id)) {
+        return FWK_E_PARAM;
+    }
+
+    state = &idle_governor_ctx.state_table[fwk_id_get_element_idx(state_id)];
+    *stats = state->stats;
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_idle_governor_api idle_governor_api = {
+    .get_state_stats = idle_governor_get_state_stats,
+};
+
+/*
+ * Framework handlers
+ */
+
+static int idle_governor_init(
+    fwk_id_t module_id,
+    unsigned int state_count,
+    const void *data)
+{
+    if ((state_count == 0) || (data == NULL)) {
+        return FWK_E_PARAM;
+    }
+
+    idle_governor_ctx.config = data;
+    idle_governor_ctx.state_count = state_count;
+    idle_governor_ctx.state_table =
+        fwk_mm_calloc(state_count, sizeof(struct idle_governor_state_ctx));
+
+    return FWK_SUCCESS;
+}
+
+static int idle_governor_state_init(
+    fwk_id_t state_id,
+    unsigned int sub_element_count,
+    const void *data)
+{
+    fwk_assert(data != NULL);
+
+    idle_governor_ctx.state_table[fwk_id_get_element_idx(state_id)].config =
+        data;
+
+    return FWK_SUCCESS;
+}
+
+static int idle_governor_bind(fwk_id_t id, unsigned int round)
+{
+    struct idle_governor_state_ctx *state;
+
+    if (round > 0) {
+        return FWK_SUCCESS;
+    }
+
+    if (fwk_id_is_type(id, FWK_ID_TYPE_MODULE)) {
+        return fwk_module_bind(
+            idle_governor_ctx.config->timer_id,
+            MOD_TIMER_API_ID_TIMER,
+            &idle_governor_ctx.timer_api);
+    }
+
+    state = &idle_governor_ctx.state_table[fwk_id_get_element_idx(id)];
+    if (fwk_id_is_equal(state->config->driver_id, FWK_ID_NONE)) {
+        return FWK_SUCCESS;
+    }
+
+    return fwk_module_bind(
+        state->config->driver_id,
+        state->config->driver_api_id,
+        &state->driver_api);
+}
+
+static int idle_governor_process_bind_request(
+    fwk_id_t requester_id,
+    fwk_id_t target_id,
+    fwk_id_t api_id,
+    const void **api)
+{
+    if (fwk_id_get_api_idx(api_id) != MOD_IDLE_GOVERNOR_API_IDX_STATS) {
+        return FWK_E_PARAM;
+    }
+
+    *api = &idle_governor_api;
+
+    return FWK_SUCCESS;
+}
+
+static int idle_governor_start(fwk_id_t id)
+{
+    int status;
+    unsigned int state_idx;
+    struct idle_governor_state_ctx *state;
+    uint64_t min_residency;
+
+    if (!fwk_id_is_type(id, FWK_ID_TYPE_MODULE)) {
+        return FWK_SUCCESS;
+    }
+
+    /* Convert the state latencies to timer ticks once and for all */
+    for (state_idx = 0; state_idx < idle_governor_ctx.state_count;
+         state_idx++) {
+        state = &idle_governor_ctx.state_table[state_idx];
+
+        status = idle_governor_ctx.timer_api->time_to_timestamp(
+            idle_governor_ctx.config->timer_id,
+            state->config->exit_latency,
+            &state->exit_latency);
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+
+        status = idle_governor_ctx.timer_api->time_to_timestamp(
+            idle_governor_ctx.config->timer_id,
+            state->config->min_residency,
+            &min_residency);
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+
+        state->threshold = state->exit_latency + min_residency;
+    }
+
+    status = fwk_arch_set_idle_handler(idle_governor_idle);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_ERR("[IDLE_GOVERNOR] Another idle handler is already set");
+    }
+
+    return status;
+}
+
+static int idle_governor_stop(fwk_id_t id)
+{
+    if (fwk_id_is_type(id, FWK_ID_TYPE_MODULE)) {
+        return fwk_arch_set_idle_handler(NULL);
+    }
+
+    return FWK_SUCCESS;
+}
+
+const struct fwk_module module_idle_governor = {
+    .type = FWK_MODULE_TYPE_SERVICE,
+    .api_count = (unsigned int)MOD_IDLE_GOVERNOR_API_IDX_COUNT,
+    .init = idle_governor_init,
+    .element_init = idle_governor_state_init,
+    .bind = idle_governor_bind,
+    .process_bind_request = idle_governor_process_bind_request,
+    .start = idle_governor_start,
+    .stop = idle_governor_stop,
+};
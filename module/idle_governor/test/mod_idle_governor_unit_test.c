@@ -0,0 +1,334 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+
+#include <internal/fwk_context.h>
+
+#include <fwk_list.h>
+
+#include <string.h>
+
+#include UNIT_TEST_SRC
+
+#define STATE_COUNT 3
+
+/* The fake timer counts at 10 MHz */
+#define TICKS_PER_MICROSECOND 10
+
+#define MAX_COUNTER_VALUES 2
+
+enum state_idx {
+    STATE_IDX_WFI,
+    STATE_IDX_RETENTION,
+    STATE_IDX_DEEP_RETENTION,
+};
+
+static const struct mod_idle_governor_config governor_config = {
+    .timer_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_TIMER, 0),
+};
+
+static const struct mod_idle_governor_state_config state_config[] = {
+    [STATE_IDX_WFI] = {
+        .driver_id = FWK_ID_NONE_INIT,
+    },
+    [STATE_IDX_RETENTION] = {
+        .exit_latency = 10,
+        .min_residency = 40,
+        .driver_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_FAKE_DRIVER, 0),
+    },
+    [STATE_IDX_DEEP_RETENTION] = {
+        .exit_latency = 100,
+        .min_residency = 400,
+        .driver_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_FAKE_DRIVER, 1),
+    },
+};
+
+static struct idle_governor_state_ctx state_table[STATE_COUNT];
+
+static uint64_t counter_values[MAX_COUNTER_VALUES];
+static unsigned int counter_read_count;
+static bool has_alarm;
+static uint64_t alarm_remaining;
+
+static int enter_status;
+static unsigned int entered_driver_idx;
+static uint64_t entered_wakeup;
+
+static int timer_get_counter(fwk_id_t dev_id, uint64_t *counter)
+{
+    TEST_ASSERT_LESS_THAN(MAX_COUNTER_VALUES, counter_read_count);
+
+    *counter = counter_values[counter_read_count++];
+
+    return FWK_SUCCESS;
+}
+
+static int timer_time_to_timestamp(
+    fwk_id_t dev_id,
+    uint32_t microseconds,
+    uint64_t *timestamp)
+{
+    *timestamp = (uint64_t)microseconds * TICKS_PER_MICROSECOND;
+
+    return FWK_SUCCESS;
+}
+
+static int timer_get_next_alarm_remaining(
+    fwk_id_t dev_id,
+    bool *has_alarm_out,
+    uint64_t *remaining)
+{
+    *has_alarm_out = has_alarm;
+    if (!has_alarm) {
+        return FWK_E_PARAM;
+    }
+
+    *remaining = alarm_remaining;
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_timer_api timer_api = {
+    .get_counter = timer_get_counter,
+    .time_to_timestamp = timer_time_to_timestamp,
+    .get_next_alarm_remaining = timer_get_next_alarm_remaining,
+};
+
+static int driver_enter(fwk_id_t driver_id, uint64_t wakeup_timestamp)
+{
+    entered_driver_idx = fwk_id_get_element_idx(driver_id);
+    entered_wakeup = wakeup_timestamp;
+
+    return enter_status;
+}
+
+static const struct mod_idle_governor_driver_api driver_api = {
+    .enter = driver_enter,
+};
+
+static void start_governor(void)
+{
+    int status;
+
+    status = idle_governor_start(fwk_module_id_idle_governor);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+/* Go idle at start with the next alarm due after remaining, wake at end */
+static void go_idle(uint64_t start, uint64_t remaining, uint64_t end)
+{
+    counter_values[0] = start;
+    counter_values[1] = end;
+    counter_read_count = 0;
+    alarm_remaining = remaining;
+
+    fwk_arch_idle();
+
+    TEST_ASSERT_EQUAL(2, counter_read_count);
+}
+
+static struct mod_idle_governor_state_stats get_stats(unsigned int state_idx)
+{
+    int status;
+    struct mod_idle_governor_state_stats stats;
+
+    status = idle_governor_get_state_stats(
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_IDLE_GOVERNOR, state_idx), &stats);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    return stats;
+}
+
+static void other_idle_handler(void)
+{
+}
+
+void setUp(void)
+{
+    unsigned int state_idx;
+    struct __fwk_ctx *ctx = __fwk_get_ctx();
+
+    fwk_list_init(&ctx->event_queue);
+    fwk_list_init(&ctx->isr_event_queue);
+
+    memset(state_table, 0, sizeof(state_table));
+    for (state_idx = 0; state_idx < STATE_COUNT; state_idx++) {
+        state_table[state_idx].config = &state_config[state_idx];
+        if (state_idx != STATE_IDX_WFI) {
+            state_table[state_idx].driver_api = &driver_api;
+        }
+    }
+
+    idle_governor_ctx.config = &governor_config;
+    idle_governor_ctx.timer_api = &timer_api;
+    idle_governor_ctx.state_table = state_table;
+    idle_governor_ctx.state_count = STATE_COUNT;
+
+    has_alarm = true;
+    enter_status = FWK_SUCCESS;
+    entered_driver_idx = UINT32_MAX;
+    entered_wakeup = 0;
+
+    fwk_module_is_valid_element_id_IgnoreAndReturn(true);
+
+    start_governor();
+}
+
+void tearDown(void)
+{
+    idle_governor_stop(fwk_module_id_idle_governor);
+}
+
+void utest_idle_governor_start(void)
+{
+    TEST_ASSERT_EQUAL(0, state_table[STATE_IDX_WFI].threshold);
+    TEST_ASSERT_EQUAL(100, state_table[STATE_IDX_RETENTION].exit_latency);
+    TEST_ASSERT_EQUAL(500, state_table[STATE_IDX_RETENTION].threshold);
+    TEST_ASSERT_EQUAL(
+        1000, state_table[STATE_IDX_DEEP_RETENTION].exit_latency);
+    TEST_ASSERT_EQUAL(5000, state_table[STATE_IDX_DEEP_RETENTION].threshold);
+}
+
+void utest_idle_governor_start_other_handler(void)
+{
+    int status;
+
+    idle_governor_stop(fwk_module_id_idle_governor);
+
+    status = fwk_arch_set_idle_handler(other_idle_handler);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = idle_governor_start(fwk_module_id_idle_governor);
+    TEST_ASSERT_EQUAL(FWK_E_STATE, status);
+
+    status = fwk_arch_set_idle_handler(NULL);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+void utest_idle_governor_select_wfi(void)
+{
+    /* The next alarm is too close for any retention state */
+    go_idle(1000, 499, 1499);
+
+    TEST_ASSERT_EQUAL(UINT32_MAX, entered_driver_idx);
+    TEST_ASSERT_EQUAL(1, get_stats(STATE_IDX_WFI).entry_count);
+}
+
+void utest_idle_governor_select_retention(void)
+{
+    go_idle(1000, 4999, 5000);
+
+    /* The driver resumes the exit latency before the alarm */
+    TEST_ASSERT_EQUAL(0, entered_driver_idx);
+    TEST_ASSERT_EQUAL(1000 + 4999 - 100, entered_wakeup);
+    TEST_ASSERT_EQUAL(1, get_stats(STATE_IDX_RETENTION).entry_count);
+    TEST_ASSERT_EQUAL(0, get_stats(STATE_IDX_WFI).entry_count);
+}
+
+void utest_idle_governor_select_deep_retention(void)
+{
+    go_idle(1000, 5000, 2000);
+
+    TEST_ASSERT_EQUAL(1, entered_driver_idx);
+    TEST_ASSERT_EQUAL(1000 + 5000 - 1000, entered_wakeup);
+
+    /* Without an alarm, the deepest state is entered with no deadline */
+    has_alarm = false;
+    go_idle(3000, 0, 4000);
+
+    TEST_ASSERT_EQUAL(1, entered_driver_idx);
+    TEST_ASSERT_EQUAL(UINT64_MAX, entered_wakeup);
+    TEST_ASSERT_EQUAL(2, get_stats(STATE_IDX_DEEP_RETENTION).entry_count);
+}
+
+void utest_idle_governor_stats(void)
+{
+    struct mod_idle_governor_state_stats stats;
+
+    /* Woken up by another interrupt before the alarm */
+    go_idle(1000, 600, 1200);
+
+    /* Woken up by the alarm */
+    go_idle(2000, 600, 2610);
+    go_idle(3000, 600, 3630);
+
+    stats = get_stats(STATE_IDX_RETENTION);
+    TEST_ASSERT_EQUAL(3, stats.entry_count);
+    TEST_ASSERT_EQUAL(200 + 610 + 630, stats.residency);
+    TEST_ASSERT_EQUAL(2, stats.timer_wakeup_count);
+    TEST_ASSERT_EQUAL(40, stats.total_wakeup_latency);
+    TEST_ASSERT_EQUAL(30, stats.max_wakeup_latency);
+}
+
+void utest_idle_governor_driver_failure(void)
+{
+    struct mod_idle_governor_state_stats stats;
+
+    /* The idle period is accounted to the architecture suspend */
+    enter_status = FWK_E_DEVICE;
+    go_idle(1000, 600, 1100);
+
+    TEST_ASSERT_EQUAL(0, get_stats(STATE_IDX_RETENTION).entry_count);
+
+    stats = get_stats(STATE_IDX_WFI);
+    TEST_ASSERT_EQUAL(1, stats.entry_count);
+    TEST_ASSERT_EQUAL(100, stats.residency);
+}
+
+void utest_idle_governor_event_pending(void)
+{
+    struct fwk_event event = { 0 };
+    struct __fwk_ctx *ctx = __fwk_get_ctx();
+
+    /* An interrupt handler put an event after the queues were processed */
+    fwk_list_push_tail(&ctx->isr_event_queue, &event.slist_node);
+
+    counter_read_count = 0;
+    alarm_remaining = 6000;
+
+    fwk_arch_idle();
+
+    TEST_ASSERT_EQUAL(0, counter_read_count);
+    TEST_ASSERT_EQUAL(UINT32_MAX, entered_driver_idx);
+    TEST_ASSERT_EQUAL(0, get_stats(STATE_IDX_WFI).entry_count);
+}
+
+void utest_idle_governor_get_state_stats_null(void)
+{
+    int status;
+
+    status = idle_governor_get_state_stats(
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_IDLE_GOVERNOR, 0), NULL);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+int idle_governor_test_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(utest_idle_governor_start);
+    RUN_TEST(utest_idle_governor_start_other_handler);
+    RUN_TEST(utest_idle_governor_select_wfi);
+    RUN_TEST(utest_idle_governor_select_retention);
+    RUN_TEST(utest_idle_governor_select_deep_retention);
+    RUN_TEST(utest_idle_governor_stats);
+    RUN_TEST(utest_idle_governor_driver_failure);
+    RUN_TEST(utest_idle_governor_event_pending);
+    RUN_TEST(utest_idle_governor_get_state_stats_null);
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return idle_governor_test_main();
+}
+#endif
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2023-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2023-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -16,6 +16,9 @@
 #include <fwk_core.h>
 #include <fwk_id.h>
 #include <fwk_log.h>
+#ifdef BUILD_HAS_POWER_DOMAIN_TRANSITION_STATS
+#    include <fwk_time.h>
+#endif
 
 #include <stdbool.h>
 #include <stddef.h>
@@ -69,6 +72,43 @@ struct mod_power_state_pre_transition_notification_ctx {
     bool valid;
 };
 
+#ifdef BUILD_HAS_POWER_DOMAIN_STATE_TABLES
+/*
+ * Valid composite state of a power domain, precomputed with its per-level
+ * target states.
+ */
+struct pd_composite_state_entry {
+    /* Composite state, restricted to its level and targeted level states */
+    uint32_t composite_state;
+
+    /* Highest level targeted by the composite state */
+    uint8_t highest_level;
+
+    /* Target state of each level, starting from the power domain */
+    uint8_t level_state[MOD_PD_LEVEL_COUNT];
+};
+#endif
+
+#ifdef BUILD_HAS_POWER_DOMAIN_TRANSITION_STATS
+/* Timing of the pending power state transition of a power domain */
+struct pd_transition_stats_ctx {
+    /* Time at which the transition was requested to the driver */
+    fwk_timestamp_t transition_start;
+
+    /* Time at which the power state pre-transition notification was sent */
+    fwk_timestamp_t notification_start;
+
+    /* Power state the transition requested to the driver starts from */
+    unsigned int from_state;
+
+    /* Power state the transition requested to the driver goes to */
+    unsigned int to_state;
+
+    /* Flag indicating a transition requested to the driver is pending */
+    bool transition_pending;
+};
+#endif
+
 struct pd_ctx {
     /* Identifier of the power domain */
     fwk_id_t id;
@@ -115,6 +155,17 @@ struct pd_ctx {
     /* Composite state number of levels mask */
     uint32_t composite_state_levels_mask;
 
+#ifdef BUILD_HAS_POWER_DOMAIN_STATE_TABLES
+    /*
+     * Table of the valid composite states, sorted by composite state. NULL
+     * when the composite states are decoded and checked at runtime.
+     */
+    struct pd_composite_state_entry *cs_table;
+
+    /* Number of entries of the table of valid composite states */
+    unsigned int cs_table_size;
+#endif
+
     /* Pointer to the power domain's parent context */
     struct pd_ctx *parent;
 
@@ -155,6 +206,16 @@ struct pd_ctx {
     /* Context for the power state pre-transition notification */
     struct mod_power_state_pre_transition_notification_ctx
         power_state_pre_transition_notification_ctx;
+
+#ifdef BUILD_HAS_POWER_DOMAIN_BATCH_TRANSITIONS
+    /* Flag indicating the ongoing batch waits for this power domain */
+    bool batch_pending;
+#endif
+
+#ifdef BUILD_HAS_POWER_DOMAIN_TRANSITION_STATS
+    /* Timing of the pending power state transition */
+    struct pd_transition_stats_ctx transition_stats;
+#endif
 };
 
 struct system_suspend_ctx {
@@ -199,6 +260,28 @@ struct system_shutdown_ctx {
     struct fwk_event *response_event;
 };
 
+#ifdef BUILD_HAS_POWER_DOMAIN_BATCH_TRANSITIONS
+struct pd_batch_ctx {
+    /* Requests of the submitted batch, until the batch is processed */
+    struct mod_pd_set_state_batch_entry *entries;
+
+    /* Number of requests of the submitted batch */
+    unsigned int entry_count;
+
+    /* Flag indicating if a batch is in progress */
+    bool ongoing;
+
+    /* Number of power domains the batch still waits for */
+    unsigned int pending_count;
+
+    /* Status of the batch, the first error encountered if any */
+    int status;
+
+    /* Pending response context */
+    struct response_ctx response;
+};
+#endif
+
 struct system_suspend_notification_ctx {
     /* Total count of notifications sent for system suspend */
     unsigned int notifications_count;
@@ -225,6 +308,19 @@ struct mod_pd_mod_ctx {
 
     /* System suspend notification context */
     struct system_suspend_notification_ctx system_suspend_notification;
+
+#ifdef BUILD_HAS_POWER_DOMAIN_BATCH_TRANSITIONS
+    /* Batch set state context */
+    struct pd_batch_ctx batch;
+#endif
+
+#ifdef BUILD_HAS_POWER_DOMAIN_TRANSITION_STATS
+    /* Table of the power state transition statistics */
+    struct mod_pd_transition_stats *transition_stats_table;
+
+    /* Number of entries of the transition statistics table in use */
+    unsigned int transition_stats_used;
+#endif
 };
 
 extern struct mod_pd_mod_ctx mod_pd_ctx;
@@ -268,6 +364,11 @@ struct pd_set_state_request {
 struct pd_power_state_transition_report {
     /* The new power state of the power domain */
     uint32_t state;
+
+#ifdef BUILD_HAS_POWER_DOMAIN_TRANSITION_STATS
+    /* Time at which the driver reported the transition */
+    fwk_timestamp_t timestamp;
+#endif
 };
 
 /*
@@ -432,6 +533,22 @@ bool is_valid_composite_state(
     struct pd_ctx *target_pd,
     uint32_t composite_state);
 
+#ifdef BUILD_HAS_POWER_DOMAIN_STATE_TABLES
+/*
+ * Look a composite state up in the table of valid composite states of a power
+ * domain.
+ *
+ * \param pd Power domain description.
+ * \param composite_state Composite state.
+ *
+ * \return The entry of the composite state, NULL if the composite state is
+ *      not valid or the power domain has no table of valid composite states.
+ */
+const struct pd_composite_state_entry *find_composite_state(
+    const struct pd_ctx *pd,
+    uint32_t composite_state);
+#endif
+
 /*
  * Determine whether a composite state requires that the transition begins
  * with the highest or lowest level.
@@ -496,6 +613,30 @@ void process_power_state_transition_report_shallower_state(struct pd_ctx *pd);
  */
 int initiate_power_state_transition(struct pd_ctx *pd);
 
+#ifdef BUILD_HAS_POWER_DOMAIN_BATCH_TRANSITIONS
+/*
+ * Stop waiting for a power domain as part of the ongoing batch, if the batch
+ * waits for it. The response to the batch is sent once it waits for no more
+ * power domains.
+ *
+ * \param pd Description of the power domain
+ * \param status Outcome of the power domain transition, the status of the
+ *      batch if it is the first error encountered.
+ */
+void complete_batch_pd(struct pd_ctx *pd, int status);
+#endif
+
+#ifdef BUILD_HAS_POWER_DOMAIN_TRANSITION_STATS
+/*
+ * Record the time spent waiting for the responses to the power state
+ * pre-transition notification of a power domain.
+ *
+ * \param pd Description of the power domain whose notification responses have
+ *      all been received.
+ */
+void record_notification_latency(const struct pd_ctx *pd);
+#endif
+
 /*
  * Initiate shutdown.
  *
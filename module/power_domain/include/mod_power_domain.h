@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -109,6 +109,18 @@ struct mod_power_domain_config {
      * off or doing complete system suspend by the power domain
      */
     bool enable_system_suspend_notification;
+
+#ifdef BUILD_HAS_POWER_DOMAIN_TRANSITION_STATS
+    /*!
+     *  \brief Number of power state transition statistics entries.
+     *
+     *  \details An entry is used for each (power domain, initial state, target
+     *       state) tuple the first time such a transition is initiated. Once
+     *       all the entries are in use, the transitions of new tuples are not
+     *       recorded.
+     */
+    unsigned int transition_stats_count;
+#endif
 };
 
 /*!
@@ -462,6 +474,23 @@ struct mod_pd_public_api {
     int (*get_domain_parent_id)(fwk_id_t pd_id, fwk_id_t *parent_pd_id);
 };
 
+#ifdef BUILD_HAS_POWER_DOMAIN_BATCH_TRANSITIONS
+/*!
+ * \brief Power state transition request of a batch.
+ */
+struct mod_pd_set_state_batch_entry {
+    /*! Identifier of the power domain whose state has to be set */
+    fwk_id_t pd_id;
+
+    /*!
+     * \brief State the power domain has to be put into and possibly the
+     *      state(s) its ancestor(s) has(have) to be put into, as for a single
+     *      set state request.
+     */
+    uint32_t state;
+};
+#endif
+
 /*!
  * \brief Power domain module restricted interface.
  *
@@ -602,6 +631,45 @@ struct mod_pd_restricted_api {
      * \retval ::FWK_E_NOMEM Failed to allocate a request descriptor.
      */
     int (*system_shutdown)(enum mod_pd_system_shutdown system_shutdown);
+
+#ifdef BUILD_HAS_POWER_DOMAIN_BATCH_TRANSITIONS
+    /*!
+     * \brief Request several asynchronous power state transitions at once.
+     *
+     * \details The requested states are applied to the power domain tree
+     *      together. A request not allowed by the states requested for the
+     *      children of its power domain is applied again after the others,
+     *      and ends the batch with ::FWK_E_PWRSTATE if it remains blocked.
+     *      All the transitions the tree allows are then initiated in the
+     *      same pass, and the remaining ones follow as the driver reports
+     *      come in. When a response is requested, a single
+     *      ::mod_pd_public_event_id_set_state_batch response is sent once
+     *      all the power domains of the batch have completed their
+     *      transition. Its status is the first error encountered, if any.
+     *
+     * \note Only one batch can be in progress at a time.
+     *
+     * \warning Successful completion of this function does not indicate
+     *      completion of the transitions, but instead that the batch has been
+     *      submitted.
+     *
+     * \param entries Table of power state transition requests. The table is
+     *      copied and can be released when the function returns.
+     * \param count Number of requests in the table, at most the number of
+     *      power domains.
+     * \param resp_requested True if the caller wants to be notified with an
+     *      event response at the end of the batch processing.
+     *
+     * \retval ::FWK_SUCCESS The batch was submitted.
+     * \retval ::FWK_E_BUSY A batch is already in progress.
+     * \retval ::FWK_E_PARAM One or more parameters were invalid.
+     * \return One of the standard framework error codes.
+     */
+    int (*set_state_batch)(
+        const struct mod_pd_set_state_batch_entry *entries,
+        unsigned int count,
+        bool resp_requested);
+#endif
 };
 
 /*!
@@ -702,6 +770,107 @@ struct mod_pd_driver_input_api {
     int (*get_last_core_pd_id)(fwk_id_t *last_core_pd_id);
 };
 
+#ifdef BUILD_HAS_POWER_DOMAIN_TRANSITION_STATS
+/*!
+ * \brief Number of buckets of the transition latency histograms.
+ */
+#define MOD_PD_LATENCY_HISTOGRAM_BUCKET_COUNT 8
+
+/*!
+ * \brief Upper bound, in microseconds, of a latency histogram bucket.
+ *
+ * \details Bucket 'i' counts the latencies lower than 4 << (2 * i)
+ *      microseconds which do not fit in bucket 'i - 1', from 4us up to 16ms.
+ *      The last bucket counts all the longer latencies.
+ */
+#define MOD_PD_LATENCY_HISTOGRAM_BUCKET_LIMIT_US(BUCKET) \
+    (UINT32_C(4) << (2 * (BUCKET)))
+
+/*!
+ * \brief Statistics of a latency, in microseconds.
+ *
+ * \details The average latency is `total_latency / count`.
+ */
+struct mod_pd_latency_stats {
+    /*! Number of samples. */
+    uint32_t count;
+
+    /*! Shortest latency. */
+    uint32_t min_latency;
+
+    /*! Longest latency. */
+    uint32_t max_latency;
+
+    /*! Sum of all the latencies. */
+    uint64_t total_latency;
+
+    /*! Latency histogram. */
+    uint32_t histogram[MOD_PD_LATENCY_HISTOGRAM_BUCKET_COUNT];
+};
+
+/*!
+ * \brief Statistics of the power state transitions of a power domain from one
+ *      state to another.
+ */
+struct mod_pd_transition_stats {
+    /*! Identifier of the power domain. */
+    fwk_id_t pd_id;
+
+    /*! Power state the transitions start from. */
+    uint8_t from_state;
+
+    /*! Power state the transitions go to. */
+    uint8_t to_state;
+
+    /*!
+     * \brief Time between the request of the transition to the driver and the
+     *      report of its completion by the driver.
+     */
+    struct mod_pd_latency_stats transition;
+
+    /*!
+     * \brief Time spent waiting for the responses to the power state
+     *      pre-transition notification before the transition is requested to
+     *      the driver.
+     */
+    struct mod_pd_latency_stats notification;
+};
+
+/*!
+ * \brief Power state transition statistics API.
+ */
+struct mod_pd_transition_stats_api {
+    /*!
+     * \brief Get the number of transition statistics entries in use.
+     *
+     * \param[out] count Number of entries in use.
+     *
+     * \retval ::FWK_SUCCESS The number of entries was returned.
+     * \retval ::FWK_E_PARAM The `count` parameter was a null pointer value.
+     */
+    int (*get_count)(unsigned int *count);
+
+    /*!
+     * \brief Get a transition statistics entry.
+     *
+     * \param index Index of the entry.
+     * \param[out] stats Transition statistics.
+     *
+     * \retval ::FWK_SUCCESS The entry was returned.
+     * \retval ::FWK_E_PARAM The `stats` parameter was a null pointer value.
+     * \retval ::FWK_E_RANGE The entry is not in use.
+     */
+    int (*get_stats)(unsigned int index, struct mod_pd_transition_stats *stats);
+
+    /*!
+     * \brief Release all the transition statistics entries.
+     *
+     * \retval ::FWK_SUCCESS The statistics were reset.
+     */
+    int (*reset)(void);
+};
+#endif
+
 /*!
  * \brief Parameters of a power state pre-transition notification.
  */
@@ -760,6 +929,9 @@ enum mod_pd_api_idx {
     MOD_PD_API_IDX_PUBLIC,
     MOD_PD_API_IDX_RESTRICTED,
     MOD_PD_API_IDX_DRIVER_INPUT,
+#ifdef BUILD_HAS_POWER_DOMAIN_TRANSITION_STATS
+    MOD_PD_API_IDX_TRANSITION_STATS,
+#endif
     MOD_PD_API_IDX_COUNT,
 };
 
@@ -775,6 +947,13 @@ static const fwk_id_t mod_pd_api_id_restricted =
 /*! Driver input API identifier */
 static const fwk_id_t mod_pd_api_id_driver_input =
     FWK_ID_API_INIT(FWK_MODULE_IDX_POWER_DOMAIN, MOD_PD_API_IDX_DRIVER_INPUT);
+
+#    ifdef BUILD_HAS_POWER_DOMAIN_TRANSITION_STATS
+/*! Transition statistics API identifier */
+static const fwk_id_t mod_pd_api_id_transition_stats = FWK_ID_API_INIT(
+    FWK_MODULE_IDX_POWER_DOMAIN,
+    MOD_PD_API_IDX_TRANSITION_STATS);
+#    endif
 #endif
 
 #ifdef BUILD_HAS_NOTIFICATION
@@ -850,6 +1029,11 @@ enum mod_pd_public_event_idx {
     /*! Set state request event */
     MOD_PD_PUBLIC_EVENT_IDX_SET_STATE,
 
+#ifdef BUILD_HAS_POWER_DOMAIN_BATCH_TRANSITIONS
+    /*! Batch set state request event */
+    MOD_PD_PUBLIC_EVENT_IDX_SET_STATE_BATCH,
+#endif
+
     /*! Number of public Power Domain events */
     MOD_PD_PUBLIC_EVENT_IDX_COUNT,
 };
@@ -877,6 +1061,16 @@ struct pd_set_state_response {
     uint32_t composite_state;
 };
 
+#ifdef BUILD_HAS_POWER_DOMAIN_BATCH_TRANSITIONS
+/*!
+ * \brief Parameters of the batch set state response event
+ */
+struct pd_set_state_batch_response {
+    /*! Status of the batch, the first error encountered if any */
+    int status;
+};
+#endif
+
 /*!
  * \brief Public Events identifiers.
  */
@@ -886,6 +1080,14 @@ static const fwk_id_t mod_pd_public_event_id_set_state =
     FWK_ID_EVENT_INIT(FWK_MODULE_IDX_POWER_DOMAIN,
                       MOD_PD_PUBLIC_EVENT_IDX_SET_STATE);
 
+#    ifdef BUILD_HAS_POWER_DOMAIN_BATCH_TRANSITIONS
+/*! Identifier of the public event set_state_batch identifier */
+static const fwk_id_t mod_pd_public_event_id_set_state_batch =
+    FWK_ID_EVENT_INIT(
+        FWK_MODULE_IDX_POWER_DOMAIN,
+        MOD_PD_PUBLIC_EVENT_IDX_SET_STATE_BATCH);
+#    endif
+
 #endif
 
 /*!
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -24,6 +24,7 @@
 #include <fwk_module_idx.h>
 #include <fwk_notification.h>
 #include <fwk_status.h>
+#include <fwk_string.h>
 
 #include <inttypes.h>
 #include <stdbool.h>
@@ -108,11 +109,284 @@ static int connect_pd_tree(void)
     return FWK_SUCCESS;
 }
 
+#ifdef BUILD_HAS_POWER_DOMAIN_STATE_TABLES
+/* Get the first valid state of a power domain from a given state */
+static unsigned int next_valid_state(
+    const struct pd_ctx *pd,
+    unsigned int state)
+{
+    while ((state < MOD_PD_STATE_COUNT_MAX) && !is_valid_state(pd, state)) {
+        state++;
+    }
+
+    return state;
+}
+
+/*
+ * Check that the level states of a composite state entry are compatible with
+ * each other and encode its composite state.
+ */
+static bool complete_composite_state_entry(
+    const struct pd_ctx *const level_pd[],
+    struct pd_composite_state_entry *entry)
+{
+    const struct pd_ctx *lowest_pd = level_pd[0];
+    const uint32_t *state_mask_table = lowest_pd->composite_state_mask_table;
+    uint32_t levels_mask = lowest_pd->composite_state_levels_mask;
+    unsigned int level, shift;
+    uint32_t composite_state;
+
+    shift = number_of_bits_to_shift(levels_mask);
+    composite_state = ((uint32_t)entry->highest_level << shift) & levels_mask;
+    if ((composite_state >> shift) != entry->highest_level) {
+        return false;
+    }
+
+    for (level = 0; level <= entry->highest_level; level++) {
+        if ((level > 0) &&
+            !is_allowed_by_child(
+                level_pd[level - 1U],
+                entry->level_state[level],
+                entry->level_state[level - 1U])) {
+            return false;
+        }
+
+        shift = number_of_bits_to_shift(state_mask_table[level]);
+        composite_state |= ((uint32_t)entry->level_state[level] << shift) &
+            state_mask_table[level];
+
+        /* The state does not fit in the bits of its level */
+        if (get_level_state_from_composite_state(
+                state_mask_table, composite_state, (int)level) !=
+            entry->level_state[level]) {
+            return false;
+        }
+    }
+
+    entry->composite_state = composite_state;
+
+    return true;
+}
+
+/*
+ * Walk the valid composite states of a power domain and count them. When
+ * 'table' is not NULL, they are also inserted in it, sorted by composite
+ * state.
+ */
+static unsigned int walk_composite_states(
+    const struct pd_ctx *lowest_pd,
+    struct pd_composite_state_entry *table)
+{
+    const struct pd_ctx *level_pd[MOD_PD_LEVEL_COUNT];
+    const struct pd_ctx *pd = lowest_pd;
+    struct pd_composite_state_entry entry = { 0 };
+    unsigned int count = 0;
+    unsigned int level, highest_level, idx;
+
+    for (highest_level = 0;
+         (highest_level < lowest_pd->composite_state_mask_table_size) &&
+         (pd != NULL);
+         highest_level++, pd = pd->parent) {
+        level_pd[highest_level] = pd;
+        entry.highest_level = (uint8_t)highest_level;
+
+        for (level = 0; level <= highest_level; level++) {
+            entry.level_state[level] =
+                (uint8_t)next_valid_state(level_pd[level], 0);
+        }
+
+        if (entry.level_state[highest_level] >= MOD_PD_STATE_COUNT_MAX) {
+            break;
+        }
+
+        while (entry.level_state[highest_level] < MOD_PD_STATE_COUNT_MAX) {
+            if (complete_composite_state_entry(level_pd, &entry)) {
+                if (table != NULL) {
+                    for (idx = count; (idx > 0) &&
+                         (table[idx - 1U].composite_state >
+                          entry.composite_state);
+                         idx--) {
+                        table[idx] = table[idx - 1U];
+                    }
+                    table[idx] = entry;
+                }
+                count++;
+            }
+
+            /* Move to the next combination of level states */
+            for (level = 0; level <= highest_level; level++) {
+                entry.level_state[level] = (uint8_t)next_valid_state(
+                    level_pd[level], entry.level_state[level] + 1U);
+                if ((entry.level_state[level] < MOD_PD_STATE_COUNT_MAX) ||
+                    (level == highest_level)) {
+                    break;
+                }
+                entry.level_state[level] =
+                    (uint8_t)next_valid_state(level_pd[level], 0);
+            }
+        }
+    }
+
+    return count;
+}
+
+/*
+ * Sub-routine of 'pd_post_init()', to precompute the valid composite states of
+ * the power domains supporting composite states with an explicit level field.
+ */
+static void build_composite_state_tables(void)
+{
+    unsigned int index, count;
+    struct pd_ctx *pd;
+
+    for (index = 0; index < mod_pd_ctx.pd_count; index++) {
+        pd = &mod_pd_ctx.pd_ctx_table[index];
+        if (!pd->cs_support || (pd->composite_state_levels_mask == 0) ||
+            (pd->composite_state_mask_table_size > MOD_PD_LEVEL_COUNT)) {
+            continue;
+        }
+
+        count = walk_composite_states(pd, NULL);
+        if (count == 0) {
+            continue;
+        }
+
+        pd->cs_table =
+            fwk_mm_calloc(count, sizeof(struct pd_composite_state_entry));
+        pd->cs_table_size = walk_composite_states(pd, pd->cs_table);
+    }
+}
+#endif
+
+#ifdef BUILD_HAS_POWER_DOMAIN_TRANSITION_STATS
+/*
+ * Find the statistics entry of a power state transition, or take a free entry
+ * for it on its first occurrence. The number of distinct transitions seen by
+ * a platform is small, so a linear search is sufficient.
+ */
+static struct mod_pd_transition_stats *transition_stats_get_entry(
+    const struct pd_ctx *pd,
+    unsigned int from_state,
+    unsigned int to_state)
+{
+    struct mod_pd_transition_stats *entry;
+    unsigned int entry_idx;
+
+    for (entry_idx = 0; entry_idx < mod_pd_ctx.transition_stats_used;
+         entry_idx++) {
+        entry = &mod_pd_ctx.transition_stats_table[entry_idx];
+        if (fwk_id_is_equal(entry->pd_id, pd->id) &&
+            (entry->from_state == from_state) &&
+            (entry->to_state == to_state)) {
+            return entry;
+        }
+    }
+
+    if (mod_pd_ctx.transition_stats_used ==
+        mod_pd_ctx.config->transition_stats_count) {
+        return NULL;
+    }
+
+    entry =
+        &mod_pd_ctx.transition_stats_table[mod_pd_ctx.transition_stats_used++];
+    *entry = (struct mod_pd_transition_stats){
+        .pd_id = pd->id,
+        .from_state = (uint8_t)from_state,
+        .to_state = (uint8_t)to_state,
+    };
+
+    return entry;
+}
+
+/* Index of the histogram bucket of a latency */
+static unsigned int latency_stats_bucket(fwk_duration_us_t latency)
+{
+    unsigned int bucket;
+
+    for (bucket = 0; bucket < (MOD_PD_LATENCY_HISTOGRAM_BUCKET_COUNT - 1);
+         bucket++) {
+        if (latency < MOD_PD_LATENCY_HISTOGRAM_BUCKET_LIMIT_US(bucket)) {
+            break;
+        }
+    }
+
+    return bucket;
+}
+
+static void latency_stats_update(
+    struct mod_pd_latency_stats *stats,
+    fwk_duration_us_t latency)
+{
+    uint32_t latency_us = (uint32_t)FWK_MIN(latency, UINT32_MAX);
+
+    if ((stats->count == 0) || (latency_us < stats->min_latency)) {
+        stats->min_latency = latency_us;
+    }
+
+    if (latency_us > stats->max_latency) {
+        stats->max_latency = latency_us;
+    }
+
+    stats->count++;
+    stats->total_latency += latency;
+    stats->histogram[latency_stats_bucket(latency)]++;
+}
+
+/*
+ * Record the latency of the transition requested to the driver of a power
+ * domain, on the report of its completion to the requested state.
+ */
+static void record_transition_latency(
+    struct pd_ctx *pd,
+    fwk_timestamp_t report_timestamp)
+{
+    struct mod_pd_transition_stats *entry;
+
+    if (!pd->transition_stats.transition_pending) {
+        return;
+    }
+
+    pd->transition_stats.transition_pending = false;
+
+    entry = transition_stats_get_entry(
+        pd, pd->transition_stats.from_state, pd->transition_stats.to_state);
+    if (entry == NULL) {
+        return;
+    }
+
+    latency_stats_update(
+        &entry->transition,
+        fwk_time_duration_us(fwk_time_elapsed(
+            pd->transition_stats.transition_start, report_timestamp)));
+}
+
+void record_notification_latency(const struct pd_ctx *pd)
+{
+    struct mod_pd_transition_stats *entry;
+
+    entry = transition_stats_get_entry(
+        pd,
+        pd->current_state,
+        pd->power_state_pre_transition_notification_ctx.state);
+    if (entry == NULL) {
+        return;
+    }
+
+    latency_stats_update(
+        &entry->notification,
+        fwk_time_duration_us(fwk_time_elapsed(
+            pd->transition_stats.notification_start, fwk_time_current())));
+}
+#endif
+
 int initiate_power_state_transition(struct pd_ctx *pd)
 {
     int status;
     unsigned int state = pd->requested_state;
     unsigned int mapped_state;
+#ifdef BUILD_HAS_POWER_DOMAIN_TRANSITION_STATS
+    fwk_timestamp_t transition_start;
+#endif
 
     if ((pd->driver_api->deny != NULL) &&
         pd->driver_api->deny(pd->driver_id, state)) {
@@ -126,6 +400,9 @@ int initiate_power_state_transition(struct pd_ctx *pd)
     }
 
     mapped_state = retrieve_mapped_state(pd, state);
+#ifdef BUILD_HAS_POWER_DOMAIN_TRANSITION_STATS
+    transition_start = fwk_time_current();
+#endif
     status = pd->driver_api->set_state(pd->driver_id, mapped_state);
 
     if (status == FWK_SUCCESS) {
@@ -138,6 +415,13 @@ int initiate_power_state_transition(struct pd_ctx *pd)
 #endif
         pd->driver_state = mapped_state;
         pd->state_requested_to_driver = state;
+
+#ifdef BUILD_HAS_POWER_DOMAIN_TRANSITION_STATS
+        pd->transition_stats.transition_start = transition_start;
+        pd->transition_stats.from_state = pd->current_state;
+        pd->transition_stats.to_state = state;
+        pd->transition_stats.transition_pending = true;
+#endif
     }
 
 #if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_ERROR
@@ -191,6 +475,62 @@ static void send_pd_set_state_delayed_response(
     }
 }
 
+#ifdef BUILD_HAS_POWER_DOMAIN_BATCH_TRANSITIONS
+/*
+ * Send the delayed response to the batch set state request, if any, and end
+ * the batch.
+ */
+static void send_pd_set_state_batch_delayed_response(void)
+{
+    int status;
+    struct fwk_event resp_event;
+    struct pd_batch_ctx *batch = &mod_pd_ctx.batch;
+    struct pd_set_state_batch_response *resp_params =
+        (struct pd_set_state_batch_response *)(&resp_event.params);
+
+    batch->ongoing = false;
+
+    if (!batch->response.pending) {
+        return;
+    }
+
+    status = fwk_get_delayed_response(
+        fwk_module_id_power_domain, batch->response.cookie, &resp_event);
+    batch->response.pending = false;
+
+    if (status != FWK_SUCCESS) {
+        return;
+    }
+
+    resp_params->status = batch->status;
+
+    status = fwk_put_event(&resp_event);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[PD] %s @%d", __func__, __LINE__);
+    }
+}
+
+void complete_batch_pd(struct pd_ctx *pd, int status)
+{
+    struct pd_batch_ctx *batch = &mod_pd_ctx.batch;
+
+    if (!pd->batch_pending) {
+        return;
+    }
+
+    pd->batch_pending = false;
+    batch->pending_count--;
+
+    if (batch->status == FWK_SUCCESS) {
+        batch->status = status;
+    }
+
+    if (batch->pending_count == 0) {
+        send_pd_set_state_batch_delayed_response();
+    }
+}
+#endif
+
 /*
  * Process a 'set state' request
  *
@@ -213,6 +553,9 @@ static void process_set_state_request(
     struct pd_ctx *pd, *pd_in_charge_of_response;
     const struct pd_ctx *parent;
     const uint32_t *state_mask_table = NULL;
+#ifdef BUILD_HAS_POWER_DOMAIN_STATE_TABLES
+    const struct pd_composite_state_entry *cs_entry;
+#endif
 
     req_params = (struct pd_set_state_request *)event->params;
     resp_params = (struct pd_set_state_response *)resp_event->params;
@@ -243,6 +586,11 @@ static void process_set_state_request(
         state_mask_table = pd->composite_state_mask_table;
     }
 
+#ifdef BUILD_HAS_POWER_DOMAIN_STATE_TABLES
+    /* The per-level states are looked up when they are precomputed */
+    cs_entry = find_composite_state(lowest_pd, composite_state);
+#endif
+
     for (pd_index = 0; pd_index < nb_pds; pd_index++, pd = pd->parent) {
         if (up) {
             level = pd_index;
@@ -259,8 +607,15 @@ static void process_set_state_request(
         }
 
         if (composite_state_operation) {
+#ifdef BUILD_HAS_POWER_DOMAIN_STATE_TABLES
+            state = (cs_entry != NULL) ?
+                cs_entry->level_state[level] :
+                get_level_state_from_composite_state(
+                    state_mask_table, composite_state, (int)level);
+#else
             state = get_level_state_from_composite_state(
                 state_mask_table, composite_state, (int)level);
+#endif
         } else {
             state = composite_state;
         }
@@ -292,6 +647,9 @@ static void process_set_state_request(
         pd->requested_state = state;
         pd->power_state_pre_transition_notification_ctx.valid = false;
         send_pd_set_state_delayed_response(pd, FWK_E_OVERWRITTEN);
+#ifdef BUILD_HAS_POWER_DOMAIN_BATCH_TRANSITIONS
+        complete_batch_pd(pd, FWK_E_OVERWRITTEN);
+#endif
 
         if (pd->state_requested_to_driver == state) {
             continue;
@@ -367,6 +725,177 @@ static void process_set_state_request(
     }
 }
 
+#ifdef BUILD_HAS_POWER_DOMAIN_BATCH_TRANSITIONS
+/*
+ * Apply the states of one request of a batch to the power domain tree,
+ * without initiating any transition.
+ *
+ * \param lowest_pd Description of the target of the request
+ * \param composite_state State requested for the power domain and possibly
+ *     its ancestors
+ *
+ * \retval ::FWK_SUCCESS The requested states were applied.
+ * \retval ::FWK_PENDING A requested state is not allowed by the states
+ *     requested for the children of its power domain. The states requested
+ *     for the levels below it were applied.
+ * \retval ::FWK_E_PWRSTATE A requested state is not compatible with the state
+ *     requested for the parent of its power domain.
+ */
+static int apply_batch_request(
+    struct pd_ctx *lowest_pd,
+    uint32_t composite_state)
+{
+    struct pd_batch_ctx *batch = &mod_pd_ctx.batch;
+    bool up;
+    unsigned int highest_level, level, nb_pds, pd_index, state;
+    struct pd_ctx *pd;
+    const struct pd_ctx *parent;
+
+    up = is_upwards_transition_propagation(lowest_pd, composite_state);
+    highest_level = (unsigned int)get_highest_level_from_composite_state(
+        lowest_pd, composite_state);
+    nb_pds = highest_level + 1U;
+
+    pd = lowest_pd;
+    for (pd_index = 0; pd_index < nb_pds; pd_index++, pd = pd->parent) {
+        if (up) {
+            level = pd_index;
+        } else {
+            pd = lowest_pd;
+            for (level = 0; level < (highest_level - pd_index); level++) {
+                pd = pd->parent;
+            }
+        }
+
+        if (lowest_pd->cs_support) {
+            state = get_level_state_from_composite_state(
+                lowest_pd->composite_state_mask_table,
+                composite_state,
+                (int)level);
+        } else {
+            state = composite_state;
+        }
+
+        if (state == pd->requested_state) {
+            continue;
+        }
+
+        parent = pd->parent;
+        if ((parent != NULL) &&
+            (!is_allowed_by_child(pd, parent->requested_state, state))) {
+            return FWK_E_PWRSTATE;
+        }
+
+        /*
+         * Another request of the batch may lift the restriction from the
+         * children, the request is then applied again.
+         */
+        if (!is_allowed_by_children(pd, state)) {
+            return FWK_PENDING;
+        }
+
+        pd->requested_state = state;
+        pd->power_state_pre_transition_notification_ctx.valid = false;
+        send_pd_set_state_delayed_response(pd, FWK_E_OVERWRITTEN);
+
+        if (pd->state_requested_to_driver == state) {
+            complete_batch_pd(pd, FWK_SUCCESS);
+        } else if (!pd->batch_pending) {
+            pd->batch_pending = true;
+            batch->pending_count++;
+        }
+    }
+
+    return FWK_SUCCESS;
+}
+
+/*
+ * Process a 'batch set state' request
+ *
+ * The states of all the requests are applied to the power domain tree first.
+ * The transitions that the tree allows are then initiated in a single pass
+ * over the power domains. The others are initiated as the transition reports
+ * of their parent or children come in.
+ *
+ * \param event Batch set state request event
+ * \param [out] resp_event Response event
+ */
+static void process_set_state_batch_request(
+    const struct fwk_event *event,
+    struct fwk_event *resp_event)
+{
+    int status;
+    struct pd_batch_ctx *batch = &mod_pd_ctx.batch;
+    struct pd_set_state_batch_response *resp_params =
+        (struct pd_set_state_batch_response *)resp_event->params;
+    const struct mod_pd_set_state_batch_entry *entry;
+    unsigned int entry_count, entry_idx, pd_idx;
+    struct pd_ctx *pd;
+
+    /* A set state request cancels the completion of system suspend. */
+    mod_pd_ctx.system_suspend.last_core_off_ongoing = false;
+
+    batch->status = FWK_SUCCESS;
+
+    /*
+     * The requests blocked by the states requested for the children of a power
+     * domain are kept and applied again after the others, as long as this
+     * unblocks some of them.
+     */
+    do {
+        entry_count = batch->entry_count;
+        batch->entry_count = 0;
+
+        for (entry_idx = 0; entry_idx < entry_count; entry_idx++) {
+            entry = &batch->entries[entry_idx];
+            pd = &mod_pd_ctx
+                      .pd_ctx_table[fwk_id_get_element_idx(entry->pd_id)];
+
+            status = apply_batch_request(pd, entry->state);
+            if (status == FWK_PENDING) {
+                batch->entries[batch->entry_count++] = *entry;
+            } else if (
+                (status != FWK_SUCCESS) && (batch->status == FWK_SUCCESS)) {
+                batch->status = status;
+            }
+        }
+    } while ((batch->entry_count != 0) && (batch->entry_count < entry_count));
+
+    /* The remaining requests can not be applied */
+    if ((batch->entry_count != 0) && (batch->status == FWK_SUCCESS)) {
+        batch->status = FWK_E_PWRSTATE;
+    }
+    batch->entry_count = 0;
+
+    for (pd_idx = 0; pd_idx < mod_pd_ctx.pd_count; pd_idx++) {
+        pd = &mod_pd_ctx.pd_ctx_table[pd_idx];
+
+        if (!pd->batch_pending ||
+            !is_allowed_by_parent_and_children(pd, pd->requested_state) ||
+            power_state_pre_transition_notification_wrapper(pd)) {
+            continue;
+        }
+
+        status = initiate_power_state_transition(pd);
+        if (status != FWK_SUCCESS) {
+            /* The power state change failed, restore the previous state */
+            pd->requested_state = pd->state_requested_to_driver;
+            complete_batch_pd(pd, status);
+        }
+    }
+
+    if (batch->pending_count == 0) {
+        batch->ongoing = false;
+        resp_params->status = batch->status;
+    } else if (event->response_requested) {
+        resp_event->is_delayed_response = true;
+        resp_event->source_id = fwk_module_id_power_domain;
+        batch->response.pending = true;
+        batch->response.cookie = resp_event->cookie;
+    }
+}
+#endif
+
 /*
  * Complete a system suspend
  *
@@ -543,6 +1072,9 @@ void process_power_state_transition_report_deeper_state(struct pd_ctx *pd)
         status = initiate_power_state_transition(parent);
         if (status != FWK_SUCCESS) {
             FWK_LOG_DEBUG("[PD] %s @%d", __func__, __LINE__);
+#ifdef BUILD_HAS_POWER_DOMAIN_BATCH_TRANSITIONS
+            complete_batch_pd(parent, status);
+#endif
         }
     }
     return;
@@ -577,6 +1109,9 @@ void process_power_state_transition_report_shallower_state(struct pd_ctx *pd)
             status = initiate_power_state_transition(child);
             if (status != FWK_SUCCESS) {
                 FWK_LOG_DEBUG("[PD] %s @%d", __func__, __LINE__);
+#ifdef BUILD_HAS_POWER_DOMAIN_BATCH_TRANSITIONS
+                complete_batch_pd(child, status);
+#endif
             }
         }
     }
@@ -614,7 +1149,13 @@ static void process_power_state_transition_report(
     unsigned int new_state = report_params->state;
 
     if (new_state == pd->driver_state) {
+#ifdef BUILD_HAS_POWER_DOMAIN_TRANSITION_STATS
+        record_transition_latency(pd, report_params->timestamp);
+#endif
         send_pd_set_state_delayed_response(pd, FWK_SUCCESS);
+#ifdef BUILD_HAS_POWER_DOMAIN_BATCH_TRANSITIONS
+        complete_batch_pd(pd, FWK_SUCCESS);
+#endif
     }
 
     previous_state = pd->current_state;
@@ -985,6 +1526,67 @@ static int pd_set_state(fwk_id_t pd_id, bool response_requested, uint32_t state)
     return fwk_put_event(&req);
 }
 
+#ifdef BUILD_HAS_POWER_DOMAIN_BATCH_TRANSITIONS
+static int pd_set_state_batch(
+    const struct mod_pd_set_state_batch_entry *entries,
+    unsigned int count,
+    bool response_requested)
+{
+    int status;
+    unsigned int entry_idx;
+    struct pd_ctx *pd;
+    struct fwk_event req;
+
+    if ((entries == NULL) || (count == 0) || (count > mod_pd_ctx.pd_count)) {
+        return FWK_E_PARAM;
+    }
+
+    for (entry_idx = 0; entry_idx < count; entry_idx++) {
+        if (!fwk_module_is_valid_element_id(entries[entry_idx].pd_id)) {
+            return FWK_E_PARAM;
+        }
+
+        pd = &mod_pd_ctx.pd_ctx_table[fwk_id_get_element_idx(
+            entries[entry_idx].pd_id)];
+
+        if (pd->cs_support) {
+            if (!is_valid_composite_state(pd, entries[entry_idx].state)) {
+                return FWK_E_PARAM;
+            }
+        } else {
+            if (!is_valid_state(pd, entries[entry_idx].state)) {
+                return FWK_E_PARAM;
+            }
+        }
+    }
+
+    if (mod_pd_ctx.batch.ongoing) {
+        return FWK_E_BUSY;
+    }
+
+    req = (struct fwk_event){
+        .id = FWK_ID_EVENT(
+            FWK_MODULE_IDX_POWER_DOMAIN,
+            MOD_PD_PUBLIC_EVENT_IDX_SET_STATE_BATCH),
+        .target_id = fwk_module_id_power_domain,
+        .response_requested = response_requested,
+    };
+
+    fwk_str_memcpy(
+        mod_pd_ctx.batch.entries,
+        entries,
+        count * sizeof(struct mod_pd_set_state_batch_entry));
+    mod_pd_ctx.batch.entry_count = count;
+
+    status = fwk_put_event(&req);
+    if (status == FWK_SUCCESS) {
+        mod_pd_ctx.batch.ongoing = true;
+    }
+
+    return status;
+}
+#endif
+
 static int pd_get_state(fwk_id_t pd_id, unsigned int *state)
 {
     struct pd_ctx *pd = NULL;
@@ -1092,6 +1694,9 @@ static int report_power_state_transition(
                                 FWK_MODULE_IDX_POWER_DOMAIN,
                                 PD_EVENT_IDX_REPORT_POWER_STATE_TRANSITION) };
     report_params->state = state;
+#ifdef BUILD_HAS_POWER_DOMAIN_TRANSITION_STATS
+    report_params->timestamp = fwk_time_current();
+#endif
 
     return fwk_put_event(&report);
 }
@@ -1135,7 +1740,10 @@ static const struct mod_pd_restricted_api pd_restricted_api = {
     .get_state = pd_get_state,
     .reset = pd_reset,
     .system_suspend = pd_system_suspend,
-    .system_shutdown = pd_system_shutdown
+    .system_shutdown = pd_system_shutdown,
+#ifdef BUILD_HAS_POWER_DOMAIN_BATCH_TRANSITIONS
+    .set_state_batch = pd_set_state_batch,
+#endif
 };
 
 static const struct mod_pd_driver_input_api pd_driver_input_api = {
@@ -1145,6 +1753,50 @@ static const struct mod_pd_driver_input_api pd_driver_input_api = {
     .get_last_core_pd_id = pd_get_last_core_pd_id,
 };
 
+#ifdef BUILD_HAS_POWER_DOMAIN_TRANSITION_STATS
+/* Functions specific to the transition statistics API */
+static int pd_transition_stats_get_count(unsigned int *count)
+{
+    if (count == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    *count = mod_pd_ctx.transition_stats_used;
+
+    return FWK_SUCCESS;
+}
+
+static int pd_transition_stats_get_stats(
+    unsigned int index,
+    struct mod_pd_transition_stats *stats)
+{
+    if (stats == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    if (index >= mod_pd_ctx.transition_stats_used) {
+        return FWK_E_RANGE;
+    }
+
+    *stats = mod_pd_ctx.transition_stats_table[index];
+
+    return FWK_SUCCESS;
+}
+
+static int pd_transition_stats_reset(void)
+{
+    mod_pd_ctx.transition_stats_used = 0;
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_pd_transition_stats_api pd_transition_stats_api = {
+    .get_count = pd_transition_stats_get_count,
+    .get_stats = pd_transition_stats_get_stats,
+    .reset = pd_transition_stats_reset,
+};
+#endif
+
 /*
  * Framework handlers
  */
@@ -1166,6 +1818,19 @@ static int pd_init(fwk_id_t module_id, unsigned int dev_count, const void *data)
     mod_pd_ctx.pd_count = dev_count;
     mod_pd_ctx.system_pd_ctx = &mod_pd_ctx.pd_ctx_table[dev_count - 1];
 
+#ifdef BUILD_HAS_POWER_DOMAIN_BATCH_TRANSITIONS
+    mod_pd_ctx.batch.entries =
+        fwk_mm_calloc(dev_count, sizeof(struct mod_pd_set_state_batch_entry));
+#endif
+
+#ifdef BUILD_HAS_POWER_DOMAIN_TRANSITION_STATS
+    if (mod_pd_ctx.config->transition_stats_count != 0) {
+        mod_pd_ctx.transition_stats_table = fwk_mm_calloc(
+            mod_pd_ctx.config->transition_stats_count,
+            sizeof(struct mod_pd_transition_stats));
+    }
+#endif
+
     return FWK_SUCCESS;
 }
 
@@ -1236,6 +1901,10 @@ static int pd_post_init(fwk_id_t module_id)
         return status;
     }
 
+#ifdef BUILD_HAS_POWER_DOMAIN_STATE_TABLES
+    build_composite_state_tables();
+#endif
+
     return FWK_SUCCESS;
 }
 
@@ -1383,6 +2052,15 @@ static int pd_process_bind_request(
         *api = &pd_driver_input_api;
         break;
 
+#ifdef BUILD_HAS_POWER_DOMAIN_TRANSITION_STATS
+    case MOD_PD_API_IDX_TRANSITION_STATS:
+        if (!fwk_id_is_type(target_id, FWK_ID_TYPE_MODULE)) {
+            return FWK_E_ACCESS;
+        }
+        *api = &pd_transition_stats_api;
+        break;
+#endif
+
     default:
         return FWK_E_PARAM;
     }
@@ -1408,6 +2086,13 @@ static int pd_process_event(
 
         return FWK_SUCCESS;
 
+#ifdef BUILD_HAS_POWER_DOMAIN_BATCH_TRANSITIONS
+    case (unsigned int)MOD_PD_PUBLIC_EVENT_IDX_SET_STATE_BATCH:
+        process_set_state_batch_request(event, resp);
+
+        return FWK_SUCCESS;
+#endif
+
     case (unsigned int)PD_EVENT_IDX_RESET:
         fwk_assert(pd != NULL);
 
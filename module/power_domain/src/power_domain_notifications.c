@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2023-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -91,6 +91,8 @@ int process_power_state_pre_transition_notification_response(
     struct pd_ctx *pd,
     struct mod_pd_power_state_pre_transition_notification_resp_params *params)
 {
+    int status = FWK_SUCCESS;
+
     if (pd->power_state_pre_transition_notification_ctx.pending_responses ==
         0) {
         fwk_unexpected();
@@ -108,6 +110,10 @@ int process_power_state_pre_transition_notification_response(
         return FWK_SUCCESS;
     }
 
+#ifdef BUILD_HAS_POWER_DOMAIN_TRANSITION_STATS
+    record_notification_latency(pd);
+#endif
+
     if (pd->power_state_pre_transition_notification_ctx.valid == true) {
         /*
          * All the notification responses have been received, the requested
@@ -117,8 +123,19 @@ int process_power_state_pre_transition_notification_response(
          */
         if (pd->power_state_pre_transition_notification_ctx.response_status ==
             FWK_SUCCESS) {
-            return initiate_power_state_transition(pd);
+            status = initiate_power_state_transition(pd);
+        }
+
+#ifdef BUILD_HAS_POWER_DOMAIN_BATCH_TRANSITIONS
+        /* A notified entity refused the power state transition */
+        if (pd->power_state_pre_transition_notification_ctx.response_status !=
+            FWK_SUCCESS) {
+            complete_batch_pd(
+                pd,
+                pd->power_state_pre_transition_notification_ctx
+                    .response_status);
         }
+#endif
     } else {
         /*
          * All the notification responses have been received but the
@@ -131,11 +148,17 @@ int process_power_state_pre_transition_notification_response(
         }
 
         if (!initiate_power_state_pre_transition_notification(pd)) {
-            return initiate_power_state_transition(pd);
+            status = initiate_power_state_transition(pd);
         }
     }
 
-    return FWK_SUCCESS;
+#ifdef BUILD_HAS_POWER_DOMAIN_BATCH_TRANSITIONS
+    if (status != FWK_SUCCESS) {
+        complete_batch_pd(pd, status);
+    }
+#endif
+
+    return status;
 }
 
 int process_power_state_transition_notification_response(struct pd_ctx *pd)
@@ -227,6 +250,9 @@ bool initiate_power_state_pre_transition_notification(struct pd_ctx *pd)
     params->target_state = state;
 
     notification_event.source_id = pd->id;
+#ifdef BUILD_HAS_POWER_DOMAIN_TRANSITION_STATS
+    pd->transition_stats.notification_start = fwk_time_current();
+#endif
     status = fwk_notification_notify(
         &notification_event,
         &pd->power_state_pre_transition_notification_ctx.pending_responses);
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2023-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2023-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -201,6 +201,16 @@ bool is_valid_composite_state(
         goto error;
     }
 
+#ifdef BUILD_HAS_POWER_DOMAIN_STATE_TABLES
+    if (pd->cs_table != NULL) {
+        if (find_composite_state(pd, composite_state) == NULL) {
+            goto error;
+        }
+
+        return true;
+    }
+#endif
+
     highest_level = (unsigned int)get_highest_level_from_composite_state(
         pd, composite_state);
 
@@ -243,6 +253,53 @@ error:
     return false;
 }
 
+#ifdef BUILD_HAS_POWER_DOMAIN_STATE_TABLES
+const struct pd_composite_state_entry *find_composite_state(
+    const struct pd_ctx *pd,
+    uint32_t composite_state)
+{
+    unsigned int level, highest_level, first, last, middle;
+    uint32_t relevant_mask;
+    const struct pd_composite_state_entry *entry;
+
+    if (pd->cs_table == NULL) {
+        return NULL;
+    }
+
+    highest_level = (unsigned int)get_highest_level_from_composite_state(
+        pd, composite_state);
+    if (highest_level >= pd->composite_state_mask_table_size) {
+        return NULL;
+    }
+
+    /* The state bits of the levels above the highest one are ignored */
+    relevant_mask = pd->composite_state_levels_mask;
+    for (level = 0; level <= highest_level; level++) {
+        relevant_mask |= pd->composite_state_mask_table[level];
+    }
+    composite_state &= relevant_mask;
+
+    first = 0;
+    last = pd->cs_table_size;
+    while (first < last) {
+        middle = first + ((last - first) / 2U);
+        entry = &pd->cs_table[middle];
+
+        if (entry->composite_state == composite_state) {
+            return entry;
+        }
+
+        if (entry->composite_state < composite_state) {
+            first = middle + 1U;
+        } else {
+            last = middle;
+        }
+    }
+
+    return NULL;
+}
+#endif
+
 bool is_upwards_transition_propagation(
     const struct pd_ctx *lowest_pd,
     uint32_t composite_state)
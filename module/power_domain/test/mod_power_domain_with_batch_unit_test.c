@@ -0,0 +1,453 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_core.h>
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+#include <Mockfwk_notification.h>
+#include <internal/Mockfwk_core_internal.h>
+
+#include <fwk_id.h>
+#include <fwk_macros.h>
+
+#include UNIT_TEST_SRC
+#include <config_power_domain.h>
+
+#define BATCH_COOKIE 42
+
+/* Cluster 0 and the requesting core in the same state */
+#define CLUSTER_CORE_STATE(STATE) \
+    MOD_PD_COMPOSITE_STATE(MOD_PD_LEVEL_1, 0, 0, STATE, STATE)
+
+/* The requesting core alone */
+#define CORE_STATE(STATE) MOD_PD_COMPOSITE_STATE(MOD_PD_LEVEL_0, 0, 0, 0, STATE)
+
+static struct pd_ctx pd_ctx[PD_IDX_COUNT];
+
+static unsigned int driver_calls[PD_IDX_COUNT];
+static unsigned int driver_call_count;
+static unsigned int driver_failing_idx;
+static unsigned int notified_entity_count;
+
+static bool batch_response_sent;
+static int batch_response_status;
+
+static int pd_driver_set_state(fwk_id_t dev_id, unsigned int state)
+{
+    TEST_ASSERT_LESS_THAN(PD_IDX_COUNT, driver_call_count);
+
+    driver_calls[driver_call_count++] = fwk_id_get_element_idx(dev_id);
+
+    if (fwk_id_get_element_idx(dev_id) == driver_failing_idx) {
+        return FWK_E_DEVICE;
+    }
+
+    return FWK_SUCCESS;
+}
+
+static struct mod_pd_driver_api pd_driver = {
+    .set_state = pd_driver_set_state,
+};
+
+static int put_event_callback(struct fwk_event *event, int NumCalls)
+{
+    struct pd_set_state_batch_response *resp_params =
+        (struct pd_set_state_batch_response *)event->params;
+
+    batch_response_sent = true;
+    batch_response_status = resp_params->status;
+
+    return FWK_SUCCESS;
+}
+
+static int notify_callback(
+    struct fwk_event *event,
+    unsigned int *count,
+    int NumCalls)
+{
+    *count = notified_entity_count;
+
+    return FWK_SUCCESS;
+}
+
+static void set_pd_state(enum pd_idx pd_idx, unsigned int state)
+{
+    pd_ctx[pd_idx].requested_state = state;
+    pd_ctx[pd_idx].state_requested_to_driver = state;
+    pd_ctx[pd_idx].current_state = state;
+    pd_ctx[pd_idx].driver_state = state;
+}
+
+static void report(enum pd_idx pd_idx, unsigned int state)
+{
+    struct pd_power_state_transition_report report_params = {
+        .state = state,
+    };
+
+    process_power_state_transition_report(&pd_ctx[pd_idx], &report_params);
+}
+
+/* Submit and process a batch requesting a response */
+static void run_batch(
+    const struct mod_pd_set_state_batch_entry *entries,
+    unsigned int count,
+    struct fwk_event *resp)
+{
+    int status;
+    struct fwk_event req = {
+        .id = FWK_ID_EVENT_INIT(
+            FWK_MODULE_IDX_POWER_DOMAIN,
+            MOD_PD_PUBLIC_EVENT_IDX_SET_STATE_BATCH),
+        .target_id = fwk_module_id_power_domain,
+        .response_requested = true,
+        .cookie = BATCH_COOKIE,
+    };
+
+    __fwk_put_event_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+
+    status = pd_set_state_batch(entries, count, true);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_TRUE(mod_pd_ctx.batch.ongoing);
+
+    resp->cookie = BATCH_COOKIE;
+    status = pd_process_event(&req, resp);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+static void expect_batch_response(void)
+{
+    fwk_get_delayed_response_ExpectAndReturn(
+        fwk_module_id_power_domain, BATCH_COOKIE, NULL, FWK_SUCCESS);
+    fwk_get_delayed_response_IgnoreArg_event();
+    __fwk_put_event_StubWithCallback(put_event_callback);
+}
+
+void setUp(void)
+{
+    static struct mod_pd_set_state_batch_entry
+        batch_entries[PD_IDX_COUNT];
+    unsigned int i, state;
+    const struct mod_power_domain_element_config *config;
+
+    memset(pd_ctx, 0, sizeof(pd_ctx));
+    memset(&mod_pd_ctx, 0, sizeof(mod_pd_ctx));
+
+    mod_pd_ctx.config = &mod_pd_config;
+    mod_pd_ctx.pd_ctx_table = pd_ctx;
+    mod_pd_ctx.pd_count = PD_IDX_COUNT;
+    mod_pd_ctx.system_pd_ctx = &pd_ctx[PD_IDX_SYSTOP];
+    mod_pd_ctx.batch.entries = batch_entries;
+
+    for (i = 0; i < PD_IDX_COUNT; i++) {
+        pd_ctx[i] = pd_ctx_config[i];
+        pd_ctx[i].driver_api = &pd_driver;
+        pd_ctx[i].driver_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_DOMAIN, i);
+        fwk_list_init(&pd_ctx[i].children_list);
+
+        for (state = 0; state < pd_ctx[i].allowed_state_mask_table_size;
+             state++) {
+            pd_ctx[i].valid_state_mask |=
+                pd_ctx[i].allowed_state_mask_table[state];
+        }
+    }
+
+    for (i = 0; i < PD_IDX_COUNT; i++) {
+        config = pd_element_table[i].data;
+        if (config->parent_idx < PD_IDX_COUNT) {
+            pd_ctx[i].parent = &pd_ctx[config->parent_idx];
+            fwk_list_push_tail(
+                &pd_ctx[config->parent_idx].children_list,
+                &pd_ctx[i].child_node);
+        }
+    }
+
+    driver_call_count = 0;
+    driver_failing_idx = PD_IDX_COUNT;
+    notified_entity_count = 0;
+    batch_response_sent = false;
+    batch_response_status = FWK_E_STATE;
+
+    fwk_module_is_valid_element_id_IgnoreAndReturn(true);
+    fwk_module_get_element_name_IgnoreAndReturn("PD");
+    fwk_notification_notify_StubWithCallback(notify_callback);
+}
+
+void tearDown(void)
+{
+    __fwk_put_event_Stub(NULL);
+    fwk_notification_notify_Stub(NULL);
+    Mockfwk_core_Destroy();
+    Mockfwk_module_Destroy();
+    Mockfwk_notification_Destroy();
+}
+
+void test_set_state_batch_cluster_on(void)
+{
+    struct fwk_event resp = { 0 };
+    struct mod_pd_set_state_batch_entry entries[] = {
+        { pd_ctx[PD_IDX_CLUS0CORE0].id, CLUSTER_CORE_STATE(MOD_PD_STATE_ON) },
+        { pd_ctx[PD_IDX_CLUS0CORE1].id, CLUSTER_CORE_STATE(MOD_PD_STATE_ON) },
+    };
+
+    run_batch(entries, FWK_ARRAY_SIZE(entries), &resp);
+
+    /* Only the cluster can be turned on before its cores */
+    TEST_ASSERT_EQUAL(1, driver_call_count);
+    TEST_ASSERT_EQUAL(PD_IDX_CLUSTER0, driver_calls[0]);
+    TEST_ASSERT_TRUE(resp.is_delayed_response);
+    TEST_ASSERT_EQUAL(3, mod_pd_ctx.batch.pending_count);
+
+    /* Both cores are turned on when the cluster is on */
+    report(PD_IDX_CLUSTER0, MOD_PD_STATE_ON);
+    TEST_ASSERT_EQUAL(3, driver_call_count);
+    TEST_ASSERT_EQUAL(PD_IDX_CLUS0CORE0, driver_calls[1]);
+    TEST_ASSERT_EQUAL(PD_IDX_CLUS0CORE1, driver_calls[2]);
+
+    report(PD_IDX_CLUS0CORE0, MOD_PD_STATE_ON);
+    TEST_ASSERT_FALSE(batch_response_sent);
+
+    /* A single response is sent once the whole batch is completed */
+    expect_batch_response();
+    report(PD_IDX_CLUS0CORE1, MOD_PD_STATE_ON);
+    TEST_ASSERT_TRUE(batch_response_sent);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, batch_response_status);
+    TEST_ASSERT_FALSE(mod_pd_ctx.batch.ongoing);
+}
+
+void test_set_state_batch_cluster_off(void)
+{
+    struct fwk_event resp = { 0 };
+    struct mod_pd_set_state_batch_entry entries[] = {
+        { pd_ctx[PD_IDX_CLUS0CORE0].id, CLUSTER_CORE_STATE(MOD_PD_STATE_OFF) },
+        { pd_ctx[PD_IDX_CLUS0CORE1].id, CLUSTER_CORE_STATE(MOD_PD_STATE_OFF) },
+    };
+
+    set_pd_state(PD_IDX_CLUSTER0, MOD_PD_STATE_ON);
+    set_pd_state(PD_IDX_CLUS0CORE0, MOD_PD_STATE_ON);
+    set_pd_state(PD_IDX_CLUS0CORE1, MOD_PD_STATE_ON);
+
+    run_batch(entries, FWK_ARRAY_SIZE(entries), &resp);
+
+    /* Both cores are turned off together, the cluster waits for them */
+    TEST_ASSERT_EQUAL(2, driver_call_count);
+    TEST_ASSERT_EQUAL(PD_IDX_CLUS0CORE0, driver_calls[0]);
+    TEST_ASSERT_EQUAL(PD_IDX_CLUS0CORE1, driver_calls[1]);
+    TEST_ASSERT_EQUAL(
+        MOD_PD_STATE_OFF, pd_ctx[PD_IDX_CLUSTER0].requested_state);
+
+    report(PD_IDX_CLUS0CORE0, MOD_PD_STATE_OFF);
+    TEST_ASSERT_EQUAL(2, driver_call_count);
+
+    report(PD_IDX_CLUS0CORE1, MOD_PD_STATE_OFF);
+    TEST_ASSERT_EQUAL(3, driver_call_count);
+    TEST_ASSERT_EQUAL(PD_IDX_CLUSTER0, driver_calls[2]);
+
+    expect_batch_response();
+    report(PD_IDX_CLUSTER0, MOD_PD_STATE_OFF);
+    TEST_ASSERT_TRUE(batch_response_sent);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, batch_response_status);
+}
+
+/*
+ * Test that a request blocked by the children of its power domain is applied
+ * again once the other requests of the batch have been applied
+ */
+void test_set_state_batch_blocked_by_children(void)
+{
+    struct fwk_event resp = { 0 };
+    struct mod_pd_set_state_batch_entry entries[] = {
+        { pd_ctx[PD_IDX_CLUSTER0].id, MOD_PD_STATE_OFF },
+        { pd_ctx[PD_IDX_CLUS0CORE0].id, CORE_STATE(MOD_PD_STATE_OFF) },
+        { pd_ctx[PD_IDX_CLUS0CORE1].id, CORE_STATE(MOD_PD_STATE_OFF) },
+    };
+
+    set_pd_state(PD_IDX_CLUSTER0, MOD_PD_STATE_ON);
+    set_pd_state(PD_IDX_CLUS0CORE0, MOD_PD_STATE_ON);
+    set_pd_state(PD_IDX_CLUS0CORE1, MOD_PD_STATE_ON);
+
+    run_batch(entries, FWK_ARRAY_SIZE(entries), &resp);
+
+    TEST_ASSERT_EQUAL(
+        MOD_PD_STATE_OFF, pd_ctx[PD_IDX_CLUSTER0].requested_state);
+    TEST_ASSERT_EQUAL(3, mod_pd_ctx.batch.pending_count);
+    TEST_ASSERT_EQUAL(2, driver_call_count);
+
+    report(PD_IDX_CLUS0CORE0, MOD_PD_STATE_OFF);
+    report(PD_IDX_CLUS0CORE1, MOD_PD_STATE_OFF);
+    TEST_ASSERT_EQUAL(3, driver_call_count);
+    TEST_ASSERT_EQUAL(PD_IDX_CLUSTER0, driver_calls[2]);
+
+    expect_batch_response();
+    report(PD_IDX_CLUSTER0, MOD_PD_STATE_OFF);
+    TEST_ASSERT_TRUE(batch_response_sent);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, batch_response_status);
+}
+
+/* Test that a request which stays blocked by the children fails the batch */
+void test_set_state_batch_blocked_fails(void)
+{
+    struct fwk_event resp = { 0 };
+    struct mod_pd_set_state_batch_entry entries[] = {
+        { pd_ctx[PD_IDX_CLUSTER0].id, MOD_PD_STATE_OFF },
+        { pd_ctx[PD_IDX_CLUS0CORE0].id, CORE_STATE(MOD_PD_STATE_OFF) },
+    };
+
+    set_pd_state(PD_IDX_CLUSTER0, MOD_PD_STATE_ON);
+    set_pd_state(PD_IDX_CLUS0CORE0, MOD_PD_STATE_ON);
+    set_pd_state(PD_IDX_CLUS0CORE1, MOD_PD_STATE_ON);
+
+    run_batch(entries, FWK_ARRAY_SIZE(entries), &resp);
+
+    /* The other core keeps the cluster on */
+    TEST_ASSERT_EQUAL(MOD_PD_STATE_ON, pd_ctx[PD_IDX_CLUSTER0].requested_state);
+    TEST_ASSERT_EQUAL(1, driver_call_count);
+    TEST_ASSERT_EQUAL(PD_IDX_CLUS0CORE0, driver_calls[0]);
+
+    expect_batch_response();
+    report(PD_IDX_CLUS0CORE0, MOD_PD_STATE_OFF);
+    TEST_ASSERT_TRUE(batch_response_sent);
+    TEST_ASSERT_EQUAL(FWK_E_PWRSTATE, batch_response_status);
+}
+
+/*
+ * Test that the failure of a transition initiated on the report of another
+ * power domain ends the wait of the batch for it
+ */
+void test_set_state_batch_chained_failure(void)
+{
+    struct fwk_event resp = { 0 };
+    struct mod_pd_set_state_batch_entry entries[] = {
+        { pd_ctx[PD_IDX_CLUS0CORE0].id, CLUSTER_CORE_STATE(MOD_PD_STATE_ON) },
+        { pd_ctx[PD_IDX_CLUS0CORE1].id, CLUSTER_CORE_STATE(MOD_PD_STATE_ON) },
+    };
+
+    driver_failing_idx = PD_IDX_CLUS0CORE1;
+
+    run_batch(entries, FWK_ARRAY_SIZE(entries), &resp);
+
+    report(PD_IDX_CLUSTER0, MOD_PD_STATE_ON);
+    TEST_ASSERT_EQUAL(3, driver_call_count);
+    TEST_ASSERT_EQUAL(1, mod_pd_ctx.batch.pending_count);
+
+    expect_batch_response();
+    report(PD_IDX_CLUS0CORE0, MOD_PD_STATE_ON);
+    TEST_ASSERT_TRUE(batch_response_sent);
+    TEST_ASSERT_EQUAL(FWK_E_DEVICE, batch_response_status);
+}
+
+/* Test that a refused pre-transition notification ends the batch in error */
+void test_set_state_batch_notification_refused(void)
+{
+    int status;
+    struct fwk_event resp = { 0 };
+    struct mod_pd_set_state_batch_entry entries[] = {
+        { pd_ctx[PD_IDX_CLUSTER1].id, MOD_PD_STATE_ON },
+    };
+    struct mod_pd_power_state_pre_transition_notification_resp_params
+        notification_resp = { .status = FWK_E_DEVICE };
+
+    notified_entity_count = 1;
+
+    run_batch(entries, FWK_ARRAY_SIZE(entries), &resp);
+
+    /* The transition waits for the notification response */
+    TEST_ASSERT_EQUAL(0, driver_call_count);
+    TEST_ASSERT_TRUE(resp.is_delayed_response);
+
+    expect_batch_response();
+    status = process_power_state_pre_transition_notification_response(
+        &pd_ctx[PD_IDX_CLUSTER1], &notification_resp);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(0, driver_call_count);
+    TEST_ASSERT_TRUE(batch_response_sent);
+    TEST_ASSERT_EQUAL(FWK_E_DEVICE, batch_response_status);
+    TEST_ASSERT_FALSE(mod_pd_ctx.batch.ongoing);
+}
+
+void test_set_state_batch_overwritten(void)
+{
+    struct fwk_event resp = { 0 };
+    struct mod_pd_set_state_batch_entry entries[] = {
+        { pd_ctx[PD_IDX_CLUSTER1].id, MOD_PD_STATE_ON },
+    };
+    struct fwk_event req = {
+        .id = FWK_ID_EVENT_INIT(
+            FWK_MODULE_IDX_POWER_DOMAIN,
+            MOD_PD_PUBLIC_EVENT_IDX_SET_STATE),
+        .target_id = pd_ctx[PD_IDX_CLUSTER1].id,
+    };
+    struct pd_set_state_request *req_params =
+        (struct pd_set_state_request *)req.params;
+
+    run_batch(entries, FWK_ARRAY_SIZE(entries), &resp);
+
+    /* A later request on the same power domain ends the batch in error */
+    req_params->composite_state = MOD_PD_STATE_OFF;
+    expect_batch_response();
+    process_set_state_request(&pd_ctx[PD_IDX_CLUSTER1], &req, &resp);
+
+    TEST_ASSERT_TRUE(batch_response_sent);
+    TEST_ASSERT_EQUAL(FWK_E_OVERWRITTEN, batch_response_status);
+}
+
+void test_set_state_batch_busy(void)
+{
+    int status;
+    struct fwk_event resp = { 0 };
+    struct mod_pd_set_state_batch_entry entries[] = {
+        { pd_ctx[PD_IDX_CLUSTER1].id, MOD_PD_STATE_ON },
+    };
+
+    run_batch(entries, FWK_ARRAY_SIZE(entries), &resp);
+
+    status = pd_set_state_batch(entries, FWK_ARRAY_SIZE(entries), false);
+    TEST_ASSERT_EQUAL(FWK_E_BUSY, status);
+}
+
+void test_set_state_batch_invalid_state(void)
+{
+    int status;
+    struct mod_pd_set_state_batch_entry entries[] = {
+        { pd_ctx[PD_IDX_CLUSTER1].id, MOD_PD_STATE_ON },
+        { pd_ctx[PD_IDX_CLUSTER0].id, MOD_PD_STATE_SLEEP },
+    };
+
+    status = pd_set_state_batch(entries, FWK_ARRAY_SIZE(entries), false);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    status = pd_set_state_batch(entries, 0, false);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    TEST_ASSERT_FALSE(mod_pd_ctx.batch.ongoing);
+}
+
+int power_domain_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_set_state_batch_cluster_on);
+    RUN_TEST(test_set_state_batch_cluster_off);
+    RUN_TEST(test_set_state_batch_blocked_by_children);
+    RUN_TEST(test_set_state_batch_blocked_fails);
+    RUN_TEST(test_set_state_batch_chained_failure);
+    RUN_TEST(test_set_state_batch_notification_refused);
+    RUN_TEST(test_set_state_batch_overwritten);
+    RUN_TEST(test_set_state_batch_busy);
+    RUN_TEST(test_set_state_batch_invalid_state);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return power_domain_test_main();
+}
+#endif
@@ -0,0 +1,217 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_core.h>
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+#include <internal/Mockfwk_core_internal.h>
+
+#include <fwk_id.h>
+#include <fwk_macros.h>
+
+#include <stdlib.h>
+
+#include UNIT_TEST_SRC
+#include <config_power_domain.h>
+
+/*
+ * Number of valid composite states of a core: 6 core states alone, and 8
+ * combinations of core and cluster states, alone or with the system ON.
+ */
+#define CORE_CS_COUNT (6 + 8 + 8)
+
+static struct pd_ctx pd_ctx[PD_IDX_COUNT];
+
+static unsigned int driver_calls[PD_IDX_COUNT];
+static unsigned int driver_call_count;
+
+static int pd_driver_set_state(fwk_id_t dev_id, unsigned int state)
+{
+    TEST_ASSERT_LESS_THAN(PD_IDX_COUNT, driver_call_count);
+
+    driver_calls[driver_call_count++] = fwk_id_get_element_idx(dev_id);
+
+    return FWK_SUCCESS;
+}
+
+static struct mod_pd_driver_api pd_driver = {
+    .set_state = pd_driver_set_state,
+};
+
+static void *calloc_callback(size_t num, size_t size, int NumCalls)
+{
+    return calloc(num, size);
+}
+
+void setUp(void)
+{
+    unsigned int i, state;
+    int status;
+
+    memset(pd_ctx, 0, sizeof(pd_ctx));
+    memset(&mod_pd_ctx, 0, sizeof(mod_pd_ctx));
+
+    mod_pd_ctx.config = &mod_pd_config;
+    mod_pd_ctx.pd_ctx_table = pd_ctx;
+    mod_pd_ctx.pd_count = PD_IDX_COUNT;
+    mod_pd_ctx.system_pd_ctx = &pd_ctx[PD_IDX_SYSTOP];
+
+    for (i = 0; i < PD_IDX_COUNT; i++) {
+        pd_ctx[i] = pd_ctx_config[i];
+        pd_ctx[i].driver_api = &pd_driver;
+        pd_ctx[i].driver_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_DOMAIN, i);
+        fwk_list_init(&pd_ctx[i].children_list);
+
+        /* As set by pd_init() for the cores */
+        if (pd_ctx[i].cs_support) {
+            pd_ctx[i].composite_state_levels_mask = MOD_PD_CS_STATE_MASK
+                << MOD_PD_CS_LEVEL_SHIFT;
+        }
+
+        for (state = 0; state < pd_ctx[i].allowed_state_mask_table_size;
+             state++) {
+            pd_ctx[i].valid_state_mask |=
+                pd_ctx[i].allowed_state_mask_table[state];
+        }
+    }
+
+    driver_call_count = 0;
+
+    fwk_mm_calloc_StubWithCallback(calloc_callback);
+    fwk_module_get_element_name_IgnoreAndReturn("PD");
+
+    status = pd_post_init(fwk_module_id_power_domain);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+void tearDown(void)
+{
+    unsigned int i;
+
+    for (i = 0; i < PD_IDX_COUNT; i++) {
+        free(pd_ctx[i].cs_table);
+    }
+
+    fwk_mm_calloc_Stub(NULL);
+    Mockfwk_mm_Destroy();
+    Mockfwk_module_Destroy();
+}
+
+void test_state_tables_built(void)
+{
+    unsigned int i, idx;
+    const struct pd_ctx *core = &pd_ctx[PD_IDX_CLUS1CORE1];
+
+    TEST_ASSERT_NOT_NULL(core->cs_table);
+    TEST_ASSERT_EQUAL(CORE_CS_COUNT, core->cs_table_size);
+
+    for (idx = 1; idx < core->cs_table_size; idx++) {
+        TEST_ASSERT_LESS_THAN(
+            core->cs_table[idx].composite_state,
+            core->cs_table[idx - 1].composite_state);
+    }
+
+    /* No table for the power domains without composite state support */
+    for (i = PD_IDX_CLUSTER0; i < PD_IDX_COUNT; i++) {
+        TEST_ASSERT_NULL(pd_ctx[i].cs_table);
+    }
+}
+
+void test_state_tables_lookup(void)
+{
+    const struct pd_composite_state_entry *entry;
+    uint32_t composite_state = MOD_PD_COMPOSITE_STATE(
+        MOD_PD_LEVEL_1, 0, 0, MOD_PD_STATE_ON, MOD_PD_STATE_OFF_1);
+
+    entry = find_composite_state(&pd_ctx[PD_IDX_CLUS0CORE0], composite_state);
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_EQUAL(MOD_PD_LEVEL_1, entry->highest_level);
+    TEST_ASSERT_EQUAL(MOD_PD_STATE_OFF_1, entry->level_state[0]);
+    TEST_ASSERT_EQUAL(MOD_PD_STATE_ON, entry->level_state[1]);
+
+    /* The states of the levels above the highest one are ignored */
+    entry = find_composite_state(
+        &pd_ctx[PD_IDX_CLUS0CORE0],
+        composite_state |
+            (MOD_PD_STATE_SLEEP << MOD_PD_CS_LEVEL_3_STATE_SHIFT));
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_EQUAL(composite_state, entry->composite_state);
+
+    /* A core cannot be on with its cluster off */
+    composite_state = MOD_PD_COMPOSITE_STATE(
+        MOD_PD_LEVEL_1, 0, 0, MOD_PD_STATE_OFF, MOD_PD_STATE_ON);
+    entry = find_composite_state(&pd_ctx[PD_IDX_CLUS0CORE0], composite_state);
+    TEST_ASSERT_NULL(entry);
+}
+
+void test_state_tables_match_runtime_checks(void)
+{
+    struct pd_ctx *core = &pd_ctx[PD_IDX_CLUS0CORE1];
+    struct pd_composite_state_entry *cs_table = core->cs_table;
+    uint32_t level, states, composite_state;
+    bool expected, valid;
+
+    for (level = 0; level < MOD_PD_LEVEL_COUNT; level++) {
+        for (states = 0; states < (1U << MOD_PD_CS_LEVEL_SHIFT); states++) {
+            composite_state = (level << MOD_PD_CS_LEVEL_SHIFT) | states;
+
+            core->cs_table = NULL;
+            expected = is_valid_composite_state(core, composite_state);
+
+            core->cs_table = cs_table;
+            valid = is_valid_composite_state(core, composite_state);
+
+            TEST_ASSERT_EQUAL(expected, valid);
+        }
+    }
+}
+
+void test_state_tables_set_state(void)
+{
+    struct fwk_event req = {
+        .id = FWK_ID_EVENT_INIT(
+            FWK_MODULE_IDX_POWER_DOMAIN,
+            MOD_PD_PUBLIC_EVENT_IDX_SET_STATE),
+        .target_id = pd_ctx[PD_IDX_CLUS1CORE0].id,
+    };
+    struct fwk_event resp = { 0 };
+    struct pd_set_state_request *req_params =
+        (struct pd_set_state_request *)req.params;
+
+    req_params->composite_state = MOD_PD_COMPOSITE_STATE(
+        MOD_PD_LEVEL_1, 0, 0, MOD_PD_STATE_ON, MOD_PD_STATE_ON);
+
+    process_set_state_request(&pd_ctx[PD_IDX_CLUS1CORE0], &req, &resp);
+
+    TEST_ASSERT_EQUAL(MOD_PD_STATE_ON, pd_ctx[PD_IDX_CLUSTER1].requested_state);
+    TEST_ASSERT_EQUAL(
+        MOD_PD_STATE_ON, pd_ctx[PD_IDX_CLUS1CORE0].requested_state);
+    TEST_ASSERT_EQUAL(1, driver_call_count);
+    TEST_ASSERT_EQUAL(PD_IDX_CLUSTER1, driver_calls[0]);
+}
+
+int power_domain_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_state_tables_built);
+    RUN_TEST(test_state_tables_lookup);
+    RUN_TEST(test_state_tables_match_runtime_checks);
+    RUN_TEST(test_state_tables_set_state);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return power_domain_test_main();
+}
+#endif
@@ -0,0 +1,312 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_core.h>
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+#include <Mockfwk_time.h>
+#include <internal/Mockfwk_core_internal.h>
+
+#include <fwk_id.h>
+#include <fwk_macros.h>
+
+#include UNIT_TEST_SRC
+#include <config_power_domain.h>
+
+#define TRANSITION_STATS_COUNT 2
+
+/* Timestamps are expressed in nanoseconds */
+#define US(TIME) ((fwk_timestamp_t)(TIME) * 1000)
+
+static struct pd_ctx pd_ctx[PD_IDX_COUNT];
+static struct mod_pd_transition_stats stats_table[TRANSITION_STATS_COUNT];
+static struct mod_power_domain_config pd_config;
+
+static fwk_timestamp_t now;
+static struct pd_power_state_transition_report last_report;
+
+static int pd_driver_set_state(fwk_id_t dev_id, unsigned int state)
+{
+    return FWK_SUCCESS;
+}
+
+static struct mod_pd_driver_api pd_driver = {
+    .set_state = pd_driver_set_state,
+};
+
+static fwk_timestamp_t time_current_callback(int NumCalls)
+{
+    return now;
+}
+
+static fwk_duration_ns_t time_elapsed_callback(
+    fwk_timestamp_t start,
+    fwk_timestamp_t end,
+    int NumCalls)
+{
+    return (end > start) ? end - start : 0;
+}
+
+static fwk_duration_us_t time_duration_us_callback(
+    fwk_duration_ns_t duration,
+    int NumCalls)
+{
+    return duration / 1000;
+}
+
+static int put_event_callback(struct fwk_event *event, int NumCalls)
+{
+    last_report = *(struct pd_power_state_transition_report *)event->params;
+
+    return FWK_SUCCESS;
+}
+
+/* Turn a power domain from its current state to a new one */
+static void transition(
+    enum pd_idx pd_idx,
+    unsigned int state,
+    fwk_timestamp_t start,
+    fwk_timestamp_t end)
+{
+    int status;
+    struct pd_ctx *pd = &pd_ctx[pd_idx];
+
+    pd->requested_state = state;
+
+    now = start;
+    status = initiate_power_state_transition(pd);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    now = end;
+    status = pd_report_power_state_transition(pd->id, state);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(end, last_report.timestamp);
+
+    /* The report event is processed later on */
+    now = end + US(1000);
+    process_power_state_transition_report(pd, &last_report);
+}
+
+static struct mod_pd_transition_stats get_stats(unsigned int index)
+{
+    int status;
+    struct mod_pd_transition_stats stats;
+
+    status = pd_transition_stats_get_stats(index, &stats);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    return stats;
+}
+
+void setUp(void)
+{
+    unsigned int i, state;
+
+    memset(pd_ctx, 0, sizeof(pd_ctx));
+    memset(&mod_pd_ctx, 0, sizeof(mod_pd_ctx));
+
+    pd_config = mod_pd_config;
+    pd_config.transition_stats_count = TRANSITION_STATS_COUNT;
+
+    mod_pd_ctx.config = &pd_config;
+    mod_pd_ctx.pd_ctx_table = pd_ctx;
+    mod_pd_ctx.pd_count = PD_IDX_COUNT;
+    mod_pd_ctx.system_pd_ctx = &pd_ctx[PD_IDX_SYSTOP];
+    mod_pd_ctx.transition_stats_table = stats_table;
+
+    for (i = 0; i < PD_IDX_COUNT; i++) {
+        pd_ctx[i] = pd_ctx_config[i];
+        pd_ctx[i].driver_api = &pd_driver;
+        pd_ctx[i].driver_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_DOMAIN, i);
+        fwk_list_init(&pd_ctx[i].children_list);
+
+        for (state = 0; state < pd_ctx[i].allowed_state_mask_table_size;
+             state++) {
+            pd_ctx[i].valid_state_mask |=
+                pd_ctx[i].allowed_state_mask_table[state];
+        }
+    }
+
+    now = 0;
+
+    fwk_time_current_StubWithCallback(time_current_callback);
+    fwk_time_elapsed_StubWithCallback(time_elapsed_callback);
+    fwk_time_duration_us_StubWithCallback(time_duration_us_callback);
+    fwk_time_stamp_duration_IgnoreAndReturn(0);
+    fwk_time_duration_ms_IgnoreAndReturn(0);
+    fwk_time_duration_s_IgnoreAndReturn(0);
+    fwk_time_duration_m_IgnoreAndReturn(0);
+    fwk_time_duration_h_IgnoreAndReturn(0);
+    __fwk_put_event_StubWithCallback(put_event_callback);
+    fwk_module_get_element_name_IgnoreAndReturn("PD");
+}
+
+void tearDown(void)
+{
+    fwk_time_current_Stub(NULL);
+    fwk_time_elapsed_Stub(NULL);
+    fwk_time_duration_us_Stub(NULL);
+    __fwk_put_event_Stub(NULL);
+    Mockfwk_time_Destroy();
+    Mockfwk_core_Destroy();
+    Mockfwk_module_Destroy();
+}
+
+void test_transition_stats_record(void)
+{
+    int status;
+    unsigned int count;
+    struct mod_pd_transition_stats stats;
+
+    /* Measured from the driver request to the driver report */
+    transition(PD_IDX_CLUSTER1, MOD_PD_STATE_ON, US(100), US(110));
+    transition(PD_IDX_CLUSTER1, MOD_PD_STATE_OFF, US(200), US(300));
+    transition(PD_IDX_CLUSTER1, MOD_PD_STATE_ON, US(400), US(500));
+
+    status = pd_transition_stats_get_count(&count);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(2, count);
+
+    stats = get_stats(0);
+    TEST_ASSERT_TRUE(fwk_id_is_equal(pd_ctx[PD_IDX_CLUSTER1].id, stats.pd_id));
+    TEST_ASSERT_EQUAL(MOD_PD_STATE_OFF, stats.from_state);
+    TEST_ASSERT_EQUAL(MOD_PD_STATE_ON, stats.to_state);
+    TEST_ASSERT_EQUAL(2, stats.transition.count);
+    TEST_ASSERT_EQUAL(10, stats.transition.min_latency);
+    TEST_ASSERT_EQUAL(100, stats.transition.max_latency);
+    TEST_ASSERT_EQUAL(110, stats.transition.total_latency);
+    TEST_ASSERT_EQUAL(1, stats.transition.histogram[1]);
+    TEST_ASSERT_EQUAL(1, stats.transition.histogram[3]);
+    TEST_ASSERT_EQUAL(0, stats.notification.count);
+
+    stats = get_stats(1);
+    TEST_ASSERT_EQUAL(MOD_PD_STATE_ON, stats.from_state);
+    TEST_ASSERT_EQUAL(MOD_PD_STATE_OFF, stats.to_state);
+    TEST_ASSERT_EQUAL(1, stats.transition.count);
+    TEST_ASSERT_EQUAL(100, stats.transition.max_latency);
+}
+
+void test_transition_stats_table_full(void)
+{
+    unsigned int count;
+
+    transition(PD_IDX_CLUSTER0, MOD_PD_STATE_ON, US(0), US(10));
+    transition(PD_IDX_CLUSTER0, MOD_PD_STATE_OFF, US(20), US(30));
+
+    /* No entry is left for this transition */
+    transition(PD_IDX_CLUSTER1, MOD_PD_STATE_ON, US(40), US(50));
+    TEST_ASSERT_FALSE(
+        pd_ctx[PD_IDX_CLUSTER1].transition_stats.transition_pending);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, pd_transition_stats_get_count(&count));
+    TEST_ASSERT_EQUAL(2, count);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, pd_transition_stats_reset());
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, pd_transition_stats_get_count(&count));
+    TEST_ASSERT_EQUAL(0, count);
+
+    transition(PD_IDX_CLUSTER1, MOD_PD_STATE_OFF, US(60), US(70));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, pd_transition_stats_get_count(&count));
+    TEST_ASSERT_EQUAL(1, count);
+}
+
+void test_transition_stats_report_other_state(void)
+{
+    int status;
+    unsigned int count;
+    struct pd_ctx *pd = &pd_ctx[PD_IDX_CLUSTER1];
+
+    pd->requested_state = MOD_PD_STATE_ON;
+
+    now = US(100);
+    status = initiate_power_state_transition(pd);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* A report of another state does not complete the transition */
+    now = US(110);
+    status = pd_report_power_state_transition(pd->id, MOD_PD_STATE_SLEEP);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    process_power_state_transition_report(pd, &last_report);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, pd_transition_stats_get_count(&count));
+    TEST_ASSERT_EQUAL(0, count);
+    TEST_ASSERT_TRUE(pd->transition_stats.transition_pending);
+
+    now = US(150);
+    status = pd_report_power_state_transition(pd->id, MOD_PD_STATE_ON);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    process_power_state_transition_report(pd, &last_report);
+
+    TEST_ASSERT_EQUAL(1, get_stats(0).transition.count);
+    TEST_ASSERT_EQUAL(50, get_stats(0).transition.max_latency);
+}
+
+void test_transition_stats_notification(void)
+{
+    struct mod_pd_transition_stats stats;
+    struct pd_ctx *pd = &pd_ctx[PD_IDX_CLUSTER0];
+
+    pd->power_state_pre_transition_notification_ctx.state = MOD_PD_STATE_ON;
+    pd->transition_stats.notification_start = US(1000);
+
+    now = US(1040);
+    record_notification_latency(pd);
+
+    stats = get_stats(0);
+    TEST_ASSERT_EQUAL(MOD_PD_STATE_OFF, stats.from_state);
+    TEST_ASSERT_EQUAL(MOD_PD_STATE_ON, stats.to_state);
+    TEST_ASSERT_EQUAL(1, stats.notification.count);
+    TEST_ASSERT_EQUAL(40, stats.notification.min_latency);
+    TEST_ASSERT_EQUAL(40, stats.notification.max_latency);
+    TEST_ASSERT_EQUAL(1, stats.notification.histogram[2]);
+    TEST_ASSERT_EQUAL(0, stats.transition.count);
+}
+
+void test_transition_stats_invalid_params(void)
+{
+    struct mod_pd_transition_stats stats;
+
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, pd_transition_stats_get_count(NULL));
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, pd_transition_stats_get_stats(0, NULL));
+    TEST_ASSERT_EQUAL(FWK_E_RANGE, pd_transition_stats_get_stats(0, &stats));
+}
+
+void test_transition_stats_bucket(void)
+{
+    TEST_ASSERT_EQUAL(0, latency_stats_bucket(0));
+    TEST_ASSERT_EQUAL(0, latency_stats_bucket(3));
+    TEST_ASSERT_EQUAL(1, latency_stats_bucket(4));
+    TEST_ASSERT_EQUAL(2, latency_stats_bucket(63));
+    TEST_ASSERT_EQUAL(3, latency_stats_bucket(64));
+    TEST_ASSERT_EQUAL(
+        MOD_PD_LATENCY_HISTOGRAM_BUCKET_COUNT - 1,
+        latency_stats_bucket(UINT32_C(1000000)));
+}
+
+int power_domain_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_transition_stats_record);
+    RUN_TEST(test_transition_stats_table_full);
+    RUN_TEST(test_transition_stats_report_other_state);
+    RUN_TEST(test_transition_stats_notification);
+    RUN_TEST(test_transition_stats_invalid_params);
+    RUN_TEST(test_transition_stats_bucket);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return power_domain_test_main();
+}
+#endif
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2020-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2020-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -21,6 +21,10 @@
 #include <fwk_string.h>
 
 #include <inttypes.h>
+#ifdef BUILD_HAS_RESOURCE_PERMISSIONS_BITMAP
+#    include <limits.h>
+#    include <stdbool.h>
+#endif
 
 struct res_perms_ctx {
     /*! platform config data */
@@ -138,8 +142,61 @@ struct agent_resource_permissions_params {
     struct protocol_permissions_counters *counters;
 };
 
+#ifdef BUILD_HAS_RESOURCE_PERMISSIONS_BITMAP
+/*
+ * Number of standard protocols, from the Base protocol to the Power Capping
+ * protocol, which can be described in the permissions bitmap.
+ */
+#    define RES_PERMS_BITMAP_PROTOCOL_COUNT \
+        (MOD_SCMI_PROTOCOL_ID_POWER_CAPPING - MOD_SCMI_PROTOCOL_ID_BASE + 1)
+
+/* Number of bits in a word of the permissions bitmap */
+#    define RES_PERMS_BITMAP_WORD_BITS (sizeof(uint32_t) * CHAR_BIT)
+
+struct res_perms_bitmap_protocol {
+    /*! First message with per-resource permissions. */
+    uint32_t first_message_id;
+
+    /*! Number of messages with per-resource permissions. */
+    uint32_t message_count;
+
+    /*! Number of resources. */
+    uint32_t resource_count;
+
+    /*! Offset of the bits of the protocol within the bits of an agent. */
+    uint32_t offset;
+
+    /*! Protocol:Message:Resource permissions table. */
+    const mod_res_perms_t *perms;
+};
+
+struct res_perms_bitmap {
+    /*! Description of the protocols, indexed by protocol index. */
+    struct res_perms_bitmap_protocol protocol[RES_PERMS_BITMAP_PROTOCOL_COUNT];
+
+    /*! Number of bits used by each agent. */
+    uint32_t agent_bit_count;
+
+    /*! Number of words of the bitmap. */
+    uint32_t word_count;
+
+    /*!
+     * The bitmap, organised as
+     *
+     *      agent[agent_count].protocol[].message[message_count]
+     *          .resource[resource_count]
+     *
+     * A bit is SET when the access is denied.
+     */
+    uint32_t *words;
+};
+#endif
+
 static struct res_perms_ctx resources_perms_ctx;
 static struct res_perms_backup resources_perms_backup;
+#ifdef BUILD_HAS_RESOURCE_PERMISSIONS_BITMAP
+static struct res_perms_bitmap resources_perms_bitmap;
+#endif
 
 /*
  * Map the agent-id to the corresponding index in the table.
@@ -706,6 +763,261 @@ static enum mod_res_perms_permissions agent_message_permissions(
     return MOD_RES_PERMS_ACCESS_ALLOWED;
 }
 
+#ifdef BUILD_HAS_RESOURCE_PERMISSIONS_BITMAP
+/*
+ * Flat permissions bitmap.
+ *
+ * The agent:protocol, agent:protocol:message and
+ * agent:protocol:message:resource permissions of the protocols managing
+ * resources are combined into a dense bitmap, so that checking the
+ * permissions of an agent for a resource is a single bit test. The bitmap is
+ * built when the module is initialized and rebuilt whenever the permissions
+ * are changed.
+ *
+ * The checks which are not described by the bitmap, e.g. for the messages
+ * available to all agents or for the platform-specific protocols, go through
+ * the permissions tables.
+ */
+static void res_perms_bitmap_protocol_init(
+    uint32_t protocol_id,
+    uint32_t first_message_id,
+    uint32_t last_message_id,
+    uint32_t resource_count,
+    const mod_res_perms_t *perms,
+    uint32_t *offset)
+{
+    struct res_perms_bitmap_protocol *protocol;
+
+    protocol = &resources_perms_bitmap
+                    .protocol[protocol_id - MOD_SCMI_PROTOCOL_ID_BASE];
+
+    *protocol = (struct res_perms_bitmap_protocol){
+        .first_message_id = first_message_id,
+        .message_count = last_message_id - first_message_id + 1,
+        .resource_count = resource_count,
+        .offset = *offset,
+        .perms = perms,
+    };
+
+    *offset += protocol->message_count * protocol->resource_count;
+}
+
+/*
+ * Get whether the access is denied, from the permissions tables. This follows
+ * the checks of agent_resource_permissions() for a valid agent, message and
+ * resource.
+ */
+static bool res_perms_bitmap_is_denied(
+    uint32_t agent_idx,
+    uint32_t protocol_idx,
+    uint32_t message_idx,
+    uint32_t resource_id)
+{
+    const struct mod_res_agent_permission *agent_perms;
+    const struct res_perms_bitmap_protocol *protocol;
+    uint32_t resource_size;
+    uint32_t resource_idx;
+
+    agent_perms = resources_perms_ctx.agent_permissions;
+    protocol = &resources_perms_bitmap.protocol[protocol_idx];
+
+    if (agent_perms->agent_protocol_permissions != NULL) {
+        if (protocol_idx >= resources_perms_ctx.protocol_count) {
+            return true;
+        }
+
+        if (agent_perms->agent_protocol_permissions[agent_idx].protocols &
+            (1U << protocol_idx)) {
+            return true;
+        }
+    }
+
+    if ((agent_perms->agent_msg_permissions != NULL) &&
+        (agent_perms->agent_msg_permissions[agent_idx].messages[protocol_idx] &
+         (1U << message_idx))) {
+        return true;
+    }
+
+    if (protocol->perms == NULL) {
+        return false;
+    }
+
+    resource_size =
+        MOD_RES_PERMS_RESOURCE_ELEMENT(protocol->resource_count) + 1;
+    resource_idx = (agent_idx * protocol->message_count * resource_size) +
+        (message_idx * resource_size) +
+        MOD_RES_PERMS_RESOURCE_ELEMENT(resource_id);
+
+    return (protocol->perms[resource_idx] &
+            (1U << MOD_RES_PERMS_RESOURCE_BIT(resource_id))) != 0;
+}
+
+static void res_perms_bitmap_build(void)
+{
+    struct res_perms_bitmap *bitmap = &resources_perms_bitmap;
+    const struct res_perms_bitmap_protocol *protocol;
+    uint32_t agent_idx;
+    uint32_t protocol_idx;
+    uint32_t message_idx;
+    uint32_t resource_id;
+    uint32_t bit;
+
+    if (bitmap->words == NULL) {
+        return;
+    }
+
+    fwk_str_memset(bitmap->words, 0, bitmap->word_count * sizeof(uint32_t));
+
+    for (agent_idx = 0; agent_idx < resources_perms_ctx.agent_count;
+         agent_idx++) {
+        for (protocol_idx = 0; protocol_idx < RES_PERMS_BITMAP_PROTOCOL_COUNT;
+             protocol_idx++) {
+            protocol = &bitmap->protocol[protocol_idx];
+            bit = (agent_idx * bitmap->agent_bit_count) + protocol->offset;
+
+            for (message_idx = 0; message_idx < protocol->message_count;
+                 message_idx++) {
+                for (resource_id = 0; resource_id < protocol->resource_count;
+                     resource_id++, bit++) {
+                    if (res_perms_bitmap_is_denied(
+                            agent_idx, protocol_idx, message_idx, resource_id)) {
+                        bitmap->words[bit / RES_PERMS_BITMAP_WORD_BITS] |=
+                            (1U << (bit % RES_PERMS_BITMAP_WORD_BITS));
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void res_perms_bitmap_init(void)
+{
+    struct mod_res_agent_permission *agent_perms =
+        resources_perms_ctx.agent_permissions;
+    struct res_perms_bitmap *bitmap = &resources_perms_bitmap;
+    uint32_t offset = 0;
+
+    res_perms_bitmap_protocol_init(
+        MOD_SCMI_PROTOCOL_ID_POWER_DOMAIN,
+        MOD_SCMI_PD_POWER_DOMAIN_ATTRIBUTES,
+        MOD_SCMI_PD_POWER_STATE_NOTIFY,
+        resources_perms_ctx.pd_count,
+        agent_perms->scmi_pd_perms,
+        &offset);
+
+    res_perms_bitmap_protocol_init(
+        MOD_SCMI_PROTOCOL_ID_PERF,
+        MOD_SCMI_PERF_DOMAIN_ATTRIBUTES,
+        MOD_SCMI_PERF_DESCRIBE_FAST_CHANNEL,
+        resources_perms_ctx.perf_count,
+        agent_perms->scmi_perf_perms,
+        &offset);
+
+    res_perms_bitmap_protocol_init(
+        MOD_SCMI_PROTOCOL_ID_CLOCK,
+        MOD_SCMI_CLOCK_ATTRIBUTES,
+        MOD_SCMI_CLOCK_CONFIG_SET,
+        resources_perms_ctx.clock_count,
+        agent_perms->scmi_clock_perms,
+        &offset);
+
+    res_perms_bitmap_protocol_init(
+        MOD_SCMI_PROTOCOL_ID_SENSOR,
+        MOD_SCMI_SENSOR_DESCRIPTION_GET,
+        MOD_SCMI_SENSOR_READING_GET,
+        resources_perms_ctx.sensor_count,
+        agent_perms->scmi_sensor_perms,
+        &offset);
+
+#    ifdef BUILD_HAS_MOD_SCMI_RESET_DOMAIN
+    res_perms_bitmap_protocol_init(
+        MOD_SCMI_PROTOCOL_ID_RESET_DOMAIN,
+        MOD_SCMI_RESET_DOMAIN_ATTRIBUTES,
+        MOD_SCMI_RESET_NOTIFY,
+        resources_perms_ctx.reset_domain_count,
+        agent_perms->scmi_reset_domain_perms,
+        &offset);
+#    endif
+
+    res_perms_bitmap_protocol_init(
+        MOD_SCMI_PROTOCOL_ID_VOLTAGE_DOMAIN,
+        MOD_SCMI_VOLTD_DOMAIN_ATTRIBUTES,
+        MOD_SCMI_VOLTD_LEVEL_GET,
+        resources_perms_ctx.voltd_count,
+        agent_perms->scmi_voltd_perms,
+        &offset);
+
+    res_perms_bitmap_protocol_init(
+        MOD_SCMI_PROTOCOL_ID_POWER_CAPPING,
+        MOD_SCMI_POWER_CAPPING_DOMAIN_ATTRIBUTES,
+        MOD_SCMI_POWER_CAPPING_COMMAND_COUNT - 1,
+        resources_perms_ctx.power_capping_count,
+        agent_perms->scmi_power_capping_perms,
+        &offset);
+
+    bitmap->agent_bit_count = offset;
+    bitmap->word_count = ((resources_perms_ctx.agent_count * offset) +
+                          RES_PERMS_BITMAP_WORD_BITS - 1) /
+        RES_PERMS_BITMAP_WORD_BITS;
+
+    if (bitmap->word_count != 0) {
+        bitmap->words = fwk_mm_calloc(bitmap->word_count, sizeof(uint32_t));
+        res_perms_bitmap_build();
+    }
+}
+
+/*
+ * Check the agent:protocol:message:resource permissions in the bitmap.
+ *
+ * Returns FWK_SUCCESS if the permissions are described by the bitmap.
+ * Returns FWK_E_RANGE if the permissions must be checked in the tables.
+ */
+static int res_perms_bitmap_check(
+    uint32_t agent_id,
+    uint32_t protocol_id,
+    uint32_t message_id,
+    uint32_t resource_id,
+    enum mod_res_perms_permissions *perms)
+{
+    const struct res_perms_bitmap *bitmap = &resources_perms_bitmap;
+    const struct res_perms_bitmap_protocol *protocol;
+    uint32_t protocol_idx;
+    uint32_t message_idx;
+    uint32_t agent_idx;
+    uint32_t bit;
+    int status;
+
+    protocol_idx = protocol_id - MOD_SCMI_PROTOCOL_ID_BASE;
+    if ((bitmap->words == NULL) ||
+        (protocol_idx >= RES_PERMS_BITMAP_PROTOCOL_COUNT)) {
+        return FWK_E_RANGE;
+    }
+
+    protocol = &bitmap->protocol[protocol_idx];
+    message_idx = message_id - protocol->first_message_id;
+    if ((message_idx >= protocol->message_count) ||
+        (resource_id >= protocol->resource_count)) {
+        return FWK_E_RANGE;
+    }
+
+    status = mod_res_agent_id_to_index(agent_id, &agent_idx);
+    if ((status != FWK_SUCCESS) ||
+        (agent_idx >= resources_perms_ctx.agent_count)) {
+        return FWK_E_RANGE;
+    }
+
+    bit = (agent_idx * bitmap->agent_bit_count) + protocol->offset +
+        (message_idx * protocol->resource_count) + resource_id;
+
+    *perms = ((bitmap->words[bit / RES_PERMS_BITMAP_WORD_BITS] &
+               (1U << (bit % RES_PERMS_BITMAP_WORD_BITS))) != 0) ?
+        MOD_RES_PERMS_ACCESS_DENIED :
+        MOD_RES_PERMS_ACCESS_ALLOWED;
+
+    return FWK_SUCCESS;
+}
+#endif
+
 /*
  * Check the permissions for agent:protocol:message:resource.
  *
@@ -735,6 +1047,9 @@ static enum mod_res_perms_permissions agent_resource_permissions(
     int32_t resource_idx;
     mod_res_perms_t perms;
     int status;
+#ifdef BUILD_HAS_RESOURCE_PERMISSIONS_BITMAP
+    enum mod_res_perms_permissions resource_perms;
+#endif
 
     /* No permissions management */
     if ((agent_id == 0) || (resources_perms_ctx.agent_permissions == NULL)) {
@@ -747,6 +1062,14 @@ static enum mod_res_perms_permissions agent_resource_permissions(
             agent_id, protocol_id, message_id, resource_id);
     }
 
+#ifdef BUILD_HAS_RESOURCE_PERMISSIONS_BITMAP
+    status = res_perms_bitmap_check(
+        agent_id, protocol_id, message_id, resource_id, &resource_perms);
+    if (status == FWK_SUCCESS) {
+        return resource_perms;
+    }
+#endif
+
     /* Agent:Protocol:command access denied */
     message_perms =
         agent_message_permissions(agent_id, protocol_id, message_id);
@@ -1123,7 +1446,7 @@ static int mod_res_agent_set_device_permission(
     dev = resources_perms_ctx.domain_devices[i].domain_devices;
     while (dev->type != MOD_RES_DOMAIN_DEVICE_INVALID) {
         if (fwk_id_is_equal(dev->device_id, FWK_ID_NONE)) {
-            return FWK_SUCCESS;
+            break;
         }
 
         resource_id = fwk_id_get_element_idx(dev->device_id);
@@ -1145,6 +1468,10 @@ static int mod_res_agent_set_device_permission(
         dev++;
     };
 
+#ifdef BUILD_HAS_RESOURCE_PERMISSIONS_BITMAP
+    res_perms_bitmap_build();
+#endif
+
     return FWK_SUCCESS;
 }
 
@@ -1216,7 +1543,7 @@ static int mod_res_agent_set_device_protocol_permission(
     dev = resources_perms_ctx.domain_devices[i].domain_devices;
     while (dev->type != MOD_RES_DOMAIN_DEVICE_INVALID) {
         if (fwk_id_is_equal(dev->device_id, FWK_ID_NONE)) {
-            return FWK_SUCCESS;
+            break;
         }
 
         if (dev->type != dev_type) {
@@ -1243,6 +1570,10 @@ static int mod_res_agent_set_device_protocol_permission(
         dev++;
     };
 
+#ifdef BUILD_HAS_RESOURCE_PERMISSIONS_BITMAP
+    res_perms_bitmap_build();
+#endif
+
     return FWK_SUCCESS;
 }
 
@@ -1385,6 +1716,10 @@ static int mod_res_agent_reset_config(uint32_t agent_id, uint32_t flags)
             MOD_SCMI_PROTOCOL_ID_VOLTAGE_DOMAIN);
     }
 
+#ifdef BUILD_HAS_RESOURCE_PERMISSIONS_BITMAP
+    res_perms_bitmap_build();
+#endif
+
     return FWK_SUCCESS;
 }
 
@@ -1477,6 +1812,10 @@ static int mod_res_perms_resources_init(
         resources_perms_ctx.device_count = config->device_count;
         resources_perms_ctx.domain_devices =
             (struct mod_res_device *)config->domain_devices;
+
+#ifdef BUILD_HAS_RESOURCE_PERMISSIONS_BITMAP
+        res_perms_bitmap_init();
+#endif
     }
     resources_perms_ctx.config = config;
     return FWK_SUCCESS;
@@ -1,7 +1,7 @@
 
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2023-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -11,6 +11,8 @@
 #include <Mockfwk_string.h>
 #include <mod_resource_perms.h>
 
+#include <string.h>
+
 #include UNIT_TEST_SRC
 
 #define SCMI_FLAGS_ALLOWED MOD_RES_PERMS_ACCESS_DENIED
@@ -382,6 +384,166 @@ void utest_set_agent_resource_reset_permissions(void)
         reset_permissions.resource_permission[2]);
 }
 #endif
+#ifdef BUILD_HAS_RESOURCE_PERMISSIONS_BITMAP
+#    define BITMAP_AGENT_COUNT 2
+#    define BITMAP_PD_COUNT    3
+#    define BITMAP_CLOCK_COUNT 20
+
+#    define BITMAP_PD_MESSAGES \
+        (MOD_SCMI_PD_POWER_STATE_NOTIFY - MOD_SCMI_PD_POWER_DOMAIN_ATTRIBUTES + 1)
+#    define BITMAP_CLOCK_MESSAGES \
+        (MOD_SCMI_CLOCK_CONFIG_SET - MOD_SCMI_CLOCK_ATTRIBUTES + 1)
+
+#    define BITMAP_PD_ELEMENTS \
+        (MOD_RES_PERMS_RESOURCE_ELEMENT(BITMAP_PD_COUNT) + 1)
+#    define BITMAP_CLOCK_ELEMENTS \
+        (MOD_RES_PERMS_RESOURCE_ELEMENT(BITMAP_CLOCK_COUNT) + 1)
+
+static struct mod_res_agent_protocol_permissions
+    bitmap_protocol_perms[BITMAP_AGENT_COUNT];
+static struct mod_res_agent_msg_permissions
+    bitmap_msg_perms[BITMAP_AGENT_COUNT];
+static mod_res_perms_t bitmap_pd_perms
+    [BITMAP_AGENT_COUNT * BITMAP_PD_MESSAGES * BITMAP_PD_ELEMENTS];
+static mod_res_perms_t bitmap_clock_perms
+    [BITMAP_AGENT_COUNT * BITMAP_CLOCK_MESSAGES * BITMAP_CLOCK_ELEMENTS];
+static uint32_t bitmap_words[64];
+
+static struct mod_res_agent_permission bitmap_agent_perms = {
+    .agent_protocol_permissions = bitmap_protocol_perms,
+    .agent_msg_permissions = bitmap_msg_perms,
+    .scmi_pd_perms = bitmap_pd_perms,
+    .scmi_clock_perms = bitmap_clock_perms,
+};
+
+static void bitmap_memset(void *dest, int ch, size_t count, int num_calls)
+{
+    memset(dest, ch, count);
+}
+
+static void bitmap_setup(void)
+{
+    unsigned int i;
+
+    resources_perms_ctx = (struct res_perms_ctx){
+        .agent_count = BITMAP_AGENT_COUNT,
+        .protocol_count = 9,
+        .pd_count = BITMAP_PD_COUNT,
+        .clock_count = BITMAP_CLOCK_COUNT,
+        .agent_permissions = &bitmap_agent_perms,
+    };
+    resources_perms_bitmap = (struct res_perms_bitmap){ 0 };
+
+    /* Agent 2 is denied the sensor protocol */
+    bitmap_protocol_perms[0].protocols = 0;
+    bitmap_protocol_perms[1].protocols =
+        (mod_res_perms_t)MOD_RES_PERMS_SCMI_SENSOR_PROTOCOL_DENIED;
+
+    /* Agent 1 is denied POWER_STATE_SET for all power domains */
+    fwk_str_memset(bitmap_msg_perms, 0, sizeof(bitmap_msg_perms));
+    bitmap_msg_perms[0].messages[MOD_RES_PERMS_SCMI_POWER_DOMAIN_MESSAGE_IDX] =
+        (mod_res_perms_t)(1U << (MOD_SCMI_PD_POWER_STATE_SET -
+                                 MOD_SCMI_PD_POWER_DOMAIN_ATTRIBUTES));
+
+    /* Deny a resource out of two for every message */
+    for (i = 0; i < FWK_ARRAY_SIZE(bitmap_pd_perms); i++) {
+        bitmap_pd_perms[i] = 0x5;
+    }
+    for (i = 0; i < FWK_ARRAY_SIZE(bitmap_clock_perms); i++) {
+        bitmap_clock_perms[i] = (i & 1) ? 0x000A : 0xA0A0;
+    }
+
+    fwk_mm_calloc_ExpectAnyArgsAndReturn(bitmap_words);
+    res_perms_bitmap_init();
+}
+
+static void bitmap_teardown(void)
+{
+    resources_perms_ctx = (struct res_perms_ctx){ 0 };
+    resources_perms_bitmap = (struct res_perms_bitmap){ 0 };
+}
+
+/*
+ * Compare the result of the bitmap and the tables for all the agent:protocol:
+ * message:resource combinations, including the invalid ones.
+ */
+static void bitmap_assert_matches_tables(void)
+{
+    uint32_t *words = resources_perms_bitmap.words;
+    enum mod_res_perms_permissions expected, actual;
+    uint32_t agent_id, protocol_id, message_id, resource_id;
+
+    for (agent_id = 1; agent_id <= BITMAP_AGENT_COUNT + 1; agent_id++) {
+        for (protocol_id = MOD_SCMI_PROTOCOL_ID_BASE;
+             protocol_id <= MOD_SCMI_PROTOCOL_ID_POWER_CAPPING + 1;
+             protocol_id++) {
+            for (message_id = 0; message_id < 16; message_id++) {
+                for (resource_id = 0; resource_id < BITMAP_CLOCK_COUNT + 2;
+                     resource_id++) {
+                    resources_perms_bitmap.words = NULL;
+                    expected = agent_resource_permissions(
+                        agent_id, protocol_id, message_id, resource_id);
+                    resources_perms_bitmap.words = words;
+                    actual = agent_resource_permissions(
+                        agent_id, protocol_id, message_id, resource_id);
+                    TEST_ASSERT_EQUAL(expected, actual);
+                }
+            }
+        }
+    }
+}
+
+void utest_agent_resource_permissions_bitmap(void)
+{
+    fwk_str_memset_Stub(bitmap_memset);
+    bitmap_setup();
+
+    TEST_ASSERT_NOT_NULL(resources_perms_bitmap.words);
+    TEST_ASSERT_EQUAL(
+        (BITMAP_PD_MESSAGES * BITMAP_PD_COUNT) +
+            (BITMAP_CLOCK_MESSAGES * BITMAP_CLOCK_COUNT),
+        resources_perms_bitmap.agent_bit_count);
+
+    bitmap_assert_matches_tables();
+
+    TEST_ASSERT_EQUAL(
+        MOD_RES_PERMS_ACCESS_DENIED,
+        agent_resource_permissions(
+            1, MOD_SCMI_PROTOCOL_ID_POWER_DOMAIN, MOD_SCMI_PD_POWER_STATE_SET, 1));
+    TEST_ASSERT_EQUAL(
+        MOD_RES_PERMS_ACCESS_ALLOWED,
+        agent_resource_permissions(
+            2, MOD_SCMI_PROTOCOL_ID_POWER_DOMAIN, MOD_SCMI_PD_POWER_STATE_SET, 1));
+
+    bitmap_teardown();
+    fwk_str_memset_Stub(NULL);
+}
+
+void utest_agent_resource_permissions_bitmap_rebuild(void)
+{
+    fwk_str_memset_Stub(bitmap_memset);
+    bitmap_setup();
+
+    TEST_ASSERT_EQUAL(
+        MOD_RES_PERMS_ACCESS_ALLOWED,
+        agent_resource_permissions(
+            2, MOD_SCMI_PROTOCOL_ID_CLOCK, MOD_SCMI_CLOCK_RATE_GET, 0));
+
+    /* Deny all the clocks to all agents and rebuild the bitmap */
+    fwk_str_memset(bitmap_clock_perms, 0xFF, sizeof(bitmap_clock_perms));
+    res_perms_bitmap_build();
+
+    TEST_ASSERT_EQUAL(
+        MOD_RES_PERMS_ACCESS_DENIED,
+        agent_resource_permissions(
+            2, MOD_SCMI_PROTOCOL_ID_CLOCK, MOD_SCMI_CLOCK_RATE_GET, 0));
+    bitmap_assert_matches_tables();
+
+    bitmap_teardown();
+    fwk_str_memset_Stub(NULL);
+}
+#endif
+
 int resource_perms_test_main(void)
 {
     UNITY_BEGIN();
@@ -394,6 +556,10 @@ int resource_perms_test_main(void)
     RUN_TEST(utest_set_agent_resource_sensor_permissions);
 #ifdef BUILD_HAS_MOD_SCMI_RESET_DOMAIN
     RUN_TEST(utest_set_agent_resource_reset_permissions);
+#endif
+#ifdef BUILD_HAS_RESOURCE_PERMISSIONS_BITMAP
+    RUN_TEST(utest_agent_resource_permissions_bitmap);
+    RUN_TEST(utest_agent_resource_permissions_bitmap_rebuild);
 #endif
     return UNITY_END();
 }
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -14,11 +14,122 @@
 #include <mod_scmi.h>
 #include <mod_scmi_header.h>
 
+#if (defined(BUILD_HAS_SCMI_NOTIFICATION_COALESCING) || \
+     defined(BUILD_HAS_SCMI_REQUESTER_PIPELINING)) && \
+    defined(BUILD_HAS_MOD_TIMER)
+#    include <mod_timer.h>
+#endif
+
 #include <fwk_id.h>
+#if defined(BUILD_HAS_SCMI_FAIR_SCHEDULING) || \
+    defined(BUILD_HAS_SCMI_RATE_LIMIT) || \
+    defined(BUILD_HAS_SCMI_LATENCY_STATS)
+#    include <fwk_time.h>
+#endif
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
+/* SCMI module event indices */
+enum scmi_event_idx {
+    /* Incoming message to be processed by the targeted service */
+    SCMI_EVENT_IDX_MESSAGE,
+
+#ifdef BUILD_HAS_SCMI_FAIR_SCHEDULING
+    /* Dispatch the next pending message according to the agents' QoS */
+    SCMI_EVENT_IDX_DISPATCH,
+#endif
+
+#ifdef BUILD_HAS_SCMI_NOTIFICATION_COALESCING
+    /* A notification has been read by the agent */
+    SCMI_EVENT_IDX_NOTIFICATION_ACK,
+
+    /* Retry sending the notifications held back */
+    SCMI_EVENT_IDX_NOTIFICATION_FLUSH,
+#endif
+
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+    /* No response has been received for the request in flight */
+    SCMI_EVENT_IDX_REQUEST_TIMEOUT,
+#endif
+
+    SCMI_EVENT_IDX_COUNT,
+};
+
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+/* SCMI message saved while a deferred message is resumed */
+struct scmi_message_ref {
+    /* SCMI message token */
+    uint16_t token;
+
+    /* SCMI protocol identifier */
+    unsigned int protocol_id;
+
+    /* SCMI message identifier */
+    unsigned int message_id;
+
+    /* SCMI message type */
+    enum mod_scmi_message_type message_type;
+
+#    ifdef BUILD_HAS_SCMI_LATENCY_STATS
+    /* Time at which the message was signaled */
+    fwk_timestamp_t signal_timestamp;
+
+    /* SCMI status written at the start of the response payload */
+    int32_t response_status;
+#    endif
+};
+
+#    ifdef BUILD_HAS_SCMI_LATENCY_STATS
+/* Maximum number of deferred messages of a service whose statistics are kept */
+#        define SCMI_DEFERRED_MESSAGE_COUNT 4
+#    endif
+#endif
+
+#ifdef BUILD_HAS_SCMI_NOTIFICATION_COALESCING
+/* Maximum size of the payload of a notification which can be held back */
+#    define SCMI_NOTIFICATION_PENDING_PAYLOAD_SIZE (6 * sizeof(uint32_t))
+
+/* Performance notifications which report the latest value of a state */
+#    define SCMI_NOTIFICATION_PERF_LIMITS_CHANGED 0x0
+#    define SCMI_NOTIFICATION_PERF_LEVEL_CHANGED  0x1
+
+struct scmi_notification_pending {
+    /* SCMI message header of the notification */
+    uint32_t message_header;
+
+    /* Identifier of the element (domain, sensor...) the notification is for */
+    uint32_t element_id;
+
+    /* Size in bytes of the notification payload */
+    size_t payload_size;
+
+    /* Payload of the most recent notification */
+    uint32_t payload[
+        SCMI_NOTIFICATION_PENDING_PAYLOAD_SIZE / sizeof(uint32_t)];
+};
+#endif
+
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+/* Maximum size of the payload of a request which can be queued */
+#    define SCMI_REQUEST_QUEUE_PAYLOAD_SIZE (4 * sizeof(uint32_t))
+
+struct scmi_request {
+    /* SCMI message header of the request */
+    uint32_t message_header;
+
+    /* Size in bytes of the request payload */
+    size_t payload_size;
+
+    /* Whether the response is to be signaled by an interrupt */
+    bool request_ack_by_interrupt;
+
+    /* Payload of the request */
+    uint32_t payload[SCMI_REQUEST_QUEUE_PAYLOAD_SIZE / sizeof(uint32_t)];
+};
+#endif
+
 /* SCMI service context */
 struct scmi_service_ctx {
     /* Pointer to SCMI service configuration data */
@@ -59,7 +170,128 @@ struct scmi_service_ctx {
 
     /* SCMI type of the message currently being processed */
     enum mod_scmi_message_type scmi_message_type;
+
+#ifdef BUILD_HAS_SCMI_FAIR_SCHEDULING
+    /* Index of the entry in the agent QoS table used by the service */
+    unsigned int qos_agent_idx;
+
+    /* A message has been signaled and is waiting to be dispatched */
+    bool pending;
+#endif
+
+#if defined(BUILD_HAS_SCMI_FAIR_SCHEDULING) || \
+    defined(BUILD_HAS_SCMI_LATENCY_STATS)
+    /* Time at which the current message was signaled */
+    fwk_timestamp_t signal_timestamp;
+#endif
+
+#ifdef BUILD_HAS_SCMI_LATENCY_STATS
+    /* SCMI status written at the start of the current response payload */
+    int32_t response_status;
+#endif
+
+#ifdef BUILD_HAS_SCMI_NOTIFICATION_COALESCING
+    /*
+     * Table of the notifications held back while the P2A channel is busy, in
+     * the order they are to be sent. Only allocated for the services used to
+     * send notifications.
+     */
+    struct scmi_notification_pending *notification_pending_table;
+
+    /* Number of notifications held back */
+    unsigned int notification_pending_count;
+
+    /* Notification coalescing statistics */
+    struct mod_scmi_notification_coalescing_stats notification_stats;
+#endif
+
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+    /* Whether a deferred message has been resumed and not responded to */
+    bool message_resumed;
+
+    /* Message being processed when the deferred message was resumed */
+    struct scmi_message_ref preempted_message;
+
+#    ifdef BUILD_HAS_SCMI_LATENCY_STATS
+    /* Deferred messages, matched by token when they are resumed */
+    struct scmi_message_ref deferred_message_table[SCMI_DEFERRED_MESSAGE_COUNT];
+
+    /* Number of deferred messages in the table */
+    unsigned int deferred_message_count;
+#    endif
+#endif
+
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+    /*
+     * Circular queue of the requests waiting for the channel to become free.
+     * Only allocated for the services used by the platform as an SCMI agent.
+     */
+    struct scmi_request *request_queue;
+
+    /* Index of the oldest request in the queue */
+    unsigned int request_queue_head;
+
+    /* Number of requests in the queue */
+    unsigned int request_queue_count;
+
+    /* Whether a request sent on the channel is awaiting its response */
+    bool request_in_flight;
+
+    /* Token of the request awaiting its response */
+    uint16_t request_in_flight_token;
+
+#    ifdef BUILD_HAS_MOD_TIMER
+    /* Alarm API used to time out the request awaiting its response */
+    const struct mod_timer_alarm_api *request_timeout_alarm_api;
+#    endif
+#endif
+};
+
+#ifdef BUILD_HAS_SCMI_FAIR_SCHEDULING
+/* Per-agent scheduling context */
+struct scmi_agent_qos_ctx {
+    /* Scheduling class of the agent */
+    enum mod_scmi_agent_qos_class qos_class;
+
+    /* Number of messages the agent can dispatch per round */
+    unsigned int weight;
+
+    /* Number of messages the agent can still dispatch in the current round */
+    unsigned int credits;
+
+    /* Scheduling statistics */
+    struct mod_scmi_agent_qos_stats stats;
+};
+#endif
+
+#ifdef BUILD_HAS_SCMI_RATE_LIMIT
+/* Token bucket of an agent for one protocol */
+struct scmi_rate_limit_ctx {
+    /* Rate limit configuration */
+    const struct mod_scmi_rate_limit *config;
+
+    /* Bucket depth, in nanosecond-scaled tokens */
+    uint64_t capacity;
+
+    /* Tokens in the bucket, scaled by the number of nanoseconds in a second */
+    uint64_t tokens;
+
+    /* Time of the last bucket refill */
+    fwk_timestamp_t last_refill;
+
+    /* Rate limiting statistics */
+    struct mod_scmi_rate_limit_stats stats;
+};
+
+/* Rate limiting context of an agent */
+struct scmi_agent_rate_limit_ctx {
+    /* Table of token buckets, one per configured protocol */
+    struct scmi_rate_limit_ctx *bucket_table;
+
+    /* Number of token buckets */
+    unsigned int bucket_count;
 };
+#endif
 
 struct scmi_protocol {
     /* SCMI protocol message handler */
@@ -105,6 +337,9 @@ struct mod_scmi_ctx {
     /* Table of service contexts */
     struct scmi_service_ctx *service_ctx_table;
 
+    /* Number of services */
+    unsigned int service_count;
+
 #ifdef BUILD_HAS_MOD_RESOURCE_PERMS
     /* SCMI Resource Permissions API */
     const struct mod_res_permissions_api *res_perms_api;
@@ -113,6 +348,45 @@ struct mod_scmi_ctx {
     /* Table of scmi notification subscribers */
     struct scmi_notification_subscribers *scmi_notif_subscribers;
 #endif
+
+#ifdef BUILD_HAS_SCMI_RATE_LIMIT
+    /* Table of agent rate limiting contexts, indexed by agent identifier */
+    struct scmi_agent_rate_limit_ctx *agent_rate_limit_table;
+#endif
+
+#ifdef BUILD_HAS_SCMI_LATENCY_STATS
+    /* Table of message latency statistics entries */
+    struct mod_scmi_latency_stats *latency_stats_table;
+
+    /* Number of latency statistics entries in use */
+    unsigned int latency_stats_used;
+#endif
+
+#ifdef BUILD_HAS_SCMI_FAIR_SCHEDULING
+    /*
+     * Table of agent scheduling contexts, indexed by agent identifier. Entry
+     * zero (0) is used by the services which are not bound to an agent.
+     */
+    struct scmi_agent_qos_ctx *agent_qos_table;
+
+    /* Number of services with a message waiting to be dispatched */
+    unsigned int pending_count;
+
+    /* A dispatch event is in the framework event queue */
+    bool dispatch_queued;
+
+    /* Index of the service the next round-robin search starts from */
+    unsigned int next_service_idx;
+#endif
+
+#if defined(BUILD_HAS_SCMI_NOTIFICATION_COALESCING) && \
+    defined(BUILD_HAS_MOD_TIMER)
+    /* Alarm API used to retry sending the notifications held back */
+    const struct mod_timer_alarm_api *notification_flush_alarm_api;
+
+    /* The notification flush alarm has been started */
+    bool notification_flush_armed;
+#endif
 };
 
 #endif /* MOD_INTERNAL_SCMI_H */
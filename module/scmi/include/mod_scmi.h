@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -16,6 +16,11 @@
 
 #include <fwk_id.h>
 #include <fwk_module_idx.h>
+#if defined(BUILD_HAS_SCMI_FAIR_SCHEDULING) || \
+    defined(BUILD_HAS_SCMI_RATE_LIMIT) || \
+    defined(BUILD_HAS_SCMI_LATENCY_STATS)
+#    include <fwk_time.h>
+#endif
 
 #include <stdbool.h>
 #include <stddef.h>
@@ -40,6 +45,15 @@ enum mod_scmi_api_idx {
     MOD_SCMI_API_IDX_TRANSPORT,
 #ifdef BUILD_HAS_SCMI_NOTIFICATIONS
     MOD_SCMI_API_IDX_NOTIFICATION,
+#endif
+#ifdef BUILD_HAS_SCMI_FAIR_SCHEDULING
+    MOD_SCMI_API_IDX_QOS,
+#endif
+#ifdef BUILD_HAS_SCMI_RATE_LIMIT
+    MOD_SCMI_API_IDX_RATE_LIMIT,
+#endif
+#ifdef BUILD_HAS_SCMI_LATENCY_STATS
+    MOD_SCMI_API_IDX_LATENCY_STATS,
 #endif
     MOD_SCMI_API_IDX_COUNT,
 };
@@ -54,6 +68,156 @@ typedef int (*handler_table_t)(fwk_id_t, const uint32_t *);
  */
 enum mod_scmi_entity_role { MOD_SCMI_ROLE_PLATFORM, MOD_SCMI_ROLE_AGENT };
 
+#ifdef BUILD_HAS_SCMI_FAIR_SCHEDULING
+/*!
+ * \brief Scheduling class of an agent.
+ *
+ * \details Pending messages of an agent in a higher class are always
+ *      dispatched before the pending messages of agents in a lower class.
+ *      Agents in the same class share the dispatcher in weighted round-robin
+ *      order.
+ */
+enum mod_scmi_agent_qos_class {
+    /*! Default class, e.g. for management agents. */
+    MOD_SCMI_AGENT_QOS_CLASS_NORMAL,
+
+    /*! Latency sensitive agents, e.g. the OSPM performing DVFS. */
+    MOD_SCMI_AGENT_QOS_CLASS_HIGH,
+
+    /*! Background agents. */
+    MOD_SCMI_AGENT_QOS_CLASS_LOW,
+
+    /*! Number of scheduling classes */
+    MOD_SCMI_AGENT_QOS_CLASS_COUNT,
+};
+
+/*!
+ * \brief Per-agent scheduling statistics.
+ */
+struct mod_scmi_agent_qos_stats {
+    /*! Number of messages dispatched for the agent. */
+    uint32_t message_count;
+
+    /*! Accumulated time messages spent waiting to be dispatched. */
+    fwk_duration_us_t total_wait_time;
+
+    /*! Longest time a message spent waiting to be dispatched. */
+    fwk_duration_us_t max_wait_time;
+
+    /*! Accumulated time spent processing the agent's messages. */
+    fwk_duration_us_t total_service_time;
+
+    /*! Longest time spent processing a single message of the agent. */
+    fwk_duration_us_t max_service_time;
+};
+#endif
+
+#ifdef BUILD_HAS_SCMI_RATE_LIMIT
+/*!
+ * \brief Rate limit of the messages of an agent for one protocol.
+ *
+ * \details The limit is enforced with a token bucket. Each message received
+ *      for the protocol consumes one token, and tokens are added back to the
+ *      bucket at a constant rate up to the depth of the bucket. Messages
+ *      received while the bucket is empty are rejected with SCMI_BUSY.
+ */
+struct mod_scmi_rate_limit {
+    /*! \brief SCMI identifier of the protocol the limit applies to. */
+    uint8_t protocol_id;
+
+    /*! \brief Sustained number of messages per second. */
+    uint32_t rate;
+
+    /*!
+     *  \brief Maximum number of messages accepted in a burst.
+     *
+     *  \note A burst of zero is treated as a burst of one.
+     */
+    uint32_t burst;
+};
+
+/*!
+ * \brief Rate limiting statistics of an agent for one protocol.
+ */
+struct mod_scmi_rate_limit_stats {
+    /*! Number of messages accepted. */
+    uint32_t accepted_count;
+
+    /*! Number of messages rejected because the agent was over budget. */
+    uint32_t throttled_count;
+};
+#endif
+
+#ifdef BUILD_HAS_SCMI_LATENCY_STATS
+/*!
+ * \brief Number of buckets of the message latency histograms.
+ */
+#define MOD_SCMI_LATENCY_HISTOGRAM_BUCKET_COUNT 8
+
+/*!
+ * \brief Upper bound, in microseconds, of a latency histogram bucket.
+ *
+ * \details Bucket 'i' counts the messages responded to in less than
+ *      16 << (2 * i) microseconds which do not fit in bucket 'i - 1', from
+ *      16us for the first bucket up to 65.536ms for the second to last one.
+ *      The last bucket counts all the slower messages, and has no upper bound.
+ */
+#define MOD_SCMI_LATENCY_HISTOGRAM_BUCKET_LIMIT_US(BUCKET) \
+    (UINT32_C(16) << (2 * (BUCKET)))
+
+/*!
+ * \brief Latency statistics of one message of one agent.
+ *
+ * \details The latency of a message is the time between the reception of the
+ *      message by the SCMI module and the response to it, including when the
+ *      response is deferred by the protocol.
+ */
+struct mod_scmi_latency_stats {
+    /*! Identifier of the agent. */
+    uint8_t agent_id;
+
+    /*! SCMI identifier of the protocol. */
+    uint8_t protocol_id;
+
+    /*! SCMI identifier of the message. */
+    uint8_t message_id;
+
+    /*! Number of responses. */
+    uint32_t count;
+
+    /*! Number of responses with an SCMI error status. */
+    uint32_t error_count;
+
+    /*! Longest latency in microseconds. */
+    uint32_t max_latency;
+
+    /*! Latency histogram. */
+    uint32_t histogram[MOD_SCMI_LATENCY_HISTOGRAM_BUCKET_COUNT];
+};
+#endif
+
+#ifdef BUILD_HAS_SCMI_NOTIFICATION_COALESCING
+/*!
+ * \brief Notification coalescing statistics of a P2A channel.
+ */
+struct mod_scmi_notification_coalescing_stats {
+    /*! Number of notifications sent to the agent. */
+    uint32_t sent_count;
+
+    /*! Number of notifications held back while the channel was busy. */
+    uint32_t deferred_count;
+
+    /*!
+     * Number of notifications collapsed into a more recent notification of
+     * the same type for the same element while held back.
+     */
+    uint32_t coalesced_count;
+
+    /*! Number of notifications lost, e.g. because too many were held back. */
+    uint32_t dropped_count;
+};
+#endif
+
 /*!
  * \brief Agent descriptor
  */
@@ -72,6 +236,31 @@ struct mod_scmi_agent {
      *       in the system will be provided with a truncated version of it.
      */
     const char *name;
+
+#ifdef BUILD_HAS_SCMI_FAIR_SCHEDULING
+    /*! \brief Scheduling class of the messages received from the agent. */
+    enum mod_scmi_agent_qos_class qos_class;
+
+    /*!
+     *  \brief Number of messages the agent may have dispatched in one
+     *       round-robin round relative to the other agents of its class.
+     *
+     *  \note A weight of zero is treated as a weight of one.
+     */
+    unsigned int qos_weight;
+#endif
+
+#ifdef BUILD_HAS_SCMI_RATE_LIMIT
+    /*!
+     *  \brief Table of the per-protocol rate limits of the agent. This
+     *       pointer may be equal to NULL, in which case the agent's messages
+     *       are not rate limited.
+     */
+    const struct mod_scmi_rate_limit *rate_limit_table;
+
+    /*! \brief Number of entries in \ref rate_limit_table. */
+    unsigned int rate_limit_count;
+#endif
 };
 
 /*!
@@ -140,6 +329,54 @@ struct mod_scmi_config {
      *       if it exceeds this limit.
      */
     const char *sub_vendor_identifier;
+
+#ifdef BUILD_HAS_SCMI_LATENCY_STATS
+    /*!
+     *  \brief Number of latency statistics entries.
+     *
+     *  \details An entry is used for each (agent, protocol, message) tuple
+     *       the first time such a message is responded to. Once all the
+     *       entries are in use, the messages of new tuples are not recorded.
+     */
+    unsigned int latency_stats_count;
+#endif
+
+#ifdef BUILD_HAS_SCMI_NOTIFICATION_COALESCING
+    /*!
+     *  \brief Number of notifications held back per P2A channel.
+     *
+     *  \details Notifications sent while the P2A channel of an agent is busy
+     *       are held back and sent, oldest first, when the agent signals it
+     *       has read the previous notification. A performance level or limits
+     *       change notification held back is replaced by a more recent one
+     *       for the same domain, so only the latest value is sent to the
+     *       agent. The other notifications report events and are all sent.
+     *       When zero, notifications sent while the channel is busy are lost.
+     */
+    unsigned int notification_pending_count;
+
+    /*!
+     *  \brief Delay in milliseconds after which the sending of the
+     *       notifications held back is retried.
+     *
+     *  \details An agent which does not signal it has read a notification
+     *       would otherwise only get the notifications held back when a new
+     *       notification is sent. Each retry sends the oldest notification
+     *       held back on each P2A channel which is free. When zero, the
+     *       notifications held back are only sent when the agent signals it
+     *       has read the previous notification or a new notification is
+     *       sent.
+     */
+    unsigned int notification_flush_retry_ms;
+
+    /*!
+     *  \brief Identifier of the alarm used to retry sending the notifications
+     *       held back.
+     *
+     *  \details Only used when notification_flush_retry_ms is not zero.
+     */
+    fwk_id_t notification_flush_alarm_id;
+#endif
 };
 
 /*!
@@ -190,6 +427,37 @@ struct mod_scmi_service_config {
      * \details Determine if this entity is an agent or a platform.
      */
     enum mod_scmi_entity_role scmi_entity_role;
+
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+    /*!
+     * \brief Number of requests that can be queued on the service.
+     *
+     * \details Only used when the entity role is ::MOD_SCMI_ROLE_AGENT. The
+     *      requests sent while a previous request is awaiting its response are
+     *      queued and sent, oldest first, as soon as the response has been
+     *      handled. Responses are matched with their request by token. When
+     *      zero, requests are passed to the transport as they come and fail
+     *      if the channel is busy.
+     */
+    unsigned int request_queue_length;
+
+    /*!
+     * \brief Time to wait for the response to a request, in milliseconds.
+     *
+     * \details Only used when request_queue_length is not zero. A request
+     *      whose response has not been received in time is dropped, so that
+     *      the queued requests are not held back forever, and a late response
+     *      is discarded. Zero waits forever. Requires the timer module.
+     */
+    unsigned int request_timeout_ms;
+
+    /*!
+     * \brief Identifier of the alarm timing out the requests.
+     *
+     * \details Only used when request_timeout_ms is not zero.
+     */
+    fwk_id_t request_timeout_alarm_id;
+#endif
 };
 
 /*!
@@ -340,6 +608,38 @@ struct mod_scmi_to_transport_api {
      * \retval ::FWK_SUCCESS The operation succeeded.
      */
     int (*release_transport_channel_lock)(fwk_id_t channel_id);
+
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+    /*!
+     * \brief Defer the response to the message being processed (optional).
+     *
+     * \details The message keeps its slot on the channel and the next message
+     *      waiting on the channel, if any, is delivered.
+     *
+     * \param channel_id Channel identifier.
+     *
+     * \retval ::FWK_SUCCESS The operation succeeded.
+     * \retval ::FWK_E_SUPPORT The channel can hold a single message.
+     * \return One of the standard error codes for implementation-defined
+     *      errors.
+     */
+    int (*defer_message)(fwk_id_t channel_id);
+
+    /*!
+     * \brief Resume a deferred message so that it can be responded to
+     *      (optional).
+     *
+     * \param channel_id Channel identifier.
+     * \param token Token of the deferred message.
+     *
+     * \retval ::FWK_SUCCESS The operation succeeded.
+     * \retval ::FWK_E_PARAM No deferred message has the given token.
+     * \retval ::FWK_E_BUSY Another resumed message has not been responded to.
+     * \return One of the standard error codes for implementation-defined
+     *      errors.
+     */
+    int (*resume_message)(fwk_id_t channel_id, uint32_t token);
+#endif
 };
 
 /*!
@@ -548,6 +848,23 @@ struct mod_scmi_notification_api {
         unsigned int scmi_response_message_id,
         void *payload_p2a,
         size_t payload_size);
+
+#ifdef BUILD_HAS_SCMI_NOTIFICATION_COALESCING
+    /*!
+     * \brief Get the notification coalescing statistics of an agent.
+     *
+     * \param service_id Identifier of the agent's SCMI service context, or of
+     *     the P2A service context notifications are sent on.
+     * \param[out] stats Notification coalescing statistics.
+     *
+     * \retval ::FWK_SUCCESS The statistics were returned successfully.
+     * \retval ::FWK_E_PARAM The parameters are invalid.
+     * \retval ::FWK_E_SUPPORT Notifications are not held back for the agent.
+     */
+    int (*get_coalescing_stats)(
+        fwk_id_t service_id,
+        struct mod_scmi_notification_coalescing_stats *stats);
+#endif
 };
 #endif
 
@@ -693,6 +1010,48 @@ struct mod_scmi_from_protocol_api {
      */
     void (*notify)(fwk_id_t service_id, int protocol_id, int message_id,
         const void *payload, size_t size);
+
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+    /*!
+     * \brief Defer the response to the message being processed.
+     *
+     * \details Used by a protocol whose response is delayed so that the
+     *      agent can have other messages processed in the meantime. The
+     *      message must be resumed with
+     *      ::mod_scmi_from_protocol_api::resume_response before it is
+     *      responded to.
+     *
+     * \param service_id Service identifier.
+     * \param[out] token Token identifying the deferred message.
+     *
+     * \retval ::FWK_SUCCESS The operation succeeded.
+     * \retval ::FWK_E_PARAM The `token` parameter is NULL.
+     * \retval ::FWK_E_SUPPORT The transport channel of the service can hold a
+     *      single message, the message must be responded to as usual.
+     * \return One of the standard error codes for implementation-defined
+     *      errors.
+     */
+    int (*defer_response)(fwk_id_t service_id, uint32_t *token);
+
+    /*!
+     * \brief Resume a deferred message.
+     *
+     * \details The following payload and response functions of the service
+     *      operate on the resumed message until it is responded to. The
+     *      message being processed when it was resumed is then restored.
+     *
+     * \param service_id Service identifier.
+     * \param token Token of the deferred message.
+     *
+     * \retval ::FWK_SUCCESS The operation succeeded.
+     * \retval ::FWK_E_SUPPORT The transport channel of the service can hold a
+     *      single message.
+     * \retval ::FWK_E_BUSY Another resumed message has not been responded to.
+     * \return One of the standard error codes for implementation-defined
+     *      errors.
+     */
+    int (*resume_response)(fwk_id_t service_id, uint32_t token);
+#endif
 };
 
 /*!
@@ -728,8 +1087,136 @@ struct mod_scmi_from_protocol_req_api {
      * \retval ::FWK_SUCCESS The operation succeeded.
      */
     int (*response_message_handler)(fwk_id_t service_id);
+
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+    /*!
+     * \brief Get the token of the response being handled
+     *
+     * \details Allows a requester with several requests in flight on a
+     *      service to match a response with the request it completes. Only
+     *      valid while the response is being handled.
+     *
+     * \param service_id Service identifier.
+     * \param[out] token Token of the response.
+     *
+     * \retval ::FWK_SUCCESS The operation succeeded.
+     * \retval ::FWK_E_PARAM The service identifier is not valid.
+     */
+    int (*get_response_token)(fwk_id_t service_id, uint16_t *token);
+#endif
 };
 
+#ifdef BUILD_HAS_SCMI_FAIR_SCHEDULING
+/*!
+ * \brief SCMI message scheduling statistics API.
+ */
+struct mod_scmi_qos_api {
+    /*!
+     * \brief Get the scheduling statistics of an agent.
+     *
+     * \param agent_id Identifier of the agent.
+     * \param[out] stats Scheduling statistics of the agent.
+     *
+     * \retval ::FWK_SUCCESS The statistics were returned.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered:
+     *      - The `agent_id` parameter was not a valid agent identifier.
+     *      - The `stats` parameter was a null pointer value.
+     */
+    int (*get_agent_stats)(
+        unsigned int agent_id,
+        struct mod_scmi_agent_qos_stats *stats);
+
+    /*!
+     * \brief Reset the scheduling statistics of an agent.
+     *
+     * \param agent_id Identifier of the agent.
+     *
+     * \retval ::FWK_SUCCESS The statistics were reset.
+     * \retval ::FWK_E_PARAM The `agent_id` parameter was not a valid agent
+     *      identifier.
+     */
+    int (*reset_agent_stats)(unsigned int agent_id);
+};
+#endif
+
+#ifdef BUILD_HAS_SCMI_RATE_LIMIT
+/*!
+ * \brief SCMI message rate limiting API.
+ */
+struct mod_scmi_rate_limit_api {
+    /*!
+     * \brief Get the rate limiting statistics of an agent for a protocol.
+     *
+     * \param agent_id Identifier of the agent.
+     * \param protocol_id SCMI identifier of the protocol.
+     * \param[out] stats Rate limiting statistics.
+     *
+     * \retval ::FWK_SUCCESS The statistics were returned.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered:
+     *      - The `agent_id` parameter was not a valid agent identifier.
+     *      - The `stats` parameter was a null pointer value.
+     * \retval ::FWK_E_RANGE The agent has no rate limit for the protocol.
+     */
+    int (*get_stats)(
+        unsigned int agent_id,
+        uint8_t protocol_id,
+        struct mod_scmi_rate_limit_stats *stats);
+
+    /*!
+     * \brief Reset the rate limiting statistics of an agent for a protocol.
+     *
+     * \details The state of the token bucket is left unchanged, so that the
+     *      statistics can be sampled over a window without affecting the
+     *      limit enforced on the agent.
+     *
+     * \param agent_id Identifier of the agent.
+     * \param protocol_id SCMI identifier of the protocol.
+     *
+     * \retval ::FWK_SUCCESS The statistics were reset.
+     * \retval ::FWK_E_PARAM The `agent_id` parameter was not a valid agent
+     *      identifier.
+     * \retval ::FWK_E_RANGE The agent has no rate limit for the protocol.
+     */
+    int (*reset_stats)(unsigned int agent_id, uint8_t protocol_id);
+};
+#endif
+
+#ifdef BUILD_HAS_SCMI_LATENCY_STATS
+/*!
+ * \brief SCMI message latency statistics API.
+ */
+struct mod_scmi_latency_stats_api {
+    /*!
+     * \brief Get the number of latency statistics entries in use.
+     *
+     * \param[out] count Number of entries in use.
+     *
+     * \retval ::FWK_SUCCESS The number of entries was returned.
+     * \retval ::FWK_E_PARAM The `count` parameter was a null pointer value.
+     */
+    int (*get_count)(unsigned int *count);
+
+    /*!
+     * \brief Get a latency statistics entry.
+     *
+     * \param index Index of the entry.
+     * \param[out] stats Latency statistics.
+     *
+     * \retval ::FWK_SUCCESS The entry was returned.
+     * \retval ::FWK_E_PARAM The `stats` parameter was a null pointer value.
+     * \retval ::FWK_E_RANGE The entry is not in use.
+     */
+    int (*get_stats)(unsigned int index, struct mod_scmi_latency_stats *stats);
+
+    /*!
+     * \brief Release all the latency statistics entries.
+     *
+     * \retval ::FWK_SUCCESS The statistics were reset.
+     */
+    int (*reset)(void);
+};
+#endif
+
 /*!
  * \brief SCMI notification indices.
  */
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -21,6 +21,9 @@
 #include <fwk_core.h>
 #include <fwk_event.h>
 #include <fwk_id.h>
+#ifdef BUILD_HAS_SCMI_FAIR_SCHEDULING
+#    include <fwk_interrupt.h>
+#endif
 #include <fwk_log.h>
 #include <fwk_macros.h>
 #include <fwk_mm.h>
@@ -29,6 +32,10 @@
 #include <fwk_notification.h>
 #include <fwk_status.h>
 #include <fwk_string.h>
+#if defined(BUILD_HAS_SCMI_FAIR_SCHEDULING) || \
+    defined(BUILD_HAS_SCMI_RATE_LIMIT)
+#    include <fwk_time.h>
+#endif
 
 #ifdef BUILD_HAS_MOD_RESOURCE_PERMS
 #    include <mod_resource_perms.h>
@@ -177,6 +184,140 @@ static bool is_message_type_valid(const struct scmi_service_ctx *ctx)
     return retval;
 }
 
+#ifdef BUILD_HAS_SCMI_LATENCY_STATS
+/*
+ * Find the latency statistics entry of a message, or take a free entry for it
+ * on its first occurrence. The number of distinct messages seen by a platform
+ * is small, so a linear search is sufficient.
+ */
+static struct mod_scmi_latency_stats *scmi_latency_stats_get_entry(
+    unsigned int agent_id,
+    unsigned int protocol_id,
+    unsigned int message_id)
+{
+    struct mod_scmi_latency_stats *entry;
+    unsigned int entry_idx;
+
+    for (entry_idx = 0; entry_idx < scmi_ctx.latency_stats_used; entry_idx++) {
+        entry = &scmi_ctx.latency_stats_table[entry_idx];
+        if ((entry->agent_id == agent_id) &&
+            (entry->protocol_id == protocol_id) &&
+            (entry->message_id == message_id)) {
+            return entry;
+        }
+    }
+
+    if (scmi_ctx.latency_stats_used == scmi_ctx.config->latency_stats_count) {
+        return NULL;
+    }
+
+    entry = &scmi_ctx.latency_stats_table[scmi_ctx.latency_stats_used++];
+    *entry = (struct mod_scmi_latency_stats){
+        .agent_id = (uint8_t)agent_id,
+        .protocol_id = (uint8_t)protocol_id,
+        .message_id = (uint8_t)message_id,
+    };
+
+    return entry;
+}
+
+/* Index of the histogram bucket of a latency */
+static unsigned int scmi_latency_stats_bucket(fwk_duration_us_t latency)
+{
+    unsigned int bucket;
+
+    for (bucket = 0; bucket < (MOD_SCMI_LATENCY_HISTOGRAM_BUCKET_COUNT - 1);
+         bucket++) {
+        if (latency < MOD_SCMI_LATENCY_HISTOGRAM_BUCKET_LIMIT_US(bucket)) {
+            break;
+        }
+    }
+
+    return bucket;
+}
+
+/*
+ * Record the response to the message being processed by a service. The
+ * service context holds the token, protocol and message identifiers of the
+ * message until it is responded to, so responses deferred by a protocol are
+ * accounted to the message they complete.
+ */
+static void scmi_latency_stats_record(
+    const struct scmi_service_ctx *ctx,
+    int32_t scmi_status)
+{
+    struct mod_scmi_latency_stats *entry;
+    fwk_duration_us_t latency;
+
+    if (ctx->config->scmi_entity_role != MOD_SCMI_ROLE_PLATFORM) {
+        return;
+    }
+
+    entry = scmi_latency_stats_get_entry(
+        ctx->config->scmi_agent_id,
+        ctx->scmi_protocol_id,
+        ctx->scmi_message_id);
+    if (entry == NULL) {
+        return;
+    }
+
+    latency = fwk_time_duration_us(
+        fwk_time_elapsed(ctx->signal_timestamp, fwk_time_current()));
+
+    entry->count++;
+    if (scmi_status < SCMI_SUCCESS) {
+        entry->error_count++;
+    }
+
+    if (latency > entry->max_latency) {
+        entry->max_latency = (uint32_t)FWK_MIN(latency, UINT32_MAX);
+    }
+
+    entry->histogram[scmi_latency_stats_bucket(latency)]++;
+}
+
+static int scmi_latency_stats_get_count(unsigned int *count)
+{
+    if (count == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    *count = scmi_ctx.latency_stats_used;
+
+    return FWK_SUCCESS;
+}
+
+static int scmi_latency_stats_get_stats(
+    unsigned int index,
+    struct mod_scmi_latency_stats *stats)
+{
+    if (stats == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    if (index >= scmi_ctx.latency_stats_used) {
+        return FWK_E_RANGE;
+    }
+
+    *stats = scmi_ctx.latency_stats_table[index];
+
+    return FWK_SUCCESS;
+}
+
+static int scmi_latency_stats_reset(void)
+{
+    scmi_ctx.latency_stats_used = 0;
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_scmi_latency_stats_api scmi_latency_stats_api = {
+    .get_count = scmi_latency_stats_get_count,
+    .get_stats = scmi_latency_stats_get_stats,
+    .reset = scmi_latency_stats_reset,
+};
+#endif
+
 /*
  * To handle both commands and notifications received.
  */
@@ -217,120 +358,555 @@ int send_to_message_handler(
     return status;
 }
 
+#ifdef BUILD_HAS_SCMI_NOTIFICATION_COALESCING
 /*
- * Transport entity -> SCMI module
+ * Notification coalescing
  */
-static int signal_error(fwk_id_t service_id)
+
+/*
+ * Notifications start with the identifier of the agent which caused them,
+ * followed by the identifier of the element (domain, sensor...) they are for.
+ */
+static uint32_t scmi_notification_element_id(const void *payload, size_t size)
 {
-    fwk_id_t transport_id;
-    struct scmi_service_ctx *ctx;
+    if ((payload == NULL) || (size < (2 * sizeof(uint32_t)))) {
+        return 0;
+    }
 
-    ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(service_id)];
-    transport_id = ctx->transport_id;
+    return ((const uint32_t *)payload)[1];
+}
 
-    return ctx->respond(transport_id, &(int32_t){SCMI_PROTOCOL_ERROR},
-                        sizeof(int32_t));
+static int scmi_notification_transmit(
+    struct scmi_service_ctx *p2a_ctx,
+    uint32_t message_header,
+    const void *payload,
+    size_t size)
+{
+    int status;
+
+    /*
+     * Request the agent to signal when it has read the notification, so that
+     * the notifications held back in the meantime can be sent.
+     */
+    status = p2a_ctx->transmit(
+        p2a_ctx->transport_id, message_header, payload, size, true);
+    if (status == FWK_SUCCESS) {
+        p2a_ctx->notification_stats.sent_count++;
+    } else if (status != FWK_E_BUSY) {
+        FWK_LOG_DEBUG("[SCMI] %s @%d", __func__, __LINE__);
+        p2a_ctx->notification_stats.dropped_count++;
+    }
+
+    return status;
 }
 
-static int signal_message(fwk_id_t service_id)
+/*
+ * Only the notifications which report the latest value of a state can be
+ * coalesced. The other notifications report events, which must all be sent.
+ */
+static bool scmi_notification_is_coalescable(uint32_t message_header)
+{
+    unsigned int message_id = read_message_id(message_header);
+
+    return (read_protocol_id(message_header) == MOD_SCMI_PROTOCOL_ID_PERF) &&
+        ((message_id == SCMI_NOTIFICATION_PERF_LIMITS_CHANGED) ||
+         (message_id == SCMI_NOTIFICATION_PERF_LEVEL_CHANGED));
+}
+
+#    ifdef BUILD_HAS_MOD_TIMER
+static void scmi_notification_flush_alarm_callback(uintptr_t param)
 {
     struct fwk_event_light event = (struct fwk_event_light){
-        .id = FWK_ID_EVENT(FWK_MODULE_IDX_SCMI, 0),
+        .id = FWK_ID_EVENT(
+            FWK_MODULE_IDX_SCMI, SCMI_EVENT_IDX_NOTIFICATION_FLUSH),
         .source_id = FWK_ID_MODULE(FWK_MODULE_IDX_SCMI),
-        .target_id = service_id,
+        .target_id = FWK_ID_MODULE(FWK_MODULE_IDX_SCMI),
     };
 
-    return fwk_put_event(&event);
+    if (fwk_put_event(&event) != FWK_SUCCESS) {
+        /* Started again by the next notification held back */
+        scmi_ctx.notification_flush_armed = false;
+    }
 }
+#    endif
 
-static const struct mod_scmi_from_transport_api scmi_from_transport_api = {
-    .signal_error = signal_error,
-    .signal_message = signal_message,
-};
+/*
+ * Start the alarm retrying to send the notifications held back, for the agents
+ * which do not signal they have read a notification.
+ */
+static void scmi_notification_flush_arm(void)
+{
+#    ifdef BUILD_HAS_MOD_TIMER
+    int status;
+
+    if ((scmi_ctx.notification_flush_alarm_api == NULL) ||
+        scmi_ctx.notification_flush_armed) {
+        return;
+    }
+
+    status = scmi_ctx.notification_flush_alarm_api->start(
+        scmi_ctx.config->notification_flush_alarm_id,
+        scmi_ctx.config->notification_flush_retry_ms,
+        MOD_TIMER_ALARM_TYPE_ONCE,
+        scmi_notification_flush_alarm_callback,
+        (uintptr_t)0);
+    if (status == FWK_SUCCESS) {
+        scmi_ctx.notification_flush_armed = true;
+    } else {
+        FWK_LOG_DEBUG("[SCMI] %s @%d", __func__, __LINE__);
+    }
+#    endif
+}
+
+static void scmi_notification_hold(
+    struct scmi_service_ctx *p2a_ctx,
+    uint32_t message_header,
+    const void *payload,
+    size_t size)
+{
+    struct scmi_notification_pending *pending;
+    uint32_t element_id;
+    unsigned int i;
+
+    element_id = scmi_notification_element_id(payload, size);
+
+    i = p2a_ctx->notification_pending_count;
+    if (scmi_notification_is_coalescable(message_header)) {
+        for (i = 0; i < p2a_ctx->notification_pending_count; i++) {
+            pending = &p2a_ctx->notification_pending_table[i];
+            if ((pending->message_header == message_header) &&
+                (pending->element_id == element_id)) {
+                /* Only the latest value is of interest to the agent */
+                break;
+            }
+        }
+    }
+
+    if (i < p2a_ctx->notification_pending_count) {
+        p2a_ctx->notification_stats.coalesced_count++;
+    } else if (i < scmi_ctx.config->notification_pending_count) {
+        p2a_ctx->notification_pending_count++;
+        p2a_ctx->notification_stats.deferred_count++;
+    } else {
+        p2a_ctx->notification_stats.dropped_count++;
+        return;
+    }
+
+    pending = &p2a_ctx->notification_pending_table[i];
+    pending->message_header = message_header;
+    pending->element_id = element_id;
+    pending->payload_size = size;
+    if (size != 0) {
+        fwk_str_memcpy(pending->payload, payload, size);
+    }
+
+    scmi_notification_flush_arm();
+}
 
 /*
- * SCMI protocol module -> SCMI module interface
+ * Send the oldest notification held back, if the P2A channel is free.
  */
+static void scmi_notification_flush(struct scmi_service_ctx *p2a_ctx)
+{
+    struct scmi_notification_pending *table;
+    unsigned int i;
+    int status;
 
-static int get_agent_count(unsigned int *agent_count)
+    if (p2a_ctx->notification_pending_count == 0) {
+        return;
+    }
+
+    table = p2a_ctx->notification_pending_table;
+
+    status = scmi_notification_transmit(
+        p2a_ctx,
+        table[0].message_header,
+        table[0].payload,
+        table[0].payload_size);
+    if (status == FWK_E_BUSY) {
+        /* Sent when the agent signals it has read the current notification */
+        return;
+    }
+
+    p2a_ctx->notification_pending_count--;
+    for (i = 0; i < p2a_ctx->notification_pending_count; i++) {
+        table[i] = table[i + 1];
+    }
+}
+
+static void scmi_notification_send(
+    struct scmi_service_ctx *p2a_ctx,
+    uint32_t message_header,
+    const void *payload,
+    size_t size)
 {
-    if (agent_count == NULL) {
-        return FWK_E_PARAM;
+    int status;
+
+    if (size > SCMI_NOTIFICATION_PENDING_PAYLOAD_SIZE) {
+        /* The notification cannot be held back, send it as is */
+        (void)scmi_notification_transmit(p2a_ctx, message_header, payload, size);
+        return;
     }
 
-    /* Include the platform in the count */
-    *agent_count = scmi_ctx.config->agent_count + 1u;
+    /* The notifications held back are sent first to preserve their order */
+    scmi_notification_flush(p2a_ctx);
 
-    return FWK_SUCCESS;
+    if (p2a_ctx->notification_pending_count == 0) {
+        status =
+            scmi_notification_transmit(p2a_ctx, message_header, payload, size);
+        if (status != FWK_E_BUSY) {
+            return;
+        }
+    }
+
+    scmi_notification_hold(p2a_ctx, message_header, payload, size);
 }
 
+/*
+ * The agent signals on the P2A channel that it has read a notification.
+ */
+static int scmi_notification_signal_ack(fwk_id_t service_id)
+{
+    struct fwk_event_light event = (struct fwk_event_light){
+        .id = FWK_ID_EVENT(
+            FWK_MODULE_IDX_SCMI, SCMI_EVENT_IDX_NOTIFICATION_ACK),
+        .source_id = FWK_ID_MODULE(FWK_MODULE_IDX_SCMI),
+        .target_id = service_id,
+    };
+
+    return fwk_put_event(&event);
+}
 
-static int get_agent_id(fwk_id_t service_id, unsigned int *agent_id)
+static int scmi_notification_process_ack(const struct fwk_event *event)
 {
     struct scmi_service_ctx *ctx;
+    int status;
 
-    if (agent_id == NULL) {
-        return FWK_E_PARAM;
-    }
+    ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(event->target_id)];
 
-    ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(service_id)];
+    status =
+        ctx->transport_api->release_transport_channel_lock(ctx->transport_id);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
 
-    *agent_id = ctx->config->scmi_agent_id;
+    scmi_notification_flush(ctx);
 
     return FWK_SUCCESS;
 }
 
-static int get_agent_type(uint32_t scmi_agent_id,
-                          enum scmi_agent_type *agent_type)
+/*
+ * The notification flush alarm triggered, send the notifications held back on
+ * the P2A channels which are free again.
+ */
+static int scmi_notification_process_flush(void)
 {
-    if ((agent_type == NULL) ||
-        (scmi_agent_id > scmi_ctx.config->agent_count) ||
-        (scmi_agent_id == MOD_SCMI_PLATFORM_ID)) {
-        return FWK_E_PARAM;
+    struct scmi_service_ctx *ctx;
+    unsigned int service_idx;
+    bool pending = false;
+
+#    ifdef BUILD_HAS_MOD_TIMER
+    scmi_ctx.notification_flush_armed = false;
+#    endif
+
+    for (service_idx = 0; service_idx < scmi_ctx.service_count;
+         service_idx++) {
+        ctx = &scmi_ctx.service_ctx_table[service_idx];
+        if (ctx->notification_pending_table == NULL) {
+            continue;
+        }
+
+        scmi_notification_flush(ctx);
+        pending = pending || (ctx->notification_pending_count != 0);
     }
 
-    *agent_type = scmi_ctx.config->agent_table[scmi_agent_id].type;
+    if (pending) {
+        scmi_notification_flush_arm();
+    }
 
     return FWK_SUCCESS;
 }
 
-static int get_max_payload_size(fwk_id_t service_id, size_t *size)
+static int scmi_notification_get_coalescing_stats(
+    fwk_id_t service_id,
+    struct mod_scmi_notification_coalescing_stats *stats)
 {
-    struct scmi_service_ctx *ctx;
+    const struct scmi_service_ctx *ctx;
 
-    if (size == NULL) {
+    if (!fwk_module_is_valid_element_id(service_id) || (stats == NULL)) {
         return FWK_E_PARAM;
     }
 
     ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(service_id)];
+    if (!fwk_id_is_equal(ctx->config->scmi_p2a_id, FWK_ID_NONE)) {
+        ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(
+            ctx->config->scmi_p2a_id)];
+    }
 
-    return ctx->transport_api->get_max_payload_size(ctx->transport_id, size);
+    if (ctx->notification_pending_table == NULL) {
+        return FWK_E_SUPPORT;
+    }
+
+    *stats = ctx->notification_stats;
+
+    return FWK_SUCCESS;
 }
+#endif
 
-static int write_payload(fwk_id_t service_id, size_t offset,
-                         const void *payload, size_t size)
+/*
+ * Transport entity -> SCMI module
+ */
+static int signal_error(fwk_id_t service_id)
 {
-    const struct scmi_service_ctx *ctx;
+    fwk_id_t transport_id;
+    struct scmi_service_ctx *ctx;
 
     ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(service_id)];
+    transport_id = ctx->transport_id;
 
-    return ctx->transport_api->write_payload(ctx->transport_id,
-                                             offset, payload, size);
+    return ctx->respond(transport_id, &(int32_t){SCMI_PROTOCOL_ERROR},
+                        sizeof(int32_t));
 }
 
-static int respond(fwk_id_t service_id, const void *payload, size_t size)
+#ifdef BUILD_HAS_SCMI_FAIR_SCHEDULING
+/*
+ * Queue a dispatch event unless one is already in the event queue. Must be
+ * called with the interrupts disabled.
+ */
+static int scmi_sched_queue_dispatch(void)
 {
+    struct fwk_event_light event = (struct fwk_event_light){
+        .id = FWK_ID_EVENT(FWK_MODULE_IDX_SCMI, SCMI_EVENT_IDX_DISPATCH),
+        .source_id = FWK_ID_MODULE(FWK_MODULE_IDX_SCMI),
+        .target_id = FWK_ID_MODULE(FWK_MODULE_IDX_SCMI),
+    };
+    int status;
+
+    if (scmi_ctx.dispatch_queued || (scmi_ctx.pending_count == 0)) {
+        return FWK_SUCCESS;
+    }
+
+    status = fwk_put_event(&event);
+    if (status == FWK_SUCCESS) {
+        scmi_ctx.dispatch_queued = true;
+    }
+
+    return status;
+}
+
+static int signal_message(fwk_id_t service_id)
+{
+    struct scmi_service_ctx *ctx;
+    fwk_timestamp_t timestamp;
+    unsigned int flags;
     int status;
-    const struct scmi_service_ctx *ctx;
-    const char *service_name;
-    const char *message_type_name;
 
     ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(service_id)];
 
-    service_name = fwk_module_get_element_name(service_id);
-    message_type_name = get_message_type_str(ctx);
+#ifdef BUILD_HAS_SCMI_NOTIFICATION_COALESCING
+    if (ctx->notification_pending_table != NULL) {
+        return scmi_notification_signal_ack(service_id);
+    }
+#endif
 
-    /*
+    timestamp = fwk_time_current();
+
+    flags = fwk_interrupt_global_disable();
+
+    if (!ctx->pending) {
+        ctx->pending = true;
+        ctx->signal_timestamp = timestamp;
+        scmi_ctx.pending_count++;
+    }
+
+    status = scmi_sched_queue_dispatch();
+
+    fwk_interrupt_global_enable(flags);
+
+    return status;
+}
+#else
+static int signal_message(fwk_id_t service_id)
+{
+    struct fwk_event_light event = (struct fwk_event_light){
+        .id = FWK_ID_EVENT(FWK_MODULE_IDX_SCMI, SCMI_EVENT_IDX_MESSAGE),
+        .source_id = FWK_ID_MODULE(FWK_MODULE_IDX_SCMI),
+        .target_id = service_id,
+    };
+
+#ifdef BUILD_HAS_SCMI_NOTIFICATION_COALESCING
+    if (scmi_ctx.service_ctx_table[fwk_id_get_element_idx(service_id)]
+            .notification_pending_table != NULL) {
+        return scmi_notification_signal_ack(service_id);
+    }
+#endif
+
+#ifdef BUILD_HAS_SCMI_LATENCY_STATS
+    scmi_ctx.service_ctx_table[fwk_id_get_element_idx(service_id)]
+        .signal_timestamp = fwk_time_current();
+#endif
+
+    return fwk_put_event(&event);
+}
+#endif
+
+static const struct mod_scmi_from_transport_api scmi_from_transport_api = {
+    .signal_error = signal_error,
+    .signal_message = signal_message,
+};
+
+/*
+ * SCMI protocol module -> SCMI module interface
+ */
+
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+static void scmi_message_ref_save(
+    const struct scmi_service_ctx *ctx,
+    struct scmi_message_ref *ref)
+{
+    *ref = (struct scmi_message_ref){
+        .token = ctx->scmi_token,
+        .protocol_id = ctx->scmi_protocol_id,
+        .message_id = ctx->scmi_message_id,
+        .message_type = ctx->scmi_message_type,
+#    ifdef BUILD_HAS_SCMI_LATENCY_STATS
+        .signal_timestamp = ctx->signal_timestamp,
+        .response_status = ctx->response_status,
+#    endif
+    };
+}
+
+static void scmi_message_ref_restore(
+    struct scmi_service_ctx *ctx,
+    const struct scmi_message_ref *ref)
+{
+    ctx->scmi_token = ref->token;
+    ctx->scmi_protocol_id = ref->protocol_id;
+    ctx->scmi_message_id = ref->message_id;
+    ctx->scmi_message_type = ref->message_type;
+#    ifdef BUILD_HAS_SCMI_LATENCY_STATS
+    ctx->signal_timestamp = ref->signal_timestamp;
+    ctx->response_status = ref->response_status;
+#    endif
+}
+
+#    ifdef BUILD_HAS_SCMI_LATENCY_STATS
+/*
+ * Restore the signal time and response status of the deferred message with
+ * the given token, and remove it from the table of deferred messages. A
+ * message deferred while the table was full is accounted from the time it is
+ * taken.
+ */
+static void scmi_deferred_message_take(
+    struct scmi_service_ctx *ctx,
+    uint16_t token)
+{
+    struct scmi_message_ref *ref;
+    unsigned int idx;
+
+    ctx->signal_timestamp = fwk_time_current();
+    ctx->response_status = SCMI_GENERIC_ERROR;
+
+    for (idx = 0; idx < ctx->deferred_message_count; idx++) {
+        ref = &ctx->deferred_message_table[idx];
+        if (ref->token == token) {
+            ctx->signal_timestamp = ref->signal_timestamp;
+            ctx->response_status = ref->response_status;
+
+            *ref = ctx->deferred_message_table[--ctx->deferred_message_count];
+            return;
+        }
+    }
+}
+#    endif
+#endif
+
+static int get_agent_count(unsigned int *agent_count)
+{
+    if (agent_count == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    /* Include the platform in the count */
+    *agent_count = scmi_ctx.config->agent_count + 1u;
+
+    return FWK_SUCCESS;
+}
+
+
+static int get_agent_id(fwk_id_t service_id, unsigned int *agent_id)
+{
+    struct scmi_service_ctx *ctx;
+
+    if (agent_id == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(service_id)];
+
+    *agent_id = ctx->config->scmi_agent_id;
+
+    return FWK_SUCCESS;
+}
+
+static int get_agent_type(uint32_t scmi_agent_id,
+                          enum scmi_agent_type *agent_type)
+{
+    if ((agent_type == NULL) ||
+        (scmi_agent_id > scmi_ctx.config->agent_count) ||
+        (scmi_agent_id == MOD_SCMI_PLATFORM_ID)) {
+        return FWK_E_PARAM;
+    }
+
+    *agent_type = scmi_ctx.config->agent_table[scmi_agent_id].type;
+
+    return FWK_SUCCESS;
+}
+
+static int get_max_payload_size(fwk_id_t service_id, size_t *size)
+{
+    struct scmi_service_ctx *ctx;
+
+    if (size == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(service_id)];
+
+    return ctx->transport_api->get_max_payload_size(ctx->transport_id, size);
+}
+
+static int write_payload(fwk_id_t service_id, size_t offset,
+                         const void *payload, size_t size)
+{
+    struct scmi_service_ctx *ctx;
+
+    ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(service_id)];
+
+#ifdef BUILD_HAS_SCMI_LATENCY_STATS
+    /* The SCMI status of a response is the first entry of its payload */
+    if ((offset == 0) && (payload != NULL) && (size >= sizeof(int32_t))) {
+        ctx->response_status = *((const int32_t *)payload);
+    }
+#endif
+
+    return ctx->transport_api->write_payload(ctx->transport_id,
+                                             offset, payload, size);
+}
+
+static int respond(fwk_id_t service_id, const void *payload, size_t size)
+{
+    int status;
+    struct scmi_service_ctx *ctx;
+    const char *service_name;
+    const char *message_type_name;
+
+    ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(service_id)];
+
+    service_name = fwk_module_get_element_name(service_id);
+    message_type_name = get_message_type_str(ctx);
+
+    /*
      * Print to the error log if the message was not successfully processed.
      * We assume here that the first payload entry of the command response
      * holds an SCMI status code. This is the case for all the SCMI commands
@@ -363,6 +939,12 @@ static int respond(fwk_id_t service_id, const void *payload, size_t size)
 #endif
     }
 
+#ifdef BUILD_HAS_SCMI_LATENCY_STATS
+    scmi_latency_stats_record(
+        ctx,
+        (payload != NULL) ? *((int32_t *)payload) : ctx->response_status);
+#endif
+
     status = ctx->respond(ctx->transport_id, payload, size);
     if (status != FWK_SUCCESS) {
 #if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_ERROR
@@ -377,9 +959,107 @@ static int respond(fwk_id_t service_id, const void *payload, size_t size)
             fwk_status_str(status));
 #endif
     }
+
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+    if (ctx->message_resumed) {
+        /* The transport is back on the message that was preempted */
+        ctx->message_resumed = false;
+        scmi_message_ref_restore(ctx, &ctx->preempted_message);
+    }
+#endif
+
+    return status;
+}
+
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+static int defer_response(fwk_id_t service_id, uint32_t *token)
+{
+    struct scmi_service_ctx *ctx;
+    int status;
+#    ifdef BUILD_HAS_SCMI_LATENCY_STATS
+    bool saved;
+#    endif
+
+    if (token == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(service_id)];
+
+    if (ctx->transport_api->defer_message == NULL) {
+        return FWK_E_SUPPORT;
+    }
+
+    *token = ctx->scmi_token;
+
+#    ifdef BUILD_HAS_SCMI_LATENCY_STATS
+    /*
+     * Save the message before deferring it, as the transport may signal the
+     * next message straight away.
+     */
+    saved = ctx->deferred_message_count < SCMI_DEFERRED_MESSAGE_COUNT;
+    if (saved) {
+        scmi_message_ref_save(
+            ctx, &ctx->deferred_message_table[ctx->deferred_message_count++]);
+    }
+#    endif
+
+    status = ctx->transport_api->defer_message(ctx->transport_id);
+
+#    ifdef BUILD_HAS_SCMI_LATENCY_STATS
+    if ((status != FWK_SUCCESS) && saved) {
+        /* The message is still the one being processed */
+        ctx->deferred_message_count--;
+    }
+#    endif
+
     return status;
 }
 
+static int resume_response(fwk_id_t service_id, uint32_t token)
+{
+    struct scmi_service_ctx *ctx;
+    uint32_t message_header;
+    int status;
+
+    ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(service_id)];
+
+    if (ctx->transport_api->resume_message == NULL) {
+        return FWK_E_SUPPORT;
+    }
+
+    if (ctx->message_resumed) {
+        return FWK_E_BUSY;
+    }
+
+    status = ctx->transport_api->resume_message(ctx->transport_id, token);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    status = ctx->transport_api->get_message_header(
+        ctx->transport_id, &message_header);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    scmi_message_ref_save(ctx, &ctx->preempted_message);
+    ctx->message_resumed = true;
+
+    ctx->scmi_token = read_token(message_header);
+    ctx->scmi_protocol_id = read_protocol_id(message_header);
+    ctx->scmi_message_id = read_message_id(message_header);
+    ctx->scmi_message_type =
+        (enum mod_scmi_message_type)read_message_type(message_header);
+
+#    ifdef BUILD_HAS_SCMI_LATENCY_STATS
+    scmi_deferred_message_take(ctx, ctx->scmi_token);
+#    endif
+
+    return FWK_SUCCESS;
+}
+#endif
+
 #ifdef BUILD_HAS_MOD_RESOURCE_PERMS
 static int scmi_permissions_handler(
     fwk_id_t service_id,
@@ -460,7 +1140,8 @@ static int scmi_message_validation(
 static void scmi_notify(fwk_id_t id, int protocol_id, int message_id,
     const void *payload, size_t size)
 {
-    const struct scmi_service_ctx *ctx, *p2a_ctx;
+    const struct scmi_service_ctx *ctx;
+    struct scmi_service_ctx *p2a_ctx;
     uint32_t message_header;
     int status;
     bool request_ack_by_interrupt;
@@ -495,6 +1176,13 @@ static void scmi_notify(fwk_id_t id, int protocol_id, int message_id,
         (uint8_t)protocol_id,
         0);
 
+#ifdef BUILD_HAS_SCMI_NOTIFICATION_COALESCING
+    if (p2a_ctx->notification_pending_table != NULL) {
+        scmi_notification_send(p2a_ctx, message_header, payload, size);
+        return;
+    }
+#endif
+
     request_ack_by_interrupt = false;
     status = p2a_ctx->transmit(
         p2a_ctx->transport_id,
@@ -507,47 +1195,301 @@ static void scmi_notify(fwk_id_t id, int protocol_id, int message_id,
     }
 }
 
-int scmi_send_message(
-    uint8_t message_id,
-    uint8_t protocol_id,
-    uint8_t token,
-    fwk_id_t service_id,
-    const void *payload,
-    size_t payload_size,
-    bool request_ack_by_interrupt)
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+/*
+ * The request timeout alarm parameter identifies both the service and the
+ * request, so that a timeout racing with the response cannot drop the next
+ * request sent on the service.
+ */
+#    define SCMI_REQUEST_TIMEOUT_PARAM(service_idx, token) \
+        (((uintptr_t)(token) << 16) | (uintptr_t)(service_idx))
+#    define SCMI_REQUEST_TIMEOUT_SERVICE_IDX(param) \
+        ((unsigned int)((param) & UINT16_MAX))
+#    define SCMI_REQUEST_TIMEOUT_TOKEN(param) ((uint16_t)((param) >> 16))
+
+#    ifdef BUILD_HAS_MOD_TIMER
+static void scmi_request_timeout_alarm_callback(uintptr_t param)
 {
-    int status;
-
-    /* All commands, synchronous or asynchronous, have a message type of 0 */
-    uint8_t message_type = 0;
+    struct fwk_event event = (struct fwk_event){
+        .id = FWK_ID_EVENT(FWK_MODULE_IDX_SCMI, SCMI_EVENT_IDX_REQUEST_TIMEOUT),
+        .source_id = FWK_ID_MODULE(FWK_MODULE_IDX_SCMI),
+        .target_id = FWK_ID_ELEMENT(
+            FWK_MODULE_IDX_SCMI, SCMI_REQUEST_TIMEOUT_SERVICE_IDX(param)),
+    };
 
-    /* Create the SCMI message header from the arguments */
-    uint32_t message_header =
-        scmi_message_header(message_id, message_type, protocol_id, token);
+    *(uint16_t *)event.params = SCMI_REQUEST_TIMEOUT_TOKEN(param);
 
-    if (fwk_id_is_equal(service_id, FWK_ID_NONE)) {
-        return FWK_E_DATA;
+    if (fwk_put_event(&event) != FWK_SUCCESS) {
+        FWK_LOG_ERR("[SCMI] Request timeout event lost");
     }
+}
+#    endif
 
-    /* Fetch scmi module context data using the service_id */
-    const struct mod_scmi_to_transport_api *transport_api;
-    const struct scmi_service_ctx *ctx;
-    ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(service_id)];
+/* Start timing out the request which has just been sent on a service */
+static void scmi_request_timeout_start(struct scmi_service_ctx *ctx)
+{
+#    ifdef BUILD_HAS_MOD_TIMER
+    int status;
 
-    if (ctx == NULL) {
-        return FWK_E_DATA;
+    if (ctx->request_timeout_alarm_api == NULL) {
+        return;
     }
 
-    /* Initalize the transport api pointer to TRANSPORT module api */
-    transport_api = ctx->transport_api;
-
-    /* Send the SCMI message using the transport_transmit() API  */
-    status = transport_api->transmit(
-        ctx->transport_id,
-        message_header,
-        payload,
-        payload_size,
-        request_ack_by_interrupt);
+    status = ctx->request_timeout_alarm_api->start(
+        ctx->config->request_timeout_alarm_id,
+        ctx->config->request_timeout_ms,
+        MOD_TIMER_ALARM_TYPE_ONCE,
+        scmi_request_timeout_alarm_callback,
+        SCMI_REQUEST_TIMEOUT_PARAM(
+            ctx - scmi_ctx.service_ctx_table, ctx->request_in_flight_token));
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[SCMI] %s @%d", __func__, __LINE__);
+    }
+#    endif
+}
+
+static void scmi_request_timeout_stop(struct scmi_service_ctx *ctx)
+{
+#    ifdef BUILD_HAS_MOD_TIMER
+    if (ctx->request_timeout_alarm_api != NULL) {
+        (void)ctx->request_timeout_alarm_api->stop(
+            ctx->config->request_timeout_alarm_id);
+    }
+#    endif
+}
+
+/*
+ * Pass a request to the transport and, when it has been sent, record that its
+ * response is awaited.
+ */
+static int scmi_request_transmit(
+    struct scmi_service_ctx *ctx,
+    uint32_t message_header,
+    const void *payload,
+    size_t payload_size,
+    bool request_ack_by_interrupt)
+{
+    int status;
+
+    status = ctx->transport_api->transmit(
+        ctx->transport_id,
+        message_header,
+        payload,
+        payload_size,
+        request_ack_by_interrupt);
+    if ((status == FWK_SUCCESS) && (ctx->request_queue != NULL)) {
+        ctx->request_in_flight = true;
+        ctx->request_in_flight_token = read_token(message_header);
+        scmi_request_timeout_start(ctx);
+    }
+
+    return status;
+}
+
+/* Queue a request until the response to the request in flight is handled */
+static int scmi_request_enqueue(
+    struct scmi_service_ctx *ctx,
+    uint32_t message_header,
+    const void *payload,
+    size_t payload_size,
+    bool request_ack_by_interrupt)
+{
+    struct scmi_request *request;
+
+    if (payload_size > SCMI_REQUEST_QUEUE_PAYLOAD_SIZE) {
+        return FWK_E_RANGE;
+    }
+
+    if (ctx->request_queue_count == ctx->config->request_queue_length) {
+        return FWK_E_BUSY;
+    }
+
+    request = &ctx->request_queue
+                   [(ctx->request_queue_head + ctx->request_queue_count) %
+                    ctx->config->request_queue_length];
+    request->message_header = message_header;
+    request->payload_size = payload_size;
+    request->request_ack_by_interrupt = request_ack_by_interrupt;
+    if (payload_size != 0) {
+        fwk_str_memcpy(request->payload, payload, payload_size);
+    }
+    ctx->request_queue_count++;
+
+    return FWK_SUCCESS;
+}
+
+/*
+ * Send the oldest queued request once the response to the previous request
+ * has been handled. A request the transport cannot take yet stays at the head
+ * of the queue.
+ */
+static void scmi_request_send_next(struct scmi_service_ctx *ctx)
+{
+    struct scmi_request *request;
+    int status;
+
+    if (ctx->request_queue_count == 0) {
+        return;
+    }
+
+    request = &ctx->request_queue[ctx->request_queue_head];
+    status = scmi_request_transmit(
+        ctx,
+        request->message_header,
+        request->payload,
+        request->payload_size,
+        request->request_ack_by_interrupt);
+    if (status == FWK_E_BUSY) {
+        return;
+    }
+
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_ERR(
+            "[SCMI] Queued request [%" PRIu16 " (0x%x:0x%x)] failed (%s)",
+            read_token(request->message_header),
+            read_protocol_id(request->message_header),
+            read_message_id(request->message_header),
+            fwk_status_str(status));
+    }
+
+    ctx->request_queue_head =
+        (ctx->request_queue_head + 1) % ctx->config->request_queue_length;
+    ctx->request_queue_count--;
+}
+
+/*
+ * Send a request on a service. The request is sent straight away when the
+ * channel is free, and queued otherwise.
+ */
+static int scmi_request_send(
+    struct scmi_service_ctx *ctx,
+    uint32_t message_header,
+    const void *payload,
+    size_t payload_size,
+    bool request_ack_by_interrupt)
+{
+    int status;
+
+    if (!ctx->request_in_flight && (ctx->request_queue_count != 0)) {
+        /* The channel was still busy when the last request timed out */
+        scmi_request_send_next(ctx);
+    }
+
+    if (!ctx->request_in_flight && (ctx->request_queue_count == 0)) {
+        status = scmi_request_transmit(
+            ctx,
+            message_header,
+            payload,
+            payload_size,
+            request_ack_by_interrupt);
+        if ((status != FWK_E_BUSY) || (ctx->request_queue == NULL)) {
+            return status;
+        }
+    }
+
+    return scmi_request_enqueue(
+        ctx, message_header, payload, payload_size, request_ack_by_interrupt);
+}
+
+/*
+ * Match a response with the request awaiting it. Return false if the response
+ * is not the one expected on the service, in which case it is discarded.
+ */
+static bool scmi_request_match_response(struct scmi_service_ctx *ctx)
+{
+    if (ctx->request_queue == NULL) {
+        return true;
+    }
+
+    if (!ctx->request_in_flight ||
+        (ctx->scmi_token != ctx->request_in_flight_token)) {
+        return false;
+    }
+
+    ctx->request_in_flight = false;
+    scmi_request_timeout_stop(ctx);
+
+    return true;
+}
+
+/*
+ * No response has been received in time for the request in flight. Drop it,
+ * so that a late response is discarded, and send the next queued request.
+ */
+static int scmi_request_process_timeout(const struct fwk_event *event)
+{
+    struct scmi_service_ctx *ctx;
+    uint16_t token = *(const uint16_t *)event->params;
+
+    ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(event->target_id)];
+    if (!ctx->request_in_flight || (ctx->request_in_flight_token != token)) {
+        /* The response has been received in the meantime */
+        return FWK_SUCCESS;
+    }
+
+    FWK_LOG_ERR(
+        "[SCMI] %s: Cmd [%" PRIu16 "] timed out",
+        fwk_module_get_element_name(event->target_id),
+        token);
+
+    ctx->request_in_flight = false;
+    scmi_request_send_next(ctx);
+
+    return FWK_SUCCESS;
+}
+#endif
+
+int scmi_send_message(
+    uint8_t message_id,
+    uint8_t protocol_id,
+    uint8_t token,
+    fwk_id_t service_id,
+    const void *payload,
+    size_t payload_size,
+    bool request_ack_by_interrupt)
+{
+    int status;
+
+    /* All commands, synchronous or asynchronous, have a message type of 0 */
+    uint8_t message_type = 0;
+
+    /* Create the SCMI message header from the arguments */
+    uint32_t message_header =
+        scmi_message_header(message_id, message_type, protocol_id, token);
+
+    if (fwk_id_is_equal(service_id, FWK_ID_NONE)) {
+        return FWK_E_DATA;
+    }
+
+    /* Fetch scmi module context data using the service_id */
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+    struct scmi_service_ctx *ctx;
+#else
+    const struct mod_scmi_to_transport_api *transport_api;
+    const struct scmi_service_ctx *ctx;
+#endif
+    ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(service_id)];
+
+    if (ctx == NULL) {
+        return FWK_E_DATA;
+    }
+
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+    /* Send the SCMI message, or queue it if the channel is busy */
+    status = scmi_request_send(
+        ctx, message_header, payload, payload_size, request_ack_by_interrupt);
+#else
+    /* Initalize the transport api pointer to TRANSPORT module api */
+    transport_api = ctx->transport_api;
+
+    /* Send the SCMI message using the transport_transmit() API  */
+    status = transport_api->transmit(
+        ctx->transport_id,
+        message_header,
+        payload,
+        payload_size,
+        request_ack_by_interrupt);
+#endif
 
 #if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_ERROR
     if (status == FWK_SUCCESS) {
@@ -585,6 +1527,21 @@ int response_message_handler(fwk_id_t service_id)
     return status;
 }
 
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+static int get_response_token(fwk_id_t service_id, uint16_t *token)
+{
+    if (!fwk_module_is_valid_element_id(service_id) || (token == NULL)) {
+        return FWK_E_PARAM;
+    }
+
+    *token =
+        scmi_ctx.service_ctx_table[fwk_id_get_element_idx(service_id)]
+            .scmi_token;
+
+    return FWK_SUCCESS;
+}
+#endif
+
 static const struct mod_scmi_from_protocol_api scmi_from_protocol_api = {
     .get_agent_count = get_agent_count,
     .get_agent_id = get_agent_id,
@@ -594,12 +1551,19 @@ static const struct mod_scmi_from_protocol_api scmi_from_protocol_api = {
     .respond = respond,
     .scmi_message_validation = scmi_message_validation,
     .notify = scmi_notify,
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+    .defer_response = defer_response,
+    .resume_response = resume_response,
+#endif
 };
 
 static const struct mod_scmi_from_protocol_req_api
     scmi_from_protocol_req_api = {
         .scmi_send_message = scmi_send_message,
         .response_message_handler = response_message_handler,
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+        .get_response_token = get_response_token,
+#endif
     };
 
 #ifdef BUILD_HAS_SCMI_NOTIFICATIONS
@@ -675,135 +1639,455 @@ static int scmi_notification_service_idx(
         int)(agent_idx + element_idx * agent_count + operation_idx * element_count * agent_count);
 }
 
-static int scmi_notification_add_subscriber(
-    unsigned int protocol_id,
-    unsigned int element_idx,
-    unsigned int operation_id,
-    fwk_id_t service_id)
+static int scmi_notification_add_subscriber(
+    unsigned int protocol_id,
+    unsigned int element_idx,
+    unsigned int operation_id,
+    fwk_id_t service_id)
+{
+    int status;
+    unsigned int service_id_idx;
+    unsigned int agent_idx;
+
+    struct scmi_notification_subscribers *subscribers =
+        notification_subscribers(protocol_id);
+
+    status = get_agent_id(service_id, &agent_idx);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    fwk_assert(operation_id < MOD_SCMI_PROTOCOL_MAX_OPERATION_ID);
+    /*
+     * Initialize only if the entry is
+     * invalid (MOD_SCMI_PROTOCOL_OPERATION_IDX_INVALID)
+     */
+    if (subscribers->operation_id_to_idx[operation_id] ==
+        MOD_SCMI_PROTOCOL_OPERATION_IDX_INVALID) {
+        fwk_assert(subscribers->operation_idx < subscribers->operation_count);
+        subscribers->operation_id_to_idx[operation_id] =
+            (uint8_t)subscribers->operation_idx++;
+    }
+
+    service_id_idx = (unsigned int)scmi_notification_service_idx(
+        agent_idx,
+        element_idx,
+        subscribers->operation_id_to_idx[operation_id],
+        subscribers->agent_count,
+        subscribers->element_count);
+
+    subscribers->agent_service_ids[service_id_idx] = service_id;
+
+    return FWK_SUCCESS;
+}
+
+static int scmi_notification_remove_subscriber(
+    unsigned int protocol_id,
+    unsigned int agent_idx,
+    unsigned int element_idx,
+    unsigned int operation_id)
+{
+    unsigned int operation_idx = 0;
+    unsigned int service_id_idx;
+
+    struct scmi_notification_subscribers *subscribers =
+        notification_subscribers(protocol_id);
+
+    fwk_assert(operation_id < MOD_SCMI_PROTOCOL_MAX_OPERATION_ID);
+
+    operation_idx = subscribers->operation_id_to_idx[operation_id];
+
+    service_id_idx = (unsigned int)scmi_notification_service_idx(
+        agent_idx,
+        element_idx,
+        operation_idx,
+        subscribers->agent_count,
+        subscribers->element_count);
+
+    subscribers->agent_service_ids[service_id_idx] = FWK_ID_NONE;
+
+    return FWK_SUCCESS;
+}
+
+static int scmi_notification_notify(
+    unsigned int protocol_id,
+    unsigned int operation_id,
+    unsigned int scmi_response_id,
+    void *payload_p2a,
+    size_t payload_size)
+{
+    unsigned int i, j;
+    unsigned int operation_idx;
+    fwk_id_t service_id;
+    unsigned int service_id_idx;
+
+    struct scmi_notification_subscribers *subscribers =
+        notification_subscribers(protocol_id);
+
+    fwk_assert(operation_id < MOD_SCMI_PROTOCOL_MAX_OPERATION_ID);
+    operation_idx = subscribers->operation_id_to_idx[operation_id];
+
+    /*
+     * Silently return FWK_SUCCESS if no valid operation_idx is found
+     * for a given operation_id. This is required in where(e.g. DVFS/perf)
+     * scmi_notification_notify gets called before a call to
+     * scmi_notification_add_subscriber.
+     */
+    if (operation_idx == MOD_SCMI_PROTOCOL_OPERATION_IDX_INVALID) {
+        return FWK_SUCCESS;
+    }
+
+    for (i = 0; i < subscribers->element_count; i++) {
+        /* Skip agent 0, platform agent */
+        for (j = 1; j < subscribers->agent_count; j++) {
+            service_id_idx = (unsigned int)scmi_notification_service_idx(
+                j,
+                i,
+                operation_idx,
+                subscribers->agent_count,
+                subscribers->element_count);
+
+            service_id = subscribers->agent_service_ids[service_id_idx];
+
+            if (!fwk_id_is_equal(service_id, FWK_ID_NONE)) {
+                scmi_notify(
+                    service_id,
+                    (int)protocol_id,
+                    (int)scmi_response_id,
+                    payload_p2a,
+                    payload_size);
+            }
+        }
+    }
+
+    return FWK_SUCCESS;
+}
+
+static struct mod_scmi_notification_api mod_scmi_notif_api = {
+    .scmi_notification_init = scmi_notification_init,
+    .scmi_notification_add_subscriber = scmi_notification_add_subscriber,
+    .scmi_notification_remove_subscriber = scmi_notification_remove_subscriber,
+    .scmi_notification_notify = scmi_notification_notify,
+#    ifdef BUILD_HAS_SCMI_NOTIFICATION_COALESCING
+    .get_coalescing_stats = scmi_notification_get_coalescing_stats,
+#    endif
+};
+#endif
+
+#ifdef BUILD_HAS_SCMI_RATE_LIMIT
+/*
+ * Per-agent, per-protocol message rate limiting
+ */
+
+static struct scmi_rate_limit_ctx *scmi_rate_limit_get_bucket(
+    unsigned int agent_id,
+    uint8_t protocol_id)
+{
+    unsigned int i;
+    struct scmi_agent_rate_limit_ctx *agent_ctx;
+
+    if (agent_id > scmi_ctx.config->agent_count) {
+        return NULL;
+    }
+
+    agent_ctx = &scmi_ctx.agent_rate_limit_table[agent_id];
+    for (i = 0; i < agent_ctx->bucket_count; i++) {
+        if (agent_ctx->bucket_table[i].config->protocol_id == protocol_id) {
+            return &agent_ctx->bucket_table[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void scmi_rate_limit_refill(struct scmi_rate_limit_ctx *bucket)
+{
+    fwk_timestamp_t now;
+    fwk_duration_ns_t elapsed, time_to_full;
+    uint64_t rate = bucket->config->rate;
+
+    now = fwk_time_current();
+    elapsed = fwk_time_elapsed(bucket->last_refill, now);
+    bucket->last_refill = now;
+
+    if ((rate == 0) || (bucket->tokens >= bucket->capacity)) {
+        return;
+    }
+
+    time_to_full = ((bucket->capacity - bucket->tokens) + rate - 1) / rate;
+    if (elapsed >= time_to_full) {
+        bucket->tokens = bucket->capacity;
+    } else {
+        bucket->tokens += elapsed * rate;
+    }
+}
+
+/*
+ * Consume one token from the agent's bucket for the protocol. Return false if
+ * the message must be throttled.
+ */
+static bool scmi_rate_limit_consume(unsigned int agent_id, uint8_t protocol_id)
+{
+    struct scmi_rate_limit_ctx *bucket;
+
+    bucket = scmi_rate_limit_get_bucket(agent_id, protocol_id);
+    if (bucket == NULL) {
+        return true;
+    }
+
+    scmi_rate_limit_refill(bucket);
+
+    if (bucket->tokens < FWK_S(1)) {
+        bucket->stats.throttled_count++;
+        return false;
+    }
+
+    bucket->tokens -= FWK_S(1);
+    bucket->stats.accepted_count++;
+
+    return true;
+}
+
+static int scmi_rate_limit_init(const struct mod_scmi_config *config)
+{
+    unsigned int agent_idx, i;
+    const struct mod_scmi_agent *agent;
+    struct scmi_agent_rate_limit_ctx *agent_ctx;
+    struct scmi_rate_limit_ctx *bucket;
+    fwk_timestamp_t now = fwk_time_current();
+
+    scmi_ctx.agent_rate_limit_table = fwk_mm_calloc(
+        config->agent_count + 1u, sizeof(scmi_ctx.agent_rate_limit_table[0]));
+
+    for (agent_idx = MOD_SCMI_PLATFORM_ID + 1;
+         agent_idx <= config->agent_count;
+         agent_idx++) {
+        agent = &config->agent_table[agent_idx];
+        if (agent->rate_limit_count == 0) {
+            continue;
+        }
+
+        if (agent->rate_limit_table == NULL) {
+            return FWK_E_PARAM;
+        }
+
+        agent_ctx = &scmi_ctx.agent_rate_limit_table[agent_idx];
+        agent_ctx->bucket_count = agent->rate_limit_count;
+        agent_ctx->bucket_table = fwk_mm_calloc(
+            agent->rate_limit_count, sizeof(agent_ctx->bucket_table[0]));
+
+        for (i = 0; i < agent->rate_limit_count; i++) {
+            bucket = &agent_ctx->bucket_table[i];
+            bucket->config = &agent->rate_limit_table[i];
+            bucket->capacity =
+                FWK_MAX(bucket->config->burst, UINT32_C(1)) * FWK_S(1);
+            bucket->tokens = bucket->capacity;
+            bucket->last_refill = now;
+        }
+    }
+
+    return FWK_SUCCESS;
+}
+
+static int scmi_rate_limit_get_stats(
+    unsigned int agent_id,
+    uint8_t protocol_id,
+    struct mod_scmi_rate_limit_stats *stats)
+{
+    const struct scmi_rate_limit_ctx *bucket;
+
+    if ((stats == NULL) || (agent_id > scmi_ctx.config->agent_count)) {
+        return FWK_E_PARAM;
+    }
+
+    bucket = scmi_rate_limit_get_bucket(agent_id, protocol_id);
+    if (bucket == NULL) {
+        return FWK_E_RANGE;
+    }
+
+    *stats = bucket->stats;
+
+    return FWK_SUCCESS;
+}
+
+static int scmi_rate_limit_reset_stats(
+    unsigned int agent_id,
+    uint8_t protocol_id)
+{
+    struct scmi_rate_limit_ctx *bucket;
+
+    if (agent_id > scmi_ctx.config->agent_count) {
+        return FWK_E_PARAM;
+    }
+
+    bucket = scmi_rate_limit_get_bucket(agent_id, protocol_id);
+    if (bucket == NULL) {
+        return FWK_E_RANGE;
+    }
+
+    bucket->stats = (struct mod_scmi_rate_limit_stats){ 0 };
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_scmi_rate_limit_api scmi_rate_limit_api = {
+    .get_stats = scmi_rate_limit_get_stats,
+    .reset_stats = scmi_rate_limit_reset_stats,
+};
+#endif
+
+#ifdef BUILD_HAS_SCMI_FAIR_SCHEDULING
+/*
+ * Weighted round-robin message scheduling
+ */
+
+/* Scheduling classes in decreasing order of priority */
+static const enum mod_scmi_agent_qos_class scmi_sched_class_order[] = {
+    MOD_SCMI_AGENT_QOS_CLASS_HIGH,
+    MOD_SCMI_AGENT_QOS_CLASS_NORMAL,
+    MOD_SCMI_AGENT_QOS_CLASS_LOW,
+};
+
+static void scmi_sched_refill_credits(enum mod_scmi_agent_qos_class qos_class)
 {
-    int status;
-    unsigned int service_id_idx;
     unsigned int agent_idx;
+    struct scmi_agent_qos_ctx *agent_qos;
 
-    struct scmi_notification_subscribers *subscribers =
-        notification_subscribers(protocol_id);
-
-    status = get_agent_id(service_id, &agent_idx);
-    if (status != FWK_SUCCESS) {
-        return status;
+    for (agent_idx = 0; agent_idx <= scmi_ctx.config->agent_count;
+         agent_idx++) {
+        agent_qos = &scmi_ctx.agent_qos_table[agent_idx];
+        if (agent_qos->qos_class == qos_class) {
+            agent_qos->credits = agent_qos->weight;
+        }
     }
+}
 
-    fwk_assert(operation_id < MOD_SCMI_PROTOCOL_MAX_OPERATION_ID);
-    /*
-     * Initialize only if the entry is
-     * invalid (MOD_SCMI_PROTOCOL_OPERATION_IDX_INVALID)
-     */
-    if (subscribers->operation_id_to_idx[operation_id] ==
-        MOD_SCMI_PROTOCOL_OPERATION_IDX_INVALID) {
-        fwk_assert(subscribers->operation_idx < subscribers->operation_count);
-        subscribers->operation_id_to_idx[operation_id] =
-            (uint8_t)subscribers->operation_idx++;
-    }
+/*
+ * Search, starting from the service following the last dispatched one, for a
+ * pending service whose agent belongs to the given class and still has
+ * credits in the current round.
+ */
+static bool scmi_sched_find_in_class(
+    enum mod_scmi_agent_qos_class qos_class,
+    unsigned int *service_idx,
+    bool *class_has_pending)
+{
+    unsigned int i, idx;
+    struct scmi_service_ctx *ctx;
+    struct scmi_agent_qos_ctx *agent_qos;
 
-    service_id_idx = (unsigned int)scmi_notification_service_idx(
-        agent_idx,
-        element_idx,
-        subscribers->operation_id_to_idx[operation_id],
-        subscribers->agent_count,
-        subscribers->element_count);
+    for (i = 0; i < scmi_ctx.service_count; i++) {
+        idx = (scmi_ctx.next_service_idx + i) % scmi_ctx.service_count;
+        ctx = &scmi_ctx.service_ctx_table[idx];
+        if (!ctx->pending) {
+            continue;
+        }
 
-    subscribers->agent_service_ids[service_id_idx] = service_id;
+        agent_qos = &scmi_ctx.agent_qos_table[ctx->qos_agent_idx];
+        if (agent_qos->qos_class != qos_class) {
+            continue;
+        }
 
-    return FWK_SUCCESS;
+        *class_has_pending = true;
+        if (agent_qos->credits == 0) {
+            continue;
+        }
+
+        agent_qos->credits--;
+        *service_idx = idx;
+        return true;
+    }
+
+    return false;
 }
 
-static int scmi_notification_remove_subscriber(
-    unsigned int protocol_id,
-    unsigned int agent_idx,
-    unsigned int element_idx,
-    unsigned int operation_id)
+/*
+ * Select the next service to dispatch and clear its pending flag. Must be
+ * called with the interrupts disabled.
+ */
+static bool scmi_sched_pick_next(unsigned int *service_idx)
 {
-    unsigned int operation_idx = 0;
-    unsigned int service_id_idx;
+    unsigned int i;
+    bool class_has_pending;
+    enum mod_scmi_agent_qos_class qos_class;
+    struct scmi_service_ctx *ctx;
 
-    struct scmi_notification_subscribers *subscribers =
-        notification_subscribers(protocol_id);
+    if (scmi_ctx.pending_count == 0) {
+        return false;
+    }
 
-    fwk_assert(operation_id < MOD_SCMI_PROTOCOL_MAX_OPERATION_ID);
+    for (i = 0; i < FWK_ARRAY_SIZE(scmi_sched_class_order); i++) {
+        qos_class = scmi_sched_class_order[i];
+        class_has_pending = false;
 
-    operation_idx = subscribers->operation_id_to_idx[operation_id];
+        if (!scmi_sched_find_in_class(
+                qos_class, service_idx, &class_has_pending)) {
+            if (!class_has_pending) {
+                continue;
+            }
 
-    service_id_idx = (unsigned int)scmi_notification_service_idx(
-        agent_idx,
-        element_idx,
-        operation_idx,
-        subscribers->agent_count,
-        subscribers->element_count);
+            /* All agents with pending messages used up their credits */
+            scmi_sched_refill_credits(qos_class);
+            if (!scmi_sched_find_in_class(
+                    qos_class, service_idx, &class_has_pending)) {
+                continue;
+            }
+        }
 
-    subscribers->agent_service_ids[service_id_idx] = FWK_ID_NONE;
+        ctx = &scmi_ctx.service_ctx_table[*service_idx];
+        ctx->pending = false;
+        scmi_ctx.pending_count--;
+        scmi_ctx.next_service_idx =
+            (*service_idx + 1) % scmi_ctx.service_count;
 
-    return FWK_SUCCESS;
+        return true;
+    }
+
+    return false;
 }
 
-static int scmi_notification_notify(
-    unsigned int protocol_id,
-    unsigned int operation_id,
-    unsigned int scmi_response_id,
-    void *payload_p2a,
-    size_t payload_size)
+static void scmi_sched_update_stats(
+    struct scmi_agent_qos_ctx *agent_qos,
+    fwk_duration_us_t wait_time,
+    fwk_duration_us_t service_time)
 {
-    unsigned int i, j;
-    unsigned int operation_idx;
-    fwk_id_t service_id;
-    unsigned int service_id_idx;
-
-    struct scmi_notification_subscribers *subscribers =
-        notification_subscribers(protocol_id);
+    struct mod_scmi_agent_qos_stats *stats = &agent_qos->stats;
 
-    fwk_assert(operation_id < MOD_SCMI_PROTOCOL_MAX_OPERATION_ID);
-    operation_idx = subscribers->operation_id_to_idx[operation_id];
+    stats->message_count++;
+    stats->total_wait_time += wait_time;
+    stats->total_service_time += service_time;
+    stats->max_wait_time = FWK_MAX(stats->max_wait_time, wait_time);
+    stats->max_service_time = FWK_MAX(stats->max_service_time, service_time);
+}
 
-    /*
-     * Silently return FWK_SUCCESS if no valid operation_idx is found
-     * for a given operation_id. This is required in where(e.g. DVFS/perf)
-     * scmi_notification_notify gets called before a call to
-     * scmi_notification_add_subscriber.
-     */
-    if (operation_idx == MOD_SCMI_PROTOCOL_OPERATION_IDX_INVALID) {
-        return FWK_SUCCESS;
+static int scmi_qos_get_agent_stats(
+    unsigned int agent_id,
+    struct mod_scmi_agent_qos_stats *stats)
+{
+    if ((stats == NULL) || (agent_id > scmi_ctx.config->agent_count)) {
+        return FWK_E_PARAM;
     }
 
-    for (i = 0; i < subscribers->element_count; i++) {
-        /* Skip agent 0, platform agent */
-        for (j = 1; j < subscribers->agent_count; j++) {
-            service_id_idx = (unsigned int)scmi_notification_service_idx(
-                j,
-                i,
-                operation_idx,
-                subscribers->agent_count,
-                subscribers->element_count);
+    *stats = scmi_ctx.agent_qos_table[agent_id].stats;
 
-            service_id = subscribers->agent_service_ids[service_id_idx];
+    return FWK_SUCCESS;
+}
 
-            if (!fwk_id_is_equal(service_id, FWK_ID_NONE)) {
-                scmi_notify(
-                    service_id,
-                    (int)protocol_id,
-                    (int)scmi_response_id,
-                    payload_p2a,
-                    payload_size);
-            }
-        }
+static int scmi_qos_reset_agent_stats(unsigned int agent_id)
+{
+    if (agent_id > scmi_ctx.config->agent_count) {
+        return FWK_E_PARAM;
     }
 
+    scmi_ctx.agent_qos_table[agent_id].stats =
+        (struct mod_scmi_agent_qos_stats){ 0 };
+
     return FWK_SUCCESS;
 }
 
-static struct mod_scmi_notification_api mod_scmi_notif_api = {
-    .scmi_notification_init = scmi_notification_init,
-    .scmi_notification_add_subscriber = scmi_notification_add_subscriber,
-    .scmi_notification_remove_subscriber = scmi_notification_remove_subscriber,
-    .scmi_notification_notify = scmi_notification_notify,
+static const struct mod_scmi_qos_api scmi_qos_api = {
+    .get_agent_stats = scmi_qos_get_agent_stats,
+    .reset_agent_stats = scmi_qos_reset_agent_stats,
 };
 #endif
 
@@ -817,6 +2101,9 @@ static int scmi_init(fwk_id_t module_id, unsigned int service_count,
     struct mod_scmi_config *config = (struct mod_scmi_config *)data;
     unsigned int agent_idx;
     const struct mod_scmi_agent *agent;
+#ifdef BUILD_HAS_SCMI_RATE_LIMIT
+    int status;
+#endif
 
     if (config == NULL) {
         return FWK_E_PARAM;
@@ -854,6 +2141,44 @@ static int scmi_init(fwk_id_t module_id, unsigned int service_count,
     scmi_ctx.service_ctx_table = fwk_mm_calloc(
         service_count, sizeof(scmi_ctx.service_ctx_table[0]));
 
+    scmi_ctx.service_count = service_count;
+
+#ifdef BUILD_HAS_SCMI_FAIR_SCHEDULING
+    scmi_ctx.agent_qos_table = fwk_mm_calloc(
+        config->agent_count + 1u, sizeof(scmi_ctx.agent_qos_table[0]));
+
+    scmi_ctx.agent_qos_table[MOD_SCMI_PLATFORM_ID].qos_class =
+        MOD_SCMI_AGENT_QOS_CLASS_NORMAL;
+    scmi_ctx.agent_qos_table[MOD_SCMI_PLATFORM_ID].weight = 1;
+    for (agent_idx = MOD_SCMI_PLATFORM_ID + 1;
+         agent_idx <= config->agent_count;
+         agent_idx++) {
+        agent = &config->agent_table[agent_idx];
+        if (agent->qos_class >= MOD_SCMI_AGENT_QOS_CLASS_COUNT) {
+            return FWK_E_PARAM;
+        }
+
+        scmi_ctx.agent_qos_table[agent_idx].qos_class = agent->qos_class;
+        scmi_ctx.agent_qos_table[agent_idx].weight =
+            FWK_MAX(agent->qos_weight, 1u);
+    }
+#endif
+
+#ifdef BUILD_HAS_SCMI_RATE_LIMIT
+    status = scmi_rate_limit_init(config);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+#endif
+
+#ifdef BUILD_HAS_SCMI_LATENCY_STATS
+    if (config->latency_stats_count != 0) {
+        scmi_ctx.latency_stats_table = fwk_mm_calloc(
+            config->latency_stats_count,
+            sizeof(scmi_ctx.latency_stats_table[0]));
+    }
+#endif
+
 #ifdef BUILD_HAS_BASE_PROTOCOL
     scmi_ctx.protocol_table[PROTOCOL_TABLE_BASE_PROTOCOL_IDX].message_handler =
         scmi_base_message_handler;
@@ -873,6 +2198,9 @@ static int scmi_service_init(fwk_id_t service_id, unsigned int unused,
     const struct mod_scmi_service_config *config =
         (struct mod_scmi_service_config *)data;
     struct scmi_service_ctx *ctx;
+#ifdef BUILD_HAS_SCMI_NOTIFICATION_COALESCING
+    struct scmi_service_ctx *p2a_ctx;
+#endif
 
     if (((config->scmi_agent_id == MOD_SCMI_PLATFORM_ID) ||
          (config->scmi_agent_id > scmi_ctx.config->agent_count)) &&
@@ -883,6 +2211,41 @@ static int scmi_service_init(fwk_id_t service_id, unsigned int unused,
     ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(service_id)];
     ctx->config = config;
 
+#ifdef BUILD_HAS_SCMI_FAIR_SCHEDULING
+    /*
+     * Services used by the platform as an SCMI agent are not bound to any of
+     * the agents of the system and share the default scheduling context.
+     */
+    if ((config->scmi_entity_role == MOD_SCMI_ROLE_PLATFORM) &&
+        (config->scmi_agent_id <= scmi_ctx.config->agent_count)) {
+        ctx->qos_agent_idx = config->scmi_agent_id;
+    } else {
+        ctx->qos_agent_idx = MOD_SCMI_PLATFORM_ID;
+    }
+#endif
+
+#ifdef BUILD_HAS_SCMI_NOTIFICATION_COALESCING
+    /* Hold back the notifications sent while the P2A channel is busy */
+    if (!fwk_id_is_equal(config->scmi_p2a_id, FWK_ID_NONE) &&
+        (scmi_ctx.config->notification_pending_count != 0)) {
+        p2a_ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(
+            config->scmi_p2a_id)];
+        if (p2a_ctx->notification_pending_table == NULL) {
+            p2a_ctx->notification_pending_table = fwk_mm_calloc(
+                scmi_ctx.config->notification_pending_count,
+                sizeof(p2a_ctx->notification_pending_table[0]));
+        }
+    }
+#endif
+
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+    if ((config->scmi_entity_role == MOD_SCMI_ROLE_AGENT) &&
+        (config->request_queue_length != 0)) {
+        ctx->request_queue = fwk_mm_calloc(
+            config->request_queue_length, sizeof(ctx->request_queue[0]));
+    }
+#endif
+
     return FWK_SUCCESS;
 }
 
@@ -898,6 +2261,18 @@ static int scmi_bind(fwk_id_t id, unsigned int round)
 
     if (round == 0) {
         if (fwk_id_is_type(id, FWK_ID_TYPE_MODULE)) {
+#ifdef BUILD_HAS_SCMI_NOTIFICATION_COALESCING
+            if (scmi_ctx.config->notification_flush_retry_ms != 0) {
+#    ifdef BUILD_HAS_MOD_TIMER
+                return fwk_module_bind(
+                    scmi_ctx.config->notification_flush_alarm_id,
+                    MOD_TIMER_API_ID_ALARM,
+                    &scmi_ctx.notification_flush_alarm_api);
+#    else
+                return FWK_E_PANIC;
+#    endif
+            }
+#endif
             return FWK_SUCCESS;
         }
 
@@ -921,6 +2296,20 @@ static int scmi_bind(fwk_id_t id, unsigned int round)
         ctx->respond = transport_api->respond;
         ctx->transmit = transport_api->transmit;
 
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+        if ((ctx->request_queue != NULL) &&
+            (ctx->config->request_timeout_ms != 0)) {
+#    ifdef BUILD_HAS_MOD_TIMER
+            return fwk_module_bind(
+                ctx->config->request_timeout_alarm_id,
+                MOD_TIMER_API_ID_ALARM,
+                &ctx->request_timeout_alarm_api);
+#    else
+            return FWK_E_PANIC;
+#    endif
+        }
+#endif
+
         return FWK_SUCCESS;
     }
 
@@ -1061,6 +2450,24 @@ static int scmi_process_bind_request(fwk_id_t source_id, fwk_id_t target_id,
         break;
 #endif
 
+#ifdef BUILD_HAS_SCMI_FAIR_SCHEDULING
+    case MOD_SCMI_API_IDX_QOS:
+        *api = &scmi_qos_api;
+        break;
+#endif
+
+#ifdef BUILD_HAS_SCMI_RATE_LIMIT
+    case MOD_SCMI_API_IDX_RATE_LIMIT:
+        *api = &scmi_rate_limit_api;
+        break;
+#endif
+
+#ifdef BUILD_HAS_SCMI_LATENCY_STATS
+    case MOD_SCMI_API_IDX_LATENCY_STATS:
+        *api = &scmi_latency_stats_api;
+        break;
+#endif
+
     default:
         return FWK_E_SUPPORT;
     };
@@ -1068,8 +2475,7 @@ static int scmi_process_bind_request(fwk_id_t source_id, fwk_id_t target_id,
     return FWK_SUCCESS;
 }
 
-static int scmi_process_event(const struct fwk_event *event,
-                              struct fwk_event *resp)
+static int scmi_process_message(const struct fwk_event *event)
 {
     int status;
     struct scmi_service_ctx *ctx;
@@ -1121,6 +2527,11 @@ static int scmi_process_event(const struct fwk_event *event,
     ctx->scmi_token = read_token(message_header);
     message_type_name = get_message_type_str(ctx);
 
+#ifdef BUILD_HAS_SCMI_LATENCY_STATS
+    /* Until the protocol writes the status of the response */
+    ctx->response_status = SCMI_GENERIC_ERROR;
+#endif
+
 #if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_DEBUG
     FWK_LOG_DEBUG(
         "[SCMI] %s: %s [%" PRIu16 " (0x%x:0x%x)] was received",
@@ -1135,6 +2546,9 @@ static int scmi_process_event(const struct fwk_event *event,
 #endif
 
     if (!is_message_type_valid(ctx)) {
+#ifdef BUILD_HAS_SCMI_LATENCY_STATS
+        scmi_latency_stats_record(ctx, SCMI_PROTOCOL_ERROR);
+#endif
         status = ctx->respond(
             transport_id, &(int32_t){ SCMI_PROTOCOL_ERROR }, sizeof(int32_t));
         if (status != FWK_SUCCESS) {
@@ -1157,6 +2571,9 @@ static int scmi_process_event(const struct fwk_event *event,
                 ctx->scmi_token,
                 ctx->scmi_protocol_id,
                 ctx->scmi_message_id);
+#endif
+#ifdef BUILD_HAS_SCMI_LATENCY_STATS
+            scmi_latency_stats_record(ctx, SCMI_NOT_SUPPORTED);
 #endif
             status = ctx->respond(
                 transport_id,
@@ -1205,6 +2622,9 @@ static int scmi_process_event(const struct fwk_event *event,
                     ctx->scmi_token,
                     ctx->scmi_protocol_id,
                     ctx->scmi_message_id);
+#    endif
+#    ifdef BUILD_HAS_SCMI_LATENCY_STATS
+                scmi_latency_stats_record(ctx, SCMI_DENIED);
 #    endif
                 status = ctx->respond(
                     transport_id, &(int32_t){ SCMI_DENIED }, sizeof(int32_t));
@@ -1215,9 +2635,48 @@ static int scmi_process_event(const struct fwk_event *event,
             }
         }
     }
+#endif
+#ifdef BUILD_HAS_SCMI_RATE_LIMIT
+    if (!scmi_rate_limit_consume(
+            ctx->config->scmi_agent_id, (uint8_t)ctx->scmi_protocol_id)) {
+#    if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_DEBUG
+        FWK_LOG_DEBUG(
+            "[SCMI] %s: %s [%" PRIu16 "(0x%x:0x%x)] throttled",
+            service_name,
+            message_type_name,
+            ctx->scmi_token,
+            ctx->scmi_protocol_id,
+            ctx->scmi_message_id);
+#    endif
+#    ifdef BUILD_HAS_SCMI_LATENCY_STATS
+        scmi_latency_stats_record(ctx, SCMI_BUSY);
+#    endif
+        status = ctx->respond(
+            transport_id, &(int32_t){ SCMI_BUSY }, sizeof(int32_t));
+        if (status != FWK_SUCCESS) {
+            FWK_LOG_DEBUG("[SCMI] %s @%d", __func__, __LINE__);
+        }
+        return FWK_SUCCESS;
+    }
 #endif
     protocol = &scmi_ctx.protocol_table[protocol_idx];
     } else if (ctx->config->scmi_entity_role == MOD_SCMI_ROLE_AGENT) {
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+        if ((ctx->scmi_message_type == MOD_SCMI_MESSAGE_TYPE_COMMAND) &&
+            !scmi_request_match_response(ctx)) {
+#    if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_ERROR
+            FWK_LOG_ERR(
+                "[SCMI] %s: %s [%" PRIu16 " (0x%x:0x%x)] Unexpected response",
+                service_name,
+                message_type_name,
+                ctx->scmi_token,
+                ctx->scmi_protocol_id,
+                ctx->scmi_message_id);
+#    endif
+            return ctx->transport_api->release_transport_channel_lock(
+                transport_id);
+        }
+#endif
         protocol_idx =
             scmi_ctx.scmi_protocol_requester_id_to_idx[ctx->scmi_protocol_id];
         protocol = &scmi_ctx.protocol_requester_table[protocol_idx];
@@ -1238,6 +2697,15 @@ static int scmi_process_event(const struct fwk_event *event,
             ctx->scmi_protocol_id,
             ctx->scmi_message_id,
             fwk_status_str(status));
+#endif
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+        /* Do not hold back the queued requests on a failed response */
+        if (ctx->config->scmi_entity_role == MOD_SCMI_ROLE_AGENT) {
+            if (ctx->transport_api->release_transport_channel_lock(
+                    transport_id) == FWK_SUCCESS) {
+                scmi_request_send_next(ctx);
+            }
+        }
 #endif
         return FWK_SUCCESS;
     }
@@ -1263,11 +2731,99 @@ static int scmi_process_event(const struct fwk_event *event,
 #endif
             return FWK_SUCCESS;
         }
+
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+        /* The response has been consumed, send the next queued request */
+        scmi_request_send_next(ctx);
+#endif
     }
 
     return FWK_SUCCESS;
 }
 
+#ifdef BUILD_HAS_SCMI_FAIR_SCHEDULING
+static int scmi_dispatch(void)
+{
+    int status;
+    unsigned int flags;
+    unsigned int service_idx;
+    bool picked;
+    struct scmi_service_ctx *ctx;
+    fwk_timestamp_t signal_timestamp = 0;
+    fwk_timestamp_t start_timestamp;
+    fwk_duration_us_t wait_time, service_time;
+    struct fwk_event message_event;
+
+    flags = fwk_interrupt_global_disable();
+    scmi_ctx.dispatch_queued = false;
+    picked = scmi_sched_pick_next(&service_idx);
+    if (picked) {
+        signal_timestamp =
+            scmi_ctx.service_ctx_table[service_idx].signal_timestamp;
+    }
+    fwk_interrupt_global_enable(flags);
+
+    if (!picked) {
+        return FWK_SUCCESS;
+    }
+
+    ctx = &scmi_ctx.service_ctx_table[service_idx];
+    message_event = (struct fwk_event){
+        .id = FWK_ID_EVENT(FWK_MODULE_IDX_SCMI, SCMI_EVENT_IDX_MESSAGE),
+        .source_id = FWK_ID_MODULE(FWK_MODULE_IDX_SCMI),
+        .target_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_SCMI, service_idx),
+    };
+
+    start_timestamp = fwk_time_current();
+    status = scmi_process_message(&message_event);
+
+    wait_time = fwk_time_duration_us(
+        fwk_time_elapsed(signal_timestamp, start_timestamp));
+    service_time = fwk_time_duration_us(
+        fwk_time_elapsed(start_timestamp, fwk_time_current()));
+    scmi_sched_update_stats(
+        &scmi_ctx.agent_qos_table[ctx->qos_agent_idx], wait_time, service_time);
+
+    /* Keep dispatching while other messages are waiting */
+    flags = fwk_interrupt_global_disable();
+    if (scmi_sched_queue_dispatch() != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[SCMI] %s @%d", __func__, __LINE__);
+    }
+    fwk_interrupt_global_enable(flags);
+
+    return status;
+}
+#endif
+
+static int scmi_process_event(
+    const struct fwk_event *event,
+    struct fwk_event *resp)
+{
+#ifdef BUILD_HAS_SCMI_FAIR_SCHEDULING
+    if (fwk_id_get_event_idx(event->id) == SCMI_EVENT_IDX_DISPATCH) {
+        return scmi_dispatch();
+    }
+#endif
+
+#ifdef BUILD_HAS_SCMI_NOTIFICATION_COALESCING
+    if (fwk_id_get_event_idx(event->id) == SCMI_EVENT_IDX_NOTIFICATION_ACK) {
+        return scmi_notification_process_ack(event);
+    }
+
+    if (fwk_id_get_event_idx(event->id) == SCMI_EVENT_IDX_NOTIFICATION_FLUSH) {
+        return scmi_notification_process_flush();
+    }
+#endif
+
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+    if (fwk_id_get_event_idx(event->id) == SCMI_EVENT_IDX_REQUEST_TIMEOUT) {
+        return scmi_request_process_timeout(event);
+    }
+#endif
+
+    return scmi_process_message(event);
+}
+
 static int scmi_start(fwk_id_t id)
 {
 #ifdef BUILD_HAS_NOTIFICATION
@@ -1337,7 +2893,7 @@ static int scmi_process_notification(const struct fwk_event *event,
 /* SCMI module definition */
 const struct fwk_module module_scmi = {
     .api_count = (unsigned int)MOD_SCMI_API_IDX_COUNT,
-    .event_count = 1,
+    .event_count = (unsigned int)SCMI_EVENT_IDX_COUNT,
 #ifdef BUILD_HAS_NOTIFICATION
     .notification_count = (unsigned int)MOD_SCMI_NOTIFICATION_IDX_COUNT,
 #endif
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2020-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2020-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -12,10 +12,14 @@
 
 enum fwk_module_idx {
     FWK_MODULE_IDX_SCMI,
+    FWK_MODULE_IDX_TIMER,
     FWK_MODULE_IDX_COUNT,
 };
 
 static const fwk_id_t fwk_module_id_scmi =
     FWK_ID_MODULE_INIT(FWK_MODULE_IDX_SCMI);
 
+static const fwk_id_t fwk_module_id_timer =
+    FWK_ID_MODULE_INIT(FWK_MODULE_IDX_TIMER);
+
 #endif /* TEST_FWK_MODULE_MODULE_IDX_H */
@@ -25,6 +25,8 @@ static const char* CMockString_mod_scmi_to_transport_api_get_message_header = "m
 static const char* CMockString_mod_scmi_to_transport_api_get_payload = "mod_scmi_to_transport_api_get_payload";
 static const char* CMockString_mod_scmi_to_transport_api_get_secure = "mod_scmi_to_transport_api_get_secure";
 static const char* CMockString_mod_scmi_to_transport_api_release_transport_channel_lock = "mod_scmi_to_transport_api_release_transport_channel_lock";
+static const char* CMockString_mod_scmi_to_transport_api_defer_message = "mod_scmi_to_transport_api_defer_message";
+static const char* CMockString_mod_scmi_to_transport_api_resume_message = "mod_scmi_to_transport_api_resume_message";
 static const char* CMockString_mod_scmi_to_transport_api_respond = "mod_scmi_to_transport_api_respond";
 static const char* CMockString_mod_scmi_to_transport_api_transmit = "mod_scmi_to_transport_api_transmit";
 static const char* CMockString_mod_scmi_to_transport_api_write_payload = "mod_scmi_to_transport_api_write_payload";
@@ -174,6 +176,28 @@ typedef struct _CMOCK_mod_scmi_to_transport_api_release_transport_channel_lock_C
 
 } CMOCK_mod_scmi_to_transport_api_release_transport_channel_lock_CALL_INSTANCE;
 
+typedef struct _CMOCK_mod_scmi_to_transport_api_defer_message_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  char ExpectAnyArgsBool;
+  int ReturnVal;
+  fwk_id_t Expected_channel_id;
+  char IgnoreArg_channel_id;
+
+} CMOCK_mod_scmi_to_transport_api_defer_message_CALL_INSTANCE;
+
+typedef struct _CMOCK_mod_scmi_to_transport_api_resume_message_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  char ExpectAnyArgsBool;
+  int ReturnVal;
+  fwk_id_t Expected_channel_id;
+  char IgnoreArg_channel_id;
+  uint32_t Expected_token;
+  char IgnoreArg_token;
+
+} CMOCK_mod_scmi_to_transport_api_resume_message_CALL_INSTANCE;
+
 typedef struct _CMOCK_mod_scmi_from_protocol_get_agent_count_CALL_INSTANCE
 {
   UNITY_LINE_TYPE LineNumber;
@@ -421,6 +445,18 @@ static struct Mockmod_scmi_extraInstance
   CMOCK_mod_scmi_to_transport_api_release_transport_channel_lock_CALLBACK mod_scmi_to_transport_api_release_transport_channel_lock_CallbackFunctionPointer;
   int mod_scmi_to_transport_api_release_transport_channel_lock_CallbackCalls;
   CMOCK_MEM_INDEX_TYPE mod_scmi_to_transport_api_release_transport_channel_lock_CallInstance;
+  char mod_scmi_to_transport_api_defer_message_IgnoreBool;
+  int mod_scmi_to_transport_api_defer_message_FinalReturn;
+  char mod_scmi_to_transport_api_defer_message_CallbackBool;
+  CMOCK_mod_scmi_to_transport_api_defer_message_CALLBACK mod_scmi_to_transport_api_defer_message_CallbackFunctionPointer;
+  int mod_scmi_to_transport_api_defer_message_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE mod_scmi_to_transport_api_defer_message_CallInstance;
+  char mod_scmi_to_transport_api_resume_message_IgnoreBool;
+  int mod_scmi_to_transport_api_resume_message_FinalReturn;
+  char mod_scmi_to_transport_api_resume_message_CallbackBool;
+  CMOCK_mod_scmi_to_transport_api_resume_message_CALLBACK mod_scmi_to_transport_api_resume_message_CallbackFunctionPointer;
+  int mod_scmi_to_transport_api_resume_message_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE mod_scmi_to_transport_api_resume_message_CallInstance;
   char mod_scmi_from_protocol_get_agent_count_IgnoreBool;
   int mod_scmi_from_protocol_get_agent_count_FinalReturn;
   char mod_scmi_from_protocol_get_agent_count_CallbackBool;
@@ -604,6 +640,32 @@ void Mockmod_scmi_extra_Verify(void)
     call_instance = CMOCK_GUTS_NONE;
     (void)call_instance;
   }
+  call_instance = Mock.mod_scmi_to_transport_api_defer_message_CallInstance;
+  if (Mock.mod_scmi_to_transport_api_defer_message_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_mod_scmi_to_transport_api_defer_message);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.mod_scmi_to_transport_api_defer_message_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.mod_scmi_to_transport_api_resume_message_CallInstance;
+  if (Mock.mod_scmi_to_transport_api_resume_message_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_mod_scmi_to_transport_api_resume_message);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.mod_scmi_to_transport_api_resume_message_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
   call_instance = Mock.mod_scmi_from_protocol_get_agent_count_CallInstance;
   if (Mock.mod_scmi_from_protocol_get_agent_count_IgnoreBool)
     call_instance = CMOCK_GUTS_NONE;
@@ -2124,6 +2186,249 @@ void mod_scmi_to_transport_api_release_transport_channel_lock_CMockIgnoreArg_cha
   cmock_call_instance->IgnoreArg_channel_id = 1;
 }
 
+int mod_scmi_to_transport_api_defer_message(fwk_id_t channel_id)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_mod_scmi_to_transport_api_defer_message_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_mod_scmi_to_transport_api_defer_message);
+  cmock_call_instance = (CMOCK_mod_scmi_to_transport_api_defer_message_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.mod_scmi_to_transport_api_defer_message_CallInstance);
+  Mock.mod_scmi_to_transport_api_defer_message_CallInstance = CMock_Guts_MemNext(Mock.mod_scmi_to_transport_api_defer_message_CallInstance);
+  if (Mock.mod_scmi_to_transport_api_defer_message_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.mod_scmi_to_transport_api_defer_message_FinalReturn;
+    Mock.mod_scmi_to_transport_api_defer_message_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.mod_scmi_to_transport_api_defer_message_CallbackBool &&
+      Mock.mod_scmi_to_transport_api_defer_message_CallbackFunctionPointer != NULL)
+  {
+    int cmock_cb_ret = Mock.mod_scmi_to_transport_api_defer_message_CallbackFunctionPointer(channel_id, Mock.mod_scmi_to_transport_api_defer_message_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (!cmock_call_instance->ExpectAnyArgsBool)
+  {
+  if (!cmock_call_instance->IgnoreArg_channel_id)
+  {
+    UNITY_SET_DETAILS(CMockString_mod_scmi_to_transport_api_defer_message,CMockString_channel_id);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_channel_id), (void*)(&channel_id), sizeof(fwk_id_t), cmock_line, CMockStringMismatch);
+  }
+  }
+  if (Mock.mod_scmi_to_transport_api_defer_message_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.mod_scmi_to_transport_api_defer_message_CallbackFunctionPointer(channel_id, Mock.mod_scmi_to_transport_api_defer_message_CallbackCalls++);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_mod_scmi_to_transport_api_defer_message(CMOCK_mod_scmi_to_transport_api_defer_message_CALL_INSTANCE* cmock_call_instance, fwk_id_t channel_id);
+void CMockExpectParameters_mod_scmi_to_transport_api_defer_message(CMOCK_mod_scmi_to_transport_api_defer_message_CALL_INSTANCE* cmock_call_instance, fwk_id_t channel_id)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_channel_id), (void*)(&channel_id),
+         sizeof(fwk_id_t[sizeof(channel_id) == sizeof(fwk_id_t) ? 1 : -1])); /* add fwk_id_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_channel_id = 0;
+}
+
+void mod_scmi_to_transport_api_defer_message_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mod_scmi_to_transport_api_defer_message_CALL_INSTANCE));
+  CMOCK_mod_scmi_to_transport_api_defer_message_CALL_INSTANCE* cmock_call_instance = (CMOCK_mod_scmi_to_transport_api_defer_message_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mod_scmi_to_transport_api_defer_message_CallInstance = CMock_Guts_MemChain(Mock.mod_scmi_to_transport_api_defer_message_CallInstance, cmock_guts_index);
+  Mock.mod_scmi_to_transport_api_defer_message_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.mod_scmi_to_transport_api_defer_message_IgnoreBool = (char)1;
+}
+
+void mod_scmi_to_transport_api_defer_message_CMockStopIgnore(void)
+{
+  if(Mock.mod_scmi_to_transport_api_defer_message_IgnoreBool)
+    Mock.mod_scmi_to_transport_api_defer_message_CallInstance = CMock_Guts_MemNext(Mock.mod_scmi_to_transport_api_defer_message_CallInstance);
+  Mock.mod_scmi_to_transport_api_defer_message_IgnoreBool = (char)0;
+}
+
+void mod_scmi_to_transport_api_defer_message_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mod_scmi_to_transport_api_defer_message_CALL_INSTANCE));
+  CMOCK_mod_scmi_to_transport_api_defer_message_CALL_INSTANCE* cmock_call_instance = (CMOCK_mod_scmi_to_transport_api_defer_message_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mod_scmi_to_transport_api_defer_message_CallInstance = CMock_Guts_MemChain(Mock.mod_scmi_to_transport_api_defer_message_CallInstance, cmock_guts_index);
+  Mock.mod_scmi_to_transport_api_defer_message_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  cmock_call_instance->ExpectAnyArgsBool = (char)1;
+}
+
+void mod_scmi_to_transport_api_defer_message_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t channel_id, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mod_scmi_to_transport_api_defer_message_CALL_INSTANCE));
+  CMOCK_mod_scmi_to_transport_api_defer_message_CALL_INSTANCE* cmock_call_instance = (CMOCK_mod_scmi_to_transport_api_defer_message_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mod_scmi_to_transport_api_defer_message_CallInstance = CMock_Guts_MemChain(Mock.mod_scmi_to_transport_api_defer_message_CallInstance, cmock_guts_index);
+  Mock.mod_scmi_to_transport_api_defer_message_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  CMockExpectParameters_mod_scmi_to_transport_api_defer_message(cmock_call_instance, channel_id);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void mod_scmi_to_transport_api_defer_message_AddCallback(CMOCK_mod_scmi_to_transport_api_defer_message_CALLBACK Callback)
+{
+  Mock.mod_scmi_to_transport_api_defer_message_IgnoreBool = (char)0;
+  Mock.mod_scmi_to_transport_api_defer_message_CallbackBool = (char)1;
+  Mock.mod_scmi_to_transport_api_defer_message_CallbackFunctionPointer = Callback;
+}
+
+void mod_scmi_to_transport_api_defer_message_Stub(CMOCK_mod_scmi_to_transport_api_defer_message_CALLBACK Callback)
+{
+  Mock.mod_scmi_to_transport_api_defer_message_IgnoreBool = (char)0;
+  Mock.mod_scmi_to_transport_api_defer_message_CallbackBool = (char)0;
+  Mock.mod_scmi_to_transport_api_defer_message_CallbackFunctionPointer = Callback;
+}
+
+void mod_scmi_to_transport_api_defer_message_CMockIgnoreArg_channel_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_mod_scmi_to_transport_api_defer_message_CALL_INSTANCE* cmock_call_instance = (CMOCK_mod_scmi_to_transport_api_defer_message_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.mod_scmi_to_transport_api_defer_message_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_channel_id = 1;
+}
+
+int mod_scmi_to_transport_api_resume_message(fwk_id_t channel_id, uint32_t token)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_mod_scmi_to_transport_api_resume_message_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_mod_scmi_to_transport_api_resume_message);
+  cmock_call_instance = (CMOCK_mod_scmi_to_transport_api_resume_message_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.mod_scmi_to_transport_api_resume_message_CallInstance);
+  Mock.mod_scmi_to_transport_api_resume_message_CallInstance = CMock_Guts_MemNext(Mock.mod_scmi_to_transport_api_resume_message_CallInstance);
+  if (Mock.mod_scmi_to_transport_api_resume_message_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.mod_scmi_to_transport_api_resume_message_FinalReturn;
+    Mock.mod_scmi_to_transport_api_resume_message_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.mod_scmi_to_transport_api_resume_message_CallbackBool &&
+      Mock.mod_scmi_to_transport_api_resume_message_CallbackFunctionPointer != NULL)
+  {
+    int cmock_cb_ret = Mock.mod_scmi_to_transport_api_resume_message_CallbackFunctionPointer(channel_id, token, Mock.mod_scmi_to_transport_api_resume_message_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (!cmock_call_instance->ExpectAnyArgsBool)
+  {
+  if (!cmock_call_instance->IgnoreArg_channel_id)
+  {
+    UNITY_SET_DETAILS(CMockString_mod_scmi_to_transport_api_resume_message,CMockString_channel_id);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_channel_id), (void*)(&channel_id), sizeof(fwk_id_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_token)
+  {
+    UNITY_SET_DETAILS(CMockString_mod_scmi_to_transport_api_resume_message,CMockString_token);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_token, token, cmock_line, CMockStringMismatch);
+  }
+  }
+  if (Mock.mod_scmi_to_transport_api_resume_message_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.mod_scmi_to_transport_api_resume_message_CallbackFunctionPointer(channel_id, token, Mock.mod_scmi_to_transport_api_resume_message_CallbackCalls++);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_mod_scmi_to_transport_api_resume_message(CMOCK_mod_scmi_to_transport_api_resume_message_CALL_INSTANCE* cmock_call_instance, fwk_id_t channel_id, uint32_t token);
+void CMockExpectParameters_mod_scmi_to_transport_api_resume_message(CMOCK_mod_scmi_to_transport_api_resume_message_CALL_INSTANCE* cmock_call_instance, fwk_id_t channel_id, uint32_t token)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_channel_id), (void*)(&channel_id),
+         sizeof(fwk_id_t[sizeof(channel_id) == sizeof(fwk_id_t) ? 1 : -1])); /* add fwk_id_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_channel_id = 0;
+  cmock_call_instance->Expected_token = token;
+  cmock_call_instance->IgnoreArg_token = 0;
+}
+
+void mod_scmi_to_transport_api_resume_message_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mod_scmi_to_transport_api_resume_message_CALL_INSTANCE));
+  CMOCK_mod_scmi_to_transport_api_resume_message_CALL_INSTANCE* cmock_call_instance = (CMOCK_mod_scmi_to_transport_api_resume_message_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mod_scmi_to_transport_api_resume_message_CallInstance = CMock_Guts_MemChain(Mock.mod_scmi_to_transport_api_resume_message_CallInstance, cmock_guts_index);
+  Mock.mod_scmi_to_transport_api_resume_message_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.mod_scmi_to_transport_api_resume_message_IgnoreBool = (char)1;
+}
+
+void mod_scmi_to_transport_api_resume_message_CMockStopIgnore(void)
+{
+  if(Mock.mod_scmi_to_transport_api_resume_message_IgnoreBool)
+    Mock.mod_scmi_to_transport_api_resume_message_CallInstance = CMock_Guts_MemNext(Mock.mod_scmi_to_transport_api_resume_message_CallInstance);
+  Mock.mod_scmi_to_transport_api_resume_message_IgnoreBool = (char)0;
+}
+
+void mod_scmi_to_transport_api_resume_message_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mod_scmi_to_transport_api_resume_message_CALL_INSTANCE));
+  CMOCK_mod_scmi_to_transport_api_resume_message_CALL_INSTANCE* cmock_call_instance = (CMOCK_mod_scmi_to_transport_api_resume_message_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mod_scmi_to_transport_api_resume_message_CallInstance = CMock_Guts_MemChain(Mock.mod_scmi_to_transport_api_resume_message_CallInstance, cmock_guts_index);
+  Mock.mod_scmi_to_transport_api_resume_message_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  cmock_call_instance->ExpectAnyArgsBool = (char)1;
+}
+
+void mod_scmi_to_transport_api_resume_message_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t channel_id, uint32_t token, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mod_scmi_to_transport_api_resume_message_CALL_INSTANCE));
+  CMOCK_mod_scmi_to_transport_api_resume_message_CALL_INSTANCE* cmock_call_instance = (CMOCK_mod_scmi_to_transport_api_resume_message_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mod_scmi_to_transport_api_resume_message_CallInstance = CMock_Guts_MemChain(Mock.mod_scmi_to_transport_api_resume_message_CallInstance, cmock_guts_index);
+  Mock.mod_scmi_to_transport_api_resume_message_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  CMockExpectParameters_mod_scmi_to_transport_api_resume_message(cmock_call_instance, channel_id, token);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void mod_scmi_to_transport_api_resume_message_AddCallback(CMOCK_mod_scmi_to_transport_api_resume_message_CALLBACK Callback)
+{
+  Mock.mod_scmi_to_transport_api_resume_message_IgnoreBool = (char)0;
+  Mock.mod_scmi_to_transport_api_resume_message_CallbackBool = (char)1;
+  Mock.mod_scmi_to_transport_api_resume_message_CallbackFunctionPointer = Callback;
+}
+
+void mod_scmi_to_transport_api_resume_message_Stub(CMOCK_mod_scmi_to_transport_api_resume_message_CALLBACK Callback)
+{
+  Mock.mod_scmi_to_transport_api_resume_message_IgnoreBool = (char)0;
+  Mock.mod_scmi_to_transport_api_resume_message_CallbackBool = (char)0;
+  Mock.mod_scmi_to_transport_api_resume_message_CallbackFunctionPointer = Callback;
+}
+
+void mod_scmi_to_transport_api_resume_message_CMockIgnoreArg_channel_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_mod_scmi_to_transport_api_resume_message_CALL_INSTANCE* cmock_call_instance = (CMOCK_mod_scmi_to_transport_api_resume_message_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.mod_scmi_to_transport_api_resume_message_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_channel_id = 1;
+}
+
 int mod_scmi_from_protocol_get_agent_count(unsigned int* agent_count)
 {
   UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
@@ -198,6 +198,34 @@ void mod_scmi_to_transport_api_release_transport_channel_lock_Stub(CMOCK_mod_scm
 #define mod_scmi_to_transport_api_release_transport_channel_lock_StubWithCallback mod_scmi_to_transport_api_release_transport_channel_lock_Stub
 #define mod_scmi_to_transport_api_release_transport_channel_lock_IgnoreArg_channel_id() mod_scmi_to_transport_api_release_transport_channel_lock_CMockIgnoreArg_channel_id(__LINE__)
 void mod_scmi_to_transport_api_release_transport_channel_lock_CMockIgnoreArg_channel_id(UNITY_LINE_TYPE cmock_line);
+#define mod_scmi_to_transport_api_defer_message_IgnoreAndReturn(cmock_retval) mod_scmi_to_transport_api_defer_message_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void mod_scmi_to_transport_api_defer_message_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define mod_scmi_to_transport_api_defer_message_StopIgnore() mod_scmi_to_transport_api_defer_message_CMockStopIgnore()
+void mod_scmi_to_transport_api_defer_message_CMockStopIgnore(void);
+#define mod_scmi_to_transport_api_defer_message_ExpectAnyArgsAndReturn(cmock_retval) mod_scmi_to_transport_api_defer_message_CMockExpectAnyArgsAndReturn(__LINE__, cmock_retval)
+void mod_scmi_to_transport_api_defer_message_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define mod_scmi_to_transport_api_defer_message_ExpectAndReturn(channel_id, cmock_retval) mod_scmi_to_transport_api_defer_message_CMockExpectAndReturn(__LINE__, channel_id, cmock_retval)
+void mod_scmi_to_transport_api_defer_message_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t channel_id, int cmock_to_return);
+typedef int (* CMOCK_mod_scmi_to_transport_api_defer_message_CALLBACK)(fwk_id_t channel_id, int cmock_num_calls);
+void mod_scmi_to_transport_api_defer_message_AddCallback(CMOCK_mod_scmi_to_transport_api_defer_message_CALLBACK Callback);
+void mod_scmi_to_transport_api_defer_message_Stub(CMOCK_mod_scmi_to_transport_api_defer_message_CALLBACK Callback);
+#define mod_scmi_to_transport_api_defer_message_StubWithCallback mod_scmi_to_transport_api_defer_message_Stub
+#define mod_scmi_to_transport_api_defer_message_IgnoreArg_channel_id() mod_scmi_to_transport_api_defer_message_CMockIgnoreArg_channel_id(__LINE__)
+void mod_scmi_to_transport_api_defer_message_CMockIgnoreArg_channel_id(UNITY_LINE_TYPE cmock_line);
+#define mod_scmi_to_transport_api_resume_message_IgnoreAndReturn(cmock_retval) mod_scmi_to_transport_api_resume_message_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void mod_scmi_to_transport_api_resume_message_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define mod_scmi_to_transport_api_resume_message_StopIgnore() mod_scmi_to_transport_api_resume_message_CMockStopIgnore()
+void mod_scmi_to_transport_api_resume_message_CMockStopIgnore(void);
+#define mod_scmi_to_transport_api_resume_message_ExpectAnyArgsAndReturn(cmock_retval) mod_scmi_to_transport_api_resume_message_CMockExpectAnyArgsAndReturn(__LINE__, cmock_retval)
+void mod_scmi_to_transport_api_resume_message_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define mod_scmi_to_transport_api_resume_message_ExpectAndReturn(channel_id, token, cmock_retval) mod_scmi_to_transport_api_resume_message_CMockExpectAndReturn(__LINE__, channel_id, token, cmock_retval)
+void mod_scmi_to_transport_api_resume_message_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t channel_id, uint32_t token, int cmock_to_return);
+typedef int (* CMOCK_mod_scmi_to_transport_api_resume_message_CALLBACK)(fwk_id_t channel_id, uint32_t token, int cmock_num_calls);
+void mod_scmi_to_transport_api_resume_message_AddCallback(CMOCK_mod_scmi_to_transport_api_resume_message_CALLBACK Callback);
+void mod_scmi_to_transport_api_resume_message_Stub(CMOCK_mod_scmi_to_transport_api_resume_message_CALLBACK Callback);
+#define mod_scmi_to_transport_api_resume_message_StubWithCallback mod_scmi_to_transport_api_resume_message_Stub
+#define mod_scmi_to_transport_api_resume_message_IgnoreArg_channel_id() mod_scmi_to_transport_api_resume_message_CMockIgnoreArg_channel_id(__LINE__)
+void mod_scmi_to_transport_api_resume_message_CMockIgnoreArg_channel_id(UNITY_LINE_TYPE cmock_line);
 #define mod_scmi_from_protocol_get_agent_count_IgnoreAndReturn(cmock_retval) mod_scmi_from_protocol_get_agent_count_CMockIgnoreAndReturn(__LINE__, cmock_retval)
 void mod_scmi_from_protocol_get_agent_count_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
 #define mod_scmi_from_protocol_get_agent_count_StopIgnore() mod_scmi_from_protocol_get_agent_count_CMockStopIgnore()
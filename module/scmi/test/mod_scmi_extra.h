@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2022-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -169,6 +169,27 @@ int mod_scmi_to_transport_api_transmit(
 int mod_scmi_to_transport_api_release_transport_channel_lock(
     fwk_id_t channel_id);
 
+/*!
+ * \brief Defer the response to the message being processed.
+ *
+ * \param channel_id Transport channel identifier.
+ *
+ * \retval ::FWK_SUCCESS The operation succeeded.
+ */
+int mod_scmi_to_transport_api_defer_message(fwk_id_t channel_id);
+
+/*!
+ * \brief Resume a deferred message.
+ *
+ * \param channel_id Transport channel identifier.
+ * \param token Token of the deferred message.
+ *
+ * \retval ::FWK_SUCCESS The operation succeeded.
+ */
+int mod_scmi_to_transport_api_resume_message(
+    fwk_id_t channel_id,
+    uint32_t token);
+
 /*!
  * \brief Get the number of active agents.
  *
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2022-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -13,8 +13,10 @@
 #    include <fwk_module.h>
 #else
 
+#    include <Mockfwk_core.h>
 #    include <Mockfwk_id.h>
 #    include <Mockfwk_module.h>
+#    include <internal/Mockfwk_core_internal.h>
 #endif
 
 #include <Mockmod_scmi_extra.h>
@@ -100,6 +102,12 @@ struct fwk_module_config config_scmi = {
             .agent_table = agent_table,
             .vendor_identifier = "arm",
             .sub_vendor_identifier = "arm",
+#ifdef BUILD_HAS_SCMI_LATENCY_STATS
+            .latency_stats_count = 2,
+#endif
+#ifdef BUILD_HAS_SCMI_NOTIFICATION_COALESCING
+            .notification_pending_count = 2,
+#endif
         },
 
     .elements = FWK_MODULE_DYNAMIC_ELEMENTS(get_element_table),
@@ -123,6 +131,8 @@ static struct mod_scmi_to_transport_api to_transport_api = {
     .transmit = mod_scmi_to_transport_api_transmit,
     .release_transport_channel_lock =
         mod_scmi_to_transport_api_release_transport_channel_lock,
+    .defer_message = mod_scmi_to_transport_api_defer_message,
+    .resume_message = mod_scmi_to_transport_api_resume_message,
 };
 
 static const struct mod_scmi_from_protocol_api from_protocol_api = {
@@ -175,6 +185,23 @@ void setUp(void)
     ctx->transport_id = ctx->config->transport_id;
     ctx->respond = transport_api->respond;
     ctx->transmit = transport_api->transmit;
+
+#ifdef BUILD_HAS_SCMI_FAIR_SCHEDULING
+    scmi_ctx.service_count = FAKE_SERVICE_IDX_COUNT;
+    scmi_ctx.agent_qos_table = fwk_mm_calloc(
+        scmi_ctx.config->agent_count + 1, sizeof(scmi_ctx.agent_qos_table[0]));
+    for (unsigned int i = 0; i <= scmi_ctx.config->agent_count; i++) {
+        scmi_ctx.agent_qos_table[i].qos_class = MOD_SCMI_AGENT_QOS_CLASS_NORMAL;
+        scmi_ctx.agent_qos_table[i].weight = 1;
+    }
+    scmi_ctx.pending_count = 0;
+    scmi_ctx.next_service_idx = 0;
+
+    scmi_ctx.service_ctx_table[FAKE_SERVICE_IDX_PSCI].qos_agent_idx =
+        FAKE_SCMI_AGENT_IDX_PSCI;
+    scmi_ctx.service_ctx_table[FAKE_SERVICE_IDX_OSPM].qos_agent_idx =
+        FAKE_SCMI_AGENT_IDX_OSPM;
+#endif
 }
 
 void tearDown(void)
@@ -283,6 +310,1016 @@ void test_send_to_notification_handler(void)
     TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
 }
 
+#ifdef BUILD_HAS_SCMI_FAIR_SCHEDULING
+static void set_pending(unsigned int service_idx)
+{
+    scmi_ctx.service_ctx_table[service_idx].pending = true;
+    scmi_ctx.pending_count++;
+}
+
+void test_sched_pick_next_none_pending(void)
+{
+    unsigned int service_idx;
+
+    TEST_ASSERT_FALSE(scmi_sched_pick_next(&service_idx));
+}
+
+void test_sched_pick_next_round_robin(void)
+{
+    unsigned int service_idx;
+
+    set_pending(FAKE_SERVICE_IDX_PSCI);
+    set_pending(FAKE_SERVICE_IDX_OSPM);
+
+    TEST_ASSERT_TRUE(scmi_sched_pick_next(&service_idx));
+    TEST_ASSERT_EQUAL(FAKE_SERVICE_IDX_PSCI, service_idx);
+    TEST_ASSERT_FALSE(scmi_ctx.service_ctx_table[service_idx].pending);
+
+    /* The PSCI agent signals again but the OSPM agent gets its turn */
+    set_pending(FAKE_SERVICE_IDX_PSCI);
+    TEST_ASSERT_TRUE(scmi_sched_pick_next(&service_idx));
+    TEST_ASSERT_EQUAL(FAKE_SERVICE_IDX_OSPM, service_idx);
+
+    TEST_ASSERT_TRUE(scmi_sched_pick_next(&service_idx));
+    TEST_ASSERT_EQUAL(FAKE_SERVICE_IDX_PSCI, service_idx);
+    TEST_ASSERT_EQUAL(0, scmi_ctx.pending_count);
+}
+
+void test_sched_pick_next_high_class_first(void)
+{
+    unsigned int service_idx;
+
+    scmi_ctx.agent_qos_table[FAKE_SCMI_AGENT_IDX_OSPM].qos_class =
+        MOD_SCMI_AGENT_QOS_CLASS_HIGH;
+
+    set_pending(FAKE_SERVICE_IDX_PSCI);
+    set_pending(FAKE_SERVICE_IDX_OSPM);
+
+    TEST_ASSERT_TRUE(scmi_sched_pick_next(&service_idx));
+    TEST_ASSERT_EQUAL(FAKE_SERVICE_IDX_OSPM, service_idx);
+
+    set_pending(FAKE_SERVICE_IDX_OSPM);
+    TEST_ASSERT_TRUE(scmi_sched_pick_next(&service_idx));
+    TEST_ASSERT_EQUAL(FAKE_SERVICE_IDX_OSPM, service_idx);
+
+    TEST_ASSERT_TRUE(scmi_sched_pick_next(&service_idx));
+    TEST_ASSERT_EQUAL(FAKE_SERVICE_IDX_PSCI, service_idx);
+}
+
+void test_sched_pick_next_weighted(void)
+{
+    unsigned int service_idx;
+
+    scmi_ctx.agent_qos_table[FAKE_SCMI_AGENT_IDX_OSPM].weight = 2;
+
+    set_pending(FAKE_SERVICE_IDX_OSPM);
+    TEST_ASSERT_TRUE(scmi_sched_pick_next(&service_idx));
+    TEST_ASSERT_EQUAL(FAKE_SERVICE_IDX_OSPM, service_idx);
+
+    set_pending(FAKE_SERVICE_IDX_PSCI);
+    set_pending(FAKE_SERVICE_IDX_OSPM);
+    TEST_ASSERT_TRUE(scmi_sched_pick_next(&service_idx));
+    TEST_ASSERT_EQUAL(FAKE_SERVICE_IDX_PSCI, service_idx);
+
+    /* The OSPM agent still has credits left from the first refill */
+    set_pending(FAKE_SERVICE_IDX_PSCI);
+    TEST_ASSERT_TRUE(scmi_sched_pick_next(&service_idx));
+    TEST_ASSERT_EQUAL(FAKE_SERVICE_IDX_OSPM, service_idx);
+
+    TEST_ASSERT_TRUE(scmi_sched_pick_next(&service_idx));
+    TEST_ASSERT_EQUAL(FAKE_SERVICE_IDX_PSCI, service_idx);
+}
+
+void test_qos_get_agent_stats(void)
+{
+    int status;
+    struct mod_scmi_agent_qos_stats stats;
+
+    scmi_sched_update_stats(
+        &scmi_ctx.agent_qos_table[FAKE_SCMI_AGENT_IDX_OSPM], 10, 30);
+    scmi_sched_update_stats(
+        &scmi_ctx.agent_qos_table[FAKE_SCMI_AGENT_IDX_OSPM], 20, 5);
+
+    status = scmi_qos_get_agent_stats(FAKE_SCMI_AGENT_IDX_OSPM, &stats);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(2, stats.message_count);
+    TEST_ASSERT_EQUAL(30, stats.total_wait_time);
+    TEST_ASSERT_EQUAL(20, stats.max_wait_time);
+    TEST_ASSERT_EQUAL(35, stats.total_service_time);
+    TEST_ASSERT_EQUAL(30, stats.max_service_time);
+
+    status = scmi_qos_reset_agent_stats(FAKE_SCMI_AGENT_IDX_OSPM);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    status = scmi_qos_get_agent_stats(FAKE_SCMI_AGENT_IDX_OSPM, &stats);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(0, stats.message_count);
+
+    status = scmi_qos_get_agent_stats(FAKE_SCMI_AGENT_IDX_OSPM + 1, &stats);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+#    if !defined(TEST_ON_TARGET)
+static void dispatch_signal(unsigned int service_idx)
+{
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(service_idx);
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        signal_message(FWK_ID_ELEMENT(FWK_MODULE_IDX_SCMI, service_idx)));
+}
+
+static void dispatch_process(unsigned int service_idx)
+{
+    struct fwk_event resp;
+    struct fwk_event event = {
+        .id = FWK_ID_EVENT_INIT(FWK_MODULE_IDX_SCMI, SCMI_EVENT_IDX_DISPATCH),
+        .target_id = FWK_ID_MODULE_INIT(FWK_MODULE_IDX_SCMI),
+    };
+
+    fwk_id_get_event_idx_ExpectAnyArgsAndReturn(SCMI_EVENT_IDX_DISPATCH);
+
+    /* The message of the service picked is read from its transport */
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(service_idx);
+    mod_scmi_to_transport_api_get_message_header_ExpectAnyArgsAndReturn(
+        FWK_E_DEVICE);
+    scmi_process_event(&event, &resp);
+}
+
+void test_sched_signal_dispatch(void)
+{
+    struct mod_scmi_agent_qos_stats stats;
+
+    /* Discard the identifier expectations left over by previous tests */
+    Mockfwk_id_Init();
+
+    scmi_ctx.dispatch_queued = false;
+    fwk_module_get_element_name_IgnoreAndReturn("SERVICE");
+
+    /* A single dispatch event is queued for both messages */
+    __fwk_put_event_light_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    dispatch_signal(FAKE_SERVICE_IDX_OSPM);
+    dispatch_signal(FAKE_SERVICE_IDX_PSCI);
+    TEST_ASSERT_TRUE(scmi_ctx.dispatch_queued);
+    TEST_ASSERT_EQUAL(2, scmi_ctx.pending_count);
+
+    /* Another dispatch event is queued while a message is still pending */
+    __fwk_put_event_light_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    dispatch_process(FAKE_SERVICE_IDX_PSCI);
+    TEST_ASSERT_EQUAL(1, scmi_ctx.pending_count);
+    TEST_ASSERT_TRUE(scmi_ctx.dispatch_queued);
+
+    dispatch_process(FAKE_SERVICE_IDX_OSPM);
+    TEST_ASSERT_EQUAL(0, scmi_ctx.pending_count);
+    TEST_ASSERT_FALSE(scmi_ctx.dispatch_queued);
+
+    scmi_qos_get_agent_stats(FAKE_SCMI_AGENT_IDX_PSCI, &stats);
+    TEST_ASSERT_EQUAL(1, stats.message_count);
+    scmi_qos_get_agent_stats(FAKE_SCMI_AGENT_IDX_OSPM, &stats);
+    TEST_ASSERT_EQUAL(1, stats.message_count);
+}
+#    endif
+#endif
+
+#ifdef BUILD_HAS_SCMI_RATE_LIMIT
+static const struct mod_scmi_rate_limit ospm_rate_limit_table[] = {
+    {
+        .protocol_id = MOD_SCMI_PROTOCOL_ID_SENSOR,
+        .rate = 1000,
+        .burst = 2,
+    },
+};
+
+static void rate_limit_setup(void)
+{
+    static struct mod_scmi_agent limited_agents[FAKE_SCMI_AGENT_IDX_OSPM + 1];
+    struct mod_scmi_config config = *scmi_ctx.config;
+
+    limited_agents[FAKE_SCMI_AGENT_IDX_OSPM] = (struct mod_scmi_agent){
+        .type = SCMI_AGENT_TYPE_OSPM,
+        .rate_limit_table = ospm_rate_limit_table,
+        .rate_limit_count = FWK_ARRAY_SIZE(ospm_rate_limit_table),
+    };
+    config.agent_table = limited_agents;
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_rate_limit_init(&config));
+}
+
+void test_rate_limit_unlimited_protocol(void)
+{
+    rate_limit_setup();
+
+    for (unsigned int i = 0; i < 10; i++) {
+        TEST_ASSERT_TRUE(scmi_rate_limit_consume(
+            FAKE_SCMI_AGENT_IDX_OSPM, MOD_SCMI_PROTOCOL_ID_CLOCK));
+        TEST_ASSERT_TRUE(scmi_rate_limit_consume(
+            FAKE_SCMI_AGENT_IDX_PSCI, MOD_SCMI_PROTOCOL_ID_SENSOR));
+    }
+}
+
+void test_rate_limit_throttles_over_budget(void)
+{
+    int status;
+    struct mod_scmi_rate_limit_stats stats;
+
+    rate_limit_setup();
+
+    TEST_ASSERT_TRUE(scmi_rate_limit_consume(
+        FAKE_SCMI_AGENT_IDX_OSPM, MOD_SCMI_PROTOCOL_ID_SENSOR));
+    TEST_ASSERT_TRUE(scmi_rate_limit_consume(
+        FAKE_SCMI_AGENT_IDX_OSPM, MOD_SCMI_PROTOCOL_ID_SENSOR));
+    TEST_ASSERT_FALSE(scmi_rate_limit_consume(
+        FAKE_SCMI_AGENT_IDX_OSPM, MOD_SCMI_PROTOCOL_ID_SENSOR));
+
+    status = scmi_rate_limit_get_stats(
+        FAKE_SCMI_AGENT_IDX_OSPM, MOD_SCMI_PROTOCOL_ID_SENSOR, &stats);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(2, stats.accepted_count);
+    TEST_ASSERT_EQUAL(1, stats.throttled_count);
+
+    status = scmi_rate_limit_get_stats(
+        FAKE_SCMI_AGENT_IDX_OSPM, MOD_SCMI_PROTOCOL_ID_CLOCK, &stats);
+    TEST_ASSERT_EQUAL(FWK_E_RANGE, status);
+}
+
+void test_rate_limit_reset_stats(void)
+{
+    int status;
+    struct mod_scmi_rate_limit_stats stats;
+
+    rate_limit_setup();
+
+    TEST_ASSERT_TRUE(scmi_rate_limit_consume(
+        FAKE_SCMI_AGENT_IDX_OSPM, MOD_SCMI_PROTOCOL_ID_SENSOR));
+    TEST_ASSERT_TRUE(scmi_rate_limit_consume(
+        FAKE_SCMI_AGENT_IDX_OSPM, MOD_SCMI_PROTOCOL_ID_SENSOR));
+
+    status = scmi_rate_limit_reset_stats(
+        FAKE_SCMI_AGENT_IDX_OSPM, MOD_SCMI_PROTOCOL_ID_SENSOR);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* The bucket is still empty, only the counters start over */
+    TEST_ASSERT_FALSE(scmi_rate_limit_consume(
+        FAKE_SCMI_AGENT_IDX_OSPM, MOD_SCMI_PROTOCOL_ID_SENSOR));
+
+    status = scmi_rate_limit_get_stats(
+        FAKE_SCMI_AGENT_IDX_OSPM, MOD_SCMI_PROTOCOL_ID_SENSOR, &stats);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(0, stats.accepted_count);
+    TEST_ASSERT_EQUAL(1, stats.throttled_count);
+
+    status = scmi_rate_limit_reset_stats(
+        FAKE_SCMI_AGENT_IDX_OSPM, MOD_SCMI_PROTOCOL_ID_CLOCK);
+    TEST_ASSERT_EQUAL(FWK_E_RANGE, status);
+    status = scmi_rate_limit_reset_stats(
+        scmi_ctx.config->agent_count + 1, MOD_SCMI_PROTOCOL_ID_SENSOR);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+void test_rate_limit_refill(void)
+{
+    struct scmi_rate_limit_ctx *bucket;
+
+    rate_limit_setup();
+
+    bucket = scmi_rate_limit_get_bucket(
+        FAKE_SCMI_AGENT_IDX_OSPM, MOD_SCMI_PROTOCOL_ID_SENSOR);
+    TEST_ASSERT_NOT_NULL(bucket);
+
+    bucket->tokens = 0;
+    TEST_ASSERT_FALSE(scmi_rate_limit_consume(
+        FAKE_SCMI_AGENT_IDX_OSPM, MOD_SCMI_PROTOCOL_ID_SENSOR));
+
+    /* One token is added back every millisecond at 1000 messages/s */
+    bucket->tokens = FWK_MS(1) * bucket->config->rate;
+    TEST_ASSERT_TRUE(scmi_rate_limit_consume(
+        FAKE_SCMI_AGENT_IDX_OSPM, MOD_SCMI_PROTOCOL_ID_SENSOR));
+    TEST_ASSERT_EQUAL(0, bucket->tokens);
+}
+#endif
+
+#ifdef BUILD_HAS_SCMI_LATENCY_STATS
+static void latency_stats_setup(void)
+{
+    scmi_ctx.latency_stats_table = fwk_mm_calloc(
+        scmi_ctx.config->latency_stats_count,
+        sizeof(scmi_ctx.latency_stats_table[0]));
+    scmi_ctx.latency_stats_used = 0;
+}
+
+static void latency_stats_respond(
+    unsigned int service_idx,
+    unsigned int protocol_id,
+    unsigned int message_id,
+    int32_t scmi_status)
+{
+    struct scmi_service_ctx *ctx = &scmi_ctx.service_ctx_table[service_idx];
+
+    ctx->scmi_protocol_id = protocol_id;
+    ctx->scmi_message_id = message_id;
+    scmi_latency_stats_record(ctx, scmi_status);
+}
+
+void test_latency_stats_record(void)
+{
+    unsigned int count;
+    struct mod_scmi_latency_stats stats;
+
+    latency_stats_setup();
+
+    latency_stats_respond(
+        FAKE_SERVICE_IDX_OSPM, MOD_SCMI_PROTOCOL_ID_PERF, 0x7, SCMI_SUCCESS);
+    latency_stats_respond(
+        FAKE_SERVICE_IDX_OSPM,
+        MOD_SCMI_PROTOCOL_ID_PERF,
+        0x7,
+        SCMI_INVALID_PARAMETERS);
+    latency_stats_respond(
+        FAKE_SERVICE_IDX_PSCI, MOD_SCMI_PROTOCOL_ID_PERF, 0x7, SCMI_SUCCESS);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_latency_stats_get_count(&count));
+    TEST_ASSERT_EQUAL(2, count);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_latency_stats_get_stats(0, &stats));
+    TEST_ASSERT_EQUAL(FAKE_SCMI_AGENT_IDX_OSPM, stats.agent_id);
+    TEST_ASSERT_EQUAL(MOD_SCMI_PROTOCOL_ID_PERF, stats.protocol_id);
+    TEST_ASSERT_EQUAL(0x7, stats.message_id);
+    TEST_ASSERT_EQUAL(2, stats.count);
+    TEST_ASSERT_EQUAL(1, stats.error_count);
+    TEST_ASSERT_EQUAL(2, stats.histogram[0]);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_latency_stats_get_stats(1, &stats));
+    TEST_ASSERT_EQUAL(FAKE_SCMI_AGENT_IDX_PSCI, stats.agent_id);
+    TEST_ASSERT_EQUAL(1, stats.count);
+    TEST_ASSERT_EQUAL(0, stats.error_count);
+
+    TEST_ASSERT_EQUAL(FWK_E_RANGE, scmi_latency_stats_get_stats(2, &stats));
+}
+
+void test_latency_stats_table_full(void)
+{
+    unsigned int count;
+    struct mod_scmi_latency_stats stats;
+
+    latency_stats_setup();
+
+    latency_stats_respond(
+        FAKE_SERVICE_IDX_OSPM, MOD_SCMI_PROTOCOL_ID_PERF, 0x7, SCMI_SUCCESS);
+    latency_stats_respond(
+        FAKE_SERVICE_IDX_OSPM, MOD_SCMI_PROTOCOL_ID_PERF, 0x8, SCMI_SUCCESS);
+    latency_stats_respond(
+        FAKE_SERVICE_IDX_OSPM, MOD_SCMI_PROTOCOL_ID_CLOCK, 0x5, SCMI_SUCCESS);
+    latency_stats_respond(
+        FAKE_SERVICE_IDX_OSPM, MOD_SCMI_PROTOCOL_ID_PERF, 0x8, SCMI_SUCCESS);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_latency_stats_get_count(&count));
+    TEST_ASSERT_EQUAL(2, count);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_latency_stats_get_stats(1, &stats));
+    TEST_ASSERT_EQUAL(2, stats.count);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_latency_stats_reset());
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_latency_stats_get_count(&count));
+    TEST_ASSERT_EQUAL(0, count);
+}
+
+/*
+ * Test that the status of a response written with write_payload() is recorded
+ * when the response is sent without a payload
+ */
+void test_latency_stats_written_status(void)
+{
+    int32_t scmi_status = SCMI_NOT_FOUND;
+    uint32_t value = 0;
+    struct mod_scmi_latency_stats stats;
+    struct scmi_service_ctx *ctx =
+        &scmi_ctx.service_ctx_table[FAKE_SERVICE_IDX_OSPM];
+    fwk_id_t service_id =
+        FWK_ID_ELEMENT_INIT(FAKE_MODULE_ID, FAKE_SERVICE_IDX_OSPM);
+
+    latency_stats_setup();
+    ctx->scmi_protocol_id = MOD_SCMI_PROTOCOL_ID_PERF;
+    ctx->scmi_message_id = 0x7;
+    ctx->response_status = SCMI_GENERIC_ERROR;
+
+#    if !defined(TEST_ON_TARGET)
+    fwk_id_get_element_idx_IgnoreAndReturn(FAKE_SERVICE_IDX_OSPM);
+#    endif
+    fwk_module_get_element_name_IgnoreAndReturn("");
+    mod_scmi_to_transport_api_write_payload_IgnoreAndReturn(FWK_SUCCESS);
+    mod_scmi_to_transport_api_respond_IgnoreAndReturn(FWK_SUCCESS);
+
+    /* Only the first entry of the payload holds the status */
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        write_payload(service_id, 0, &scmi_status, sizeof(scmi_status)));
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        write_payload(service_id, sizeof(scmi_status), &value, sizeof(value)));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, respond(service_id, NULL, 8));
+
+    scmi_status = SCMI_SUCCESS;
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        write_payload(service_id, 0, &scmi_status, sizeof(scmi_status)));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, respond(service_id, NULL, 4));
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_latency_stats_get_stats(0, &stats));
+    TEST_ASSERT_EQUAL(2, stats.count);
+    TEST_ASSERT_EQUAL(1, stats.error_count);
+
+    mod_scmi_to_transport_api_write_payload_StopIgnore();
+    mod_scmi_to_transport_api_respond_StopIgnore();
+    fwk_module_get_element_name_StopIgnore();
+#    if !defined(TEST_ON_TARGET)
+    fwk_id_get_element_idx_StopIgnore();
+#    endif
+}
+
+void test_latency_stats_bucket(void)
+{
+    TEST_ASSERT_EQUAL(0, scmi_latency_stats_bucket(0));
+    TEST_ASSERT_EQUAL(0, scmi_latency_stats_bucket(15));
+    TEST_ASSERT_EQUAL(1, scmi_latency_stats_bucket(16));
+    TEST_ASSERT_EQUAL(1, scmi_latency_stats_bucket(63));
+    TEST_ASSERT_EQUAL(3, scmi_latency_stats_bucket(1000));
+    TEST_ASSERT_EQUAL(
+        MOD_SCMI_LATENCY_HISTOGRAM_BUCKET_COUNT - 1,
+        scmi_latency_stats_bucket(UINT32_C(10000000)));
+}
+#endif
+
+#if defined(BUILD_HAS_SCMI_NOTIFICATION_COALESCING) || \
+    defined(BUILD_HAS_SCMI_REQUESTER_PIPELINING)
+static unsigned int alarm_start_count;
+static unsigned int alarm_stop_count;
+static uintptr_t alarm_param;
+
+static int fake_alarm_start(
+    fwk_id_t alarm_id,
+    unsigned int milliseconds,
+    enum mod_timer_alarm_type type,
+    void (*callback)(uintptr_t param),
+    uintptr_t param)
+{
+    alarm_start_count++;
+    alarm_param = param;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_alarm_stop(fwk_id_t alarm_id)
+{
+    alarm_stop_count++;
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_timer_alarm_api fake_alarm_api = {
+    .start = fake_alarm_start,
+    .stop = fake_alarm_stop,
+};
+#endif
+
+#ifdef BUILD_HAS_SCMI_NOTIFICATION_COALESCING
+/* Performance level changed notification */
+#    define FAKE_NOTIFICATION_HEADER 0x4F01
+/* Sensor trip point event notification */
+#    define FAKE_EVENT_NOTIFICATION_HEADER 0x5700
+
+static struct scmi_service_ctx *notification_setup(void)
+{
+    struct scmi_service_ctx *p2a_ctx;
+
+#if !defined(TEST_ON_TARGET)
+    /* Discard the identifier expectations left over by previous tests */
+    Mockfwk_id_Init();
+#endif
+
+    p2a_ctx = &scmi_ctx.service_ctx_table[FAKE_SERVICE_IDX_OSPM];
+    p2a_ctx->notification_pending_table = fwk_mm_calloc(
+        scmi_ctx.config->notification_pending_count,
+        sizeof(p2a_ctx->notification_pending_table[0]));
+
+    scmi_ctx.notification_flush_alarm_api = NULL;
+    scmi_ctx.notification_flush_armed = false;
+    alarm_start_count = 0;
+
+    return p2a_ctx;
+}
+
+static void notification_send(
+    struct scmi_service_ctx *p2a_ctx,
+    uint32_t domain_id,
+    uint32_t level)
+{
+    uint32_t payload[3] = { FAKE_SCMI_AGENT_IDX_OSPM, domain_id, level };
+
+    scmi_notification_send(
+        p2a_ctx, FAKE_NOTIFICATION_HEADER, payload, sizeof(payload));
+}
+
+void test_notification_coalescing_sent_when_free(void)
+{
+    struct scmi_service_ctx *p2a_ctx = notification_setup();
+
+    mod_scmi_to_transport_api_transmit_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    notification_send(p2a_ctx, 0, 100);
+
+    TEST_ASSERT_EQUAL(0, p2a_ctx->notification_pending_count);
+    TEST_ASSERT_EQUAL(1, p2a_ctx->notification_stats.sent_count);
+    TEST_ASSERT_EQUAL(0, p2a_ctx->notification_stats.deferred_count);
+}
+
+void test_notification_coalescing_latest_value(void)
+{
+    struct scmi_service_ctx *p2a_ctx = notification_setup();
+
+    /* Channel busy, the notification is held back */
+    mod_scmi_to_transport_api_transmit_ExpectAnyArgsAndReturn(FWK_E_BUSY);
+    notification_send(p2a_ctx, 0, 100);
+
+    /* Same domain, the notification held back is updated */
+    mod_scmi_to_transport_api_transmit_ExpectAnyArgsAndReturn(FWK_E_BUSY);
+    notification_send(p2a_ctx, 0, 200);
+
+    /* Another domain, held back after the first one */
+    mod_scmi_to_transport_api_transmit_ExpectAnyArgsAndReturn(FWK_E_BUSY);
+    notification_send(p2a_ctx, 1, 300);
+
+    /* No room left */
+    mod_scmi_to_transport_api_transmit_ExpectAnyArgsAndReturn(FWK_E_BUSY);
+    notification_send(p2a_ctx, 2, 400);
+
+    TEST_ASSERT_EQUAL(2, p2a_ctx->notification_pending_count);
+    TEST_ASSERT_EQUAL(200, p2a_ctx->notification_pending_table[0].payload[2]);
+    TEST_ASSERT_EQUAL(300, p2a_ctx->notification_pending_table[1].payload[2]);
+    TEST_ASSERT_EQUAL(2, p2a_ctx->notification_stats.deferred_count);
+    TEST_ASSERT_EQUAL(1, p2a_ctx->notification_stats.coalesced_count);
+    TEST_ASSERT_EQUAL(1, p2a_ctx->notification_stats.dropped_count);
+}
+
+void test_notification_coalescing_flush_on_ack(void)
+{
+    struct scmi_service_ctx *p2a_ctx = notification_setup();
+    struct fwk_event event = {
+        .id = FWK_ID_EVENT_INIT(
+            FWK_MODULE_IDX_SCMI, SCMI_EVENT_IDX_NOTIFICATION_ACK),
+        .target_id = FWK_ID_ELEMENT_INIT(
+            FWK_MODULE_IDX_SCMI, FAKE_SERVICE_IDX_OSPM),
+    };
+
+    mod_scmi_to_transport_api_transmit_ExpectAnyArgsAndReturn(FWK_E_BUSY);
+    notification_send(p2a_ctx, 0, 100);
+    mod_scmi_to_transport_api_transmit_ExpectAnyArgsAndReturn(FWK_E_BUSY);
+    notification_send(p2a_ctx, 1, 200);
+
+#if !defined(TEST_ON_TARGET)
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(FAKE_SERVICE_IDX_OSPM);
+#endif
+    mod_scmi_to_transport_api_release_transport_channel_lock_ExpectAnyArgsAndReturn(
+        FWK_SUCCESS);
+    mod_scmi_to_transport_api_transmit_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_notification_process_ack(&event));
+
+    TEST_ASSERT_EQUAL(1, p2a_ctx->notification_pending_count);
+    TEST_ASSERT_EQUAL(1, p2a_ctx->notification_pending_table[0].element_id);
+    TEST_ASSERT_EQUAL(1, p2a_ctx->notification_stats.sent_count);
+}
+
+/* Test that the notifications reporting events are never replaced */
+void test_notification_coalescing_events_kept(void)
+{
+    struct scmi_service_ctx *p2a_ctx = notification_setup();
+    uint32_t payload[3] = { FAKE_SCMI_AGENT_IDX_OSPM, 0, 0 };
+
+    mod_scmi_to_transport_api_transmit_ExpectAnyArgsAndReturn(FWK_E_BUSY);
+    scmi_notification_send(
+        p2a_ctx, FAKE_EVENT_NOTIFICATION_HEADER, payload, sizeof(payload));
+
+    payload[2] = 1;
+    mod_scmi_to_transport_api_transmit_ExpectAnyArgsAndReturn(FWK_E_BUSY);
+    scmi_notification_send(
+        p2a_ctx, FAKE_EVENT_NOTIFICATION_HEADER, payload, sizeof(payload));
+
+    TEST_ASSERT_EQUAL(2, p2a_ctx->notification_pending_count);
+    TEST_ASSERT_EQUAL(0, p2a_ctx->notification_pending_table[0].payload[2]);
+    TEST_ASSERT_EQUAL(1, p2a_ctx->notification_pending_table[1].payload[2]);
+    TEST_ASSERT_EQUAL(0, p2a_ctx->notification_stats.coalesced_count);
+}
+
+/*
+ * Test that the flush alarm retries to send the notifications held back for an
+ * agent which does not signal it has read them
+ */
+void test_notification_coalescing_flush_retry(void)
+{
+    struct scmi_service_ctx *p2a_ctx = notification_setup();
+
+    scmi_ctx.notification_flush_alarm_api = &fake_alarm_api;
+
+    mod_scmi_to_transport_api_transmit_ExpectAnyArgsAndReturn(FWK_E_BUSY);
+    notification_send(p2a_ctx, 0, 100);
+    mod_scmi_to_transport_api_transmit_ExpectAnyArgsAndReturn(FWK_E_BUSY);
+    notification_send(p2a_ctx, 1, 200);
+
+    /* Started once for both notifications */
+    TEST_ASSERT_EQUAL(1, alarm_start_count);
+    TEST_ASSERT_TRUE(scmi_ctx.notification_flush_armed);
+
+    /* One notification sent, the alarm is started again for the other one */
+    mod_scmi_to_transport_api_transmit_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_notification_process_flush());
+    TEST_ASSERT_EQUAL(1, p2a_ctx->notification_pending_count);
+    TEST_ASSERT_EQUAL(2, alarm_start_count);
+
+    /* Nothing left, the alarm is not started again */
+    mod_scmi_to_transport_api_transmit_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_notification_process_flush());
+    TEST_ASSERT_EQUAL(0, p2a_ctx->notification_pending_count);
+    TEST_ASSERT_EQUAL(2, alarm_start_count);
+    TEST_ASSERT_FALSE(scmi_ctx.notification_flush_armed);
+}
+
+void test_notification_coalescing_get_stats(void)
+{
+    struct mod_scmi_notification_coalescing_stats stats;
+    struct scmi_service_ctx *p2a_ctx = notification_setup();
+    fwk_id_t service_id =
+        FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_SCMI, FAKE_SERVICE_IDX_OSPM);
+
+    p2a_ctx->notification_stats.coalesced_count = 5;
+
+#if !defined(TEST_ON_TARGET)
+    fwk_module_is_valid_element_id_ExpectAnyArgsAndReturn(true);
+    fwk_id_is_equal_ExpectAnyArgsAndReturn(true);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(FAKE_SERVICE_IDX_OSPM);
+#endif
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        scmi_notification_get_coalescing_stats(service_id, &stats));
+    TEST_ASSERT_EQUAL(5, stats.coalesced_count);
+
+#if !defined(TEST_ON_TARGET)
+    fwk_module_is_valid_element_id_ExpectAnyArgsAndReturn(true);
+    fwk_id_is_equal_ExpectAnyArgsAndReturn(true);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(FAKE_SERVICE_IDX_PSCI);
+#endif
+    service_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SCMI, FAKE_SERVICE_IDX_PSCI);
+    TEST_ASSERT_EQUAL(
+        FWK_E_SUPPORT,
+        scmi_notification_get_coalescing_stats(service_id, &stats));
+}
+#endif
+
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+static struct mod_scmi_service_config requester_config;
+
+static struct scmi_service_ctx *requester_setup(void)
+{
+    struct scmi_service_ctx *ctx;
+
+    ctx = &scmi_ctx.service_ctx_table[FAKE_SERVICE_IDX_OSPM];
+
+    requester_config =
+        *(const struct mod_scmi_service_config *)element_table
+             [FAKE_SERVICE_IDX_OSPM]
+                 .data;
+    requester_config.scmi_entity_role = MOD_SCMI_ROLE_AGENT;
+    requester_config.request_queue_length = 2;
+
+    ctx->config = &requester_config;
+    ctx->request_queue = fwk_mm_calloc(
+        requester_config.request_queue_length, sizeof(ctx->request_queue[0]));
+
+    alarm_start_count = 0;
+    alarm_stop_count = 0;
+
+    return ctx;
+}
+
+static void requester_timeout(uint16_t token)
+{
+    struct fwk_event event = {
+        .id = FWK_ID_EVENT_INIT(
+            FWK_MODULE_IDX_SCMI, SCMI_EVENT_IDX_REQUEST_TIMEOUT),
+        .target_id = FWK_ID_ELEMENT_INIT(
+            FWK_MODULE_IDX_SCMI, FAKE_SERVICE_IDX_OSPM),
+    };
+
+    *(uint16_t *)event.params = token;
+
+#if !defined(TEST_ON_TARGET)
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(FAKE_SERVICE_IDX_OSPM);
+#endif
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_request_process_timeout(&event));
+}
+
+static int requester_send(struct scmi_service_ctx *ctx, uint8_t token)
+{
+    uint32_t payload[2] = { token, 0 };
+
+    return scmi_request_send(
+        ctx,
+        scmi_message_header(
+            MOD_SCMI_SENSOR_READING_GET,
+            MOD_SCMI_MESSAGE_TYPE_COMMAND,
+            MOD_SCMI_PROTOCOL_ID_SENSOR,
+            token),
+        payload,
+        sizeof(payload),
+        true);
+}
+
+void test_requester_pipelining_queue(void)
+{
+    struct scmi_service_ctx *ctx = requester_setup();
+
+    /* Channel free, the request is sent */
+    mod_scmi_to_transport_api_transmit_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, requester_send(ctx, 1));
+    TEST_ASSERT_TRUE(ctx->request_in_flight);
+    TEST_ASSERT_EQUAL(1, ctx->request_in_flight_token);
+
+    /* Response awaited, the requests are queued */
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, requester_send(ctx, 2));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, requester_send(ctx, 3));
+    TEST_ASSERT_EQUAL(FWK_E_BUSY, requester_send(ctx, 4));
+    TEST_ASSERT_EQUAL(2, ctx->request_queue_count);
+}
+
+void test_requester_pipelining_response(void)
+{
+    struct scmi_service_ctx *ctx = requester_setup();
+
+    mod_scmi_to_transport_api_transmit_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    requester_send(ctx, 1);
+    requester_send(ctx, 2);
+
+    /* A response with another token is not the one awaited */
+    ctx->scmi_token = 5;
+    TEST_ASSERT_FALSE(scmi_request_match_response(ctx));
+    TEST_ASSERT_TRUE(ctx->request_in_flight);
+
+    ctx->scmi_token = 1;
+    TEST_ASSERT_TRUE(scmi_request_match_response(ctx));
+    TEST_ASSERT_FALSE(ctx->request_in_flight);
+
+    /* The queued request is sent once the response has been handled */
+    mod_scmi_to_transport_api_transmit_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    scmi_request_send_next(ctx);
+    TEST_ASSERT_EQUAL(0, ctx->request_queue_count);
+    TEST_ASSERT_TRUE(ctx->request_in_flight);
+    TEST_ASSERT_EQUAL(2, ctx->request_in_flight_token);
+}
+
+void test_requester_pipelining_channel_busy(void)
+{
+    struct scmi_service_ctx *ctx = requester_setup();
+
+    /* Channel busy with nothing in flight, the request is queued */
+    mod_scmi_to_transport_api_transmit_ExpectAnyArgsAndReturn(FWK_E_BUSY);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, requester_send(ctx, 1));
+    TEST_ASSERT_EQUAL(1, ctx->request_queue_count);
+
+    /* Still busy, the request stays at the head of the queue */
+    mod_scmi_to_transport_api_transmit_ExpectAnyArgsAndReturn(FWK_E_BUSY);
+    scmi_request_send_next(ctx);
+    TEST_ASSERT_EQUAL(1, ctx->request_queue_count);
+    TEST_ASSERT_FALSE(ctx->request_in_flight);
+
+    /* The queued request is sent ahead of the next one */
+    mod_scmi_to_transport_api_transmit_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, requester_send(ctx, 2));
+    TEST_ASSERT_EQUAL(1, ctx->request_in_flight_token);
+    TEST_ASSERT_EQUAL(1, ctx->request_queue_count);
+}
+
+/*
+ * Test that a request whose response is not received in time is dropped and
+ * that the next queued request is sent
+ */
+void test_requester_pipelining_timeout(void)
+{
+    struct scmi_service_ctx *ctx = requester_setup();
+
+    requester_config.request_timeout_ms = 10;
+    ctx->request_timeout_alarm_api = &fake_alarm_api;
+
+    mod_scmi_to_transport_api_transmit_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    requester_send(ctx, 1);
+    requester_send(ctx, 2);
+    TEST_ASSERT_EQUAL(1, alarm_start_count);
+    TEST_ASSERT_EQUAL(
+        FAKE_SERVICE_IDX_OSPM, SCMI_REQUEST_TIMEOUT_SERVICE_IDX(alarm_param));
+    TEST_ASSERT_EQUAL(1, SCMI_REQUEST_TIMEOUT_TOKEN(alarm_param));
+
+    /* The timeout of a request already responded to is ignored */
+    requester_timeout(7);
+    TEST_ASSERT_TRUE(ctx->request_in_flight);
+    TEST_ASSERT_EQUAL(1, ctx->request_in_flight_token);
+
+#if !defined(TEST_ON_TARGET)
+    fwk_module_get_element_name_IgnoreAndReturn("");
+#endif
+    mod_scmi_to_transport_api_transmit_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    requester_timeout(1);
+#if !defined(TEST_ON_TARGET)
+    fwk_module_get_element_name_StopIgnore();
+#endif
+    TEST_ASSERT_TRUE(ctx->request_in_flight);
+    TEST_ASSERT_EQUAL(2, ctx->request_in_flight_token);
+    TEST_ASSERT_EQUAL(0, ctx->request_queue_count);
+    TEST_ASSERT_EQUAL(2, alarm_start_count);
+
+    /* The late response to the dropped request is discarded */
+    ctx->scmi_token = 1;
+    TEST_ASSERT_FALSE(scmi_request_match_response(ctx));
+
+    ctx->scmi_token = 2;
+    TEST_ASSERT_TRUE(scmi_request_match_response(ctx));
+    TEST_ASSERT_EQUAL(1, alarm_stop_count);
+}
+#endif
+
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+static struct scmi_service_ctx *deferred_response_setup(void)
+{
+    struct scmi_service_ctx *ctx =
+        &scmi_ctx.service_ctx_table[FAKE_SERVICE_IDX_OSPM];
+
+    ctx->scmi_token = 3;
+    ctx->scmi_protocol_id = MOD_SCMI_PROTOCOL_ID_PERF;
+    ctx->scmi_message_id = 0x7;
+    ctx->scmi_message_type = MOD_SCMI_MESSAGE_TYPE_COMMAND;
+    ctx->message_resumed = false;
+
+#    if !defined(TEST_ON_TARGET)
+    fwk_id_get_element_idx_IgnoreAndReturn(FAKE_SERVICE_IDX_OSPM);
+#    endif
+
+    return ctx;
+}
+
+void test_deferred_response_not_supported(void)
+{
+    uint32_t token;
+    fwk_id_t service_id =
+        FWK_ID_ELEMENT_INIT(FAKE_MODULE_ID, FAKE_SERVICE_IDX_OSPM);
+
+    deferred_response_setup();
+
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, defer_response(service_id, NULL));
+
+    to_transport_api.defer_message = NULL;
+    to_transport_api.resume_message = NULL;
+    TEST_ASSERT_EQUAL(FWK_E_SUPPORT, defer_response(service_id, &token));
+    TEST_ASSERT_EQUAL(FWK_E_SUPPORT, resume_response(service_id, 3));
+    to_transport_api.defer_message = mod_scmi_to_transport_api_defer_message;
+    to_transport_api.resume_message = mod_scmi_to_transport_api_resume_message;
+#    if !defined(TEST_ON_TARGET)
+    fwk_id_get_element_idx_StopIgnore();
+#    endif
+}
+
+void test_deferred_response_resume(void)
+{
+    uint32_t token;
+    uint32_t message_header = scmi_message_header(
+        0x7, MOD_SCMI_MESSAGE_TYPE_COMMAND, MOD_SCMI_PROTOCOL_ID_PERF, 3);
+    int32_t response_status = SCMI_SUCCESS;
+    fwk_id_t service_id =
+        FWK_ID_ELEMENT_INIT(FAKE_MODULE_ID, FAKE_SERVICE_IDX_OSPM);
+    struct scmi_service_ctx *ctx = deferred_response_setup();
+
+    mod_scmi_to_transport_api_defer_message_ExpectAndReturn(
+        ctx->transport_id, FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, defer_response(service_id, &token));
+    TEST_ASSERT_EQUAL(3, token);
+
+    /* The next message on the channel is being processed */
+    ctx->scmi_token = 4;
+    ctx->scmi_protocol_id = MOD_SCMI_PROTOCOL_ID_BASE;
+    ctx->scmi_message_id = 0x1;
+
+    mod_scmi_to_transport_api_resume_message_ExpectAndReturn(
+        ctx->transport_id, 3, FWK_SUCCESS);
+    mod_scmi_to_transport_api_get_message_header_ExpectAnyArgsAndReturn(
+        FWK_SUCCESS);
+    mod_scmi_to_transport_api_get_message_header_ReturnThruPtr_message_header(
+        &message_header);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, resume_response(service_id, token));
+    TEST_ASSERT_EQUAL(3, ctx->scmi_token);
+    TEST_ASSERT_EQUAL(MOD_SCMI_PROTOCOL_ID_PERF, ctx->scmi_protocol_id);
+    TEST_ASSERT_EQUAL(0x7, ctx->scmi_message_id);
+
+    /* A single deferred message can be resumed at a time */
+    TEST_ASSERT_EQUAL(FWK_E_BUSY, resume_response(service_id, token));
+
+    /* Once responded to, the preempted message is restored */
+#    ifdef BUILD_HAS_SCMI_LATENCY_STATS
+    latency_stats_setup();
+#    endif
+    fwk_module_get_element_name_IgnoreAndReturn("");
+    mod_scmi_to_transport_api_respond_ExpectAndReturn(
+        ctx->transport_id,
+        &response_status,
+        sizeof(response_status),
+        FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        respond(service_id, &response_status, sizeof(response_status)));
+    TEST_ASSERT_FALSE(ctx->message_resumed);
+    TEST_ASSERT_EQUAL(4, ctx->scmi_token);
+    TEST_ASSERT_EQUAL(MOD_SCMI_PROTOCOL_ID_BASE, ctx->scmi_protocol_id);
+    TEST_ASSERT_EQUAL(0x1, ctx->scmi_message_id);
+#    if !defined(TEST_ON_TARGET)
+    fwk_id_get_element_idx_StopIgnore();
+#    endif
+}
+
+#    ifdef BUILD_HAS_SCMI_LATENCY_STATS
+static void deferred_message_resume(
+    fwk_id_t service_id,
+    struct scmi_service_ctx *ctx,
+    uint16_t token)
+{
+    uint32_t message_header = scmi_message_header(
+        0x7, MOD_SCMI_MESSAGE_TYPE_COMMAND, MOD_SCMI_PROTOCOL_ID_PERF, token);
+
+    mod_scmi_to_transport_api_resume_message_ExpectAndReturn(
+        ctx->transport_id, token, FWK_SUCCESS);
+    mod_scmi_to_transport_api_get_message_header_ExpectAnyArgsAndReturn(
+        FWK_SUCCESS);
+    mod_scmi_to_transport_api_get_message_header_ReturnThruPtr_message_header(
+        &message_header);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, resume_response(service_id, token));
+}
+
+/*
+ * Test that the latency of a deferred message is measured from the time the
+ * message with the same token was signaled, whatever the order in which the
+ * deferred messages are resumed
+ */
+void test_deferred_response_latency_by_token(void)
+{
+    uint32_t token;
+    fwk_id_t service_id =
+        FWK_ID_ELEMENT_INIT(FAKE_MODULE_ID, FAKE_SERVICE_IDX_OSPM);
+    struct scmi_service_ctx *ctx = deferred_response_setup();
+
+    ctx->deferred_message_count = 0;
+
+    /* Defer the messages with tokens 3 and 4 */
+    ctx->signal_timestamp = 300;
+    ctx->response_status = SCMI_GENERIC_ERROR;
+    mod_scmi_to_transport_api_defer_message_ExpectAndReturn(
+        ctx->transport_id, FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, defer_response(service_id, &token));
+
+    ctx->scmi_token = 4;
+    ctx->signal_timestamp = 400;
+    mod_scmi_to_transport_api_defer_message_ExpectAndReturn(
+        ctx->transport_id, FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, defer_response(service_id, &token));
+
+    /* A deferral refused by the transport is not kept */
+    ctx->scmi_token = 5;
+    ctx->signal_timestamp = 500;
+    mod_scmi_to_transport_api_defer_message_ExpectAndReturn(
+        ctx->transport_id, FWK_E_BUSY);
+    TEST_ASSERT_EQUAL(FWK_E_BUSY, defer_response(service_id, &token));
+    TEST_ASSERT_EQUAL(2, ctx->deferred_message_count);
+
+    deferred_message_resume(service_id, ctx, 4);
+    TEST_ASSERT_EQUAL(400, ctx->signal_timestamp);
+    TEST_ASSERT_EQUAL(1, ctx->deferred_message_count);
+
+    /* Responding restores the message that was preempted */
+    latency_stats_setup();
+    fwk_module_get_element_name_IgnoreAndReturn("");
+    mod_scmi_to_transport_api_respond_IgnoreAndReturn(FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        respond(service_id, &(int32_t){ SCMI_SUCCESS }, sizeof(int32_t)));
+    TEST_ASSERT_EQUAL(5, ctx->scmi_token);
+    TEST_ASSERT_EQUAL(500, ctx->signal_timestamp);
+
+    deferred_message_resume(service_id, ctx, 3);
+    TEST_ASSERT_EQUAL(300, ctx->signal_timestamp);
+    TEST_ASSERT_EQUAL(0, ctx->deferred_message_count);
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        respond(service_id, &(int32_t){ SCMI_SUCCESS }, sizeof(int32_t)));
+
+    mod_scmi_to_transport_api_respond_StopIgnore();
+    fwk_module_get_element_name_StopIgnore();
+#        if !defined(TEST_ON_TARGET)
+    fwk_id_get_element_idx_StopIgnore();
+#        endif
+}
+#    endif
+#endif
+
 int scmi_test_main(void)
 {
     UNITY_BEGIN();
@@ -292,6 +1329,55 @@ int scmi_test_main(void)
 
     RUN_TEST(test_send_to_message_handler);
     RUN_TEST(test_send_to_notification_handler);
+
+#ifdef BUILD_HAS_SCMI_FAIR_SCHEDULING
+    RUN_TEST(test_sched_pick_next_none_pending);
+    RUN_TEST(test_sched_pick_next_round_robin);
+    RUN_TEST(test_sched_pick_next_high_class_first);
+    RUN_TEST(test_sched_pick_next_weighted);
+    RUN_TEST(test_qos_get_agent_stats);
+#    if !defined(TEST_ON_TARGET)
+    RUN_TEST(test_sched_signal_dispatch);
+#    endif
+#endif
+
+#ifdef BUILD_HAS_SCMI_RATE_LIMIT
+    RUN_TEST(test_rate_limit_unlimited_protocol);
+    RUN_TEST(test_rate_limit_throttles_over_budget);
+    RUN_TEST(test_rate_limit_reset_stats);
+    RUN_TEST(test_rate_limit_refill);
+#endif
+
+#ifdef BUILD_HAS_SCMI_LATENCY_STATS
+    RUN_TEST(test_latency_stats_record);
+    RUN_TEST(test_latency_stats_table_full);
+    RUN_TEST(test_latency_stats_written_status);
+    RUN_TEST(test_latency_stats_bucket);
+#endif
+
+#ifdef BUILD_HAS_SCMI_NOTIFICATION_COALESCING
+    RUN_TEST(test_notification_coalescing_sent_when_free);
+    RUN_TEST(test_notification_coalescing_latest_value);
+    RUN_TEST(test_notification_coalescing_flush_on_ack);
+    RUN_TEST(test_notification_coalescing_events_kept);
+    RUN_TEST(test_notification_coalescing_flush_retry);
+    RUN_TEST(test_notification_coalescing_get_stats);
+#endif
+
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+    RUN_TEST(test_requester_pipelining_queue);
+    RUN_TEST(test_requester_pipelining_response);
+    RUN_TEST(test_requester_pipelining_channel_busy);
+    RUN_TEST(test_requester_pipelining_timeout);
+#endif
+
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+    RUN_TEST(test_deferred_response_not_supported);
+    RUN_TEST(test_deferred_response_resume);
+#    ifdef BUILD_HAS_SCMI_LATENCY_STATS
+    RUN_TEST(test_deferred_response_latency_by_token);
+#    endif
+#endif
     return UNITY_END();
 }
 
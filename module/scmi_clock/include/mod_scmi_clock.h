@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -24,6 +24,24 @@
  * \{
  */
 
+/*!
+ * \brief SCMI Clock API indices.
+ */
+enum mod_scmi_clock_api_idx {
+    /*! Interface for the SCMI module */
+    MOD_SCMI_CLOCK_API_IDX_PROTOCOL,
+#ifdef BUILD_HAS_SCMI_CLOCK_REQUEST_QUEUE
+    /*! Interface for the request queue statistics */
+    MOD_SCMI_CLOCK_API_IDX_QUEUE_STATS,
+#endif
+#ifdef BUILD_HAS_SCMI_DESCRIBE_IMAGES
+    /*! Interface to signal the changes of the rates of a clock */
+    MOD_SCMI_CLOCK_API_IDX_RATES_UPDATED,
+#endif
+    /*! Number of defined APIs */
+    MOD_SCMI_CLOCK_API_IDX_COUNT,
+};
+
 /*!
  * \brief Permission flags governing the ability to use certain SCMI commands to
  *      interact with a clock.
@@ -113,7 +131,89 @@ struct mod_scmi_clock_config {
 
     /*! Number of agents in ::mod_scmi_clock_config::agent_table */
     size_t agent_count;
+
+#ifdef BUILD_HAS_SCMI_CLOCK_REQUEST_QUEUE
+    /*!
+     * \brief Number of requests that can wait on each clock.
+     *
+     * \details A request received while an operation is in progress on the
+     *      clock is queued, and processed once the operations queued before
+     *      it have completed. A request received while the queue of the clock
+     *      is full is rejected with SCMI_BUSY. When zero, every request
+     *      received while the clock is busy is rejected.
+     */
+    uint8_t request_queue_length;
+#endif
+};
+
+#ifdef BUILD_HAS_SCMI_CLOCK_REQUEST_QUEUE
+/*!
+ * \brief Request queue statistics of a clock device.
+ */
+struct mod_scmi_clock_queue_stats {
+    /*! Number of requests currently waiting in the queue */
+    uint32_t depth;
+
+    /*! Largest number of requests that waited in the queue */
+    uint32_t max_depth;
+
+    /*! Number of requests that waited in the queue */
+    uint32_t queued_count;
+
+    /*! Number of rate reads answered with the result of another rate read */
+    uint32_t coalesced_count;
+
+    /*! Number of requests rejected because the queue was full */
+    uint32_t rejected_count;
+};
+
+/*!
+ * \brief SCMI Clock request queue statistics API.
+ */
+struct mod_scmi_clock_queue_stats_api {
+    /*!
+     * \brief Get the request queue statistics of a clock device.
+     *
+     * \param clock_id Identifier of the clock device element.
+     * \param[out] stats Request queue statistics.
+     *
+     * \retval ::FWK_SUCCESS The statistics were returned.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered:
+     *      - The `clock_id` parameter was not a valid clock device.
+     *      - The `stats` parameter was a null pointer value.
+     */
+    int (*get_queue_stats)(
+        fwk_id_t clock_id,
+        struct mod_scmi_clock_queue_stats *stats);
+};
+#endif
+
+#ifdef BUILD_HAS_SCMI_DESCRIBE_IMAGES
+/*!
+ * \brief SCMI Clock rates update API.
+ */
+struct mod_scmi_clock_rates_updated_api {
+    /*!
+     * \brief Inform SCMI Clock that the discrete rates of a clock have been
+     *      updated.
+     *
+     * \details The DESCRIBE_RATES responses of the clock are built again from
+     *      the new rates on the next request.
+     *
+     * \note A clock driver that changes the discrete rates of a clock without
+     *      changing their number must call this function. Otherwise the agents
+     *      keep being served the previous rates. No clock driver of this tree
+     *      changes its rates at runtime.
+     *
+     * \param clock_id Identifier of the clock device element.
+     *
+     * \retval ::FWK_SUCCESS The rates of the clock will be read again.
+     * \retval ::FWK_E_PARAM The `clock_id` parameter was not a valid clock
+     *      device.
+     */
+    int (*notify_rates_updated)(fwk_id_t clock_id);
 };
+#endif
 
 /*!
  * \defgroup GroupScmiClockPolicyHandlers Policy Handlers
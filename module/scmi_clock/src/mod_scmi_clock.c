@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -33,6 +33,17 @@
 #    include <mod_resource_perms.h>
 #endif
 
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+/* Response of a request deferred on a multi-slot transport channel */
+struct clock_deferred_response {
+    /* Whether the response has been deferred */
+    bool deferred;
+
+    /* Token of the deferred message */
+    uint32_t token;
+};
+#endif
+
 struct clock_operations {
     /*
      * Service identifier currently requesting operation from this clock.
@@ -54,7 +65,68 @@ struct clock_operations {
      * Request type for this operation.
      */
     enum scmi_clock_request_type request;
+
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+    /*
+     * Deferred response for this operation.
+     */
+    struct clock_deferred_response response;
+#endif
+};
+
+#ifdef BUILD_HAS_SCMI_CLOCK_REQUEST_QUEUE
+/* Request waiting for its clock to become available */
+struct clock_queued_request {
+    /* Service identifier of the agent that made the request */
+    fwk_id_t service_id;
+
+    /* SCMI clock index of the request */
+    uint32_t scmi_clock_idx;
+
+    /* Request type */
+    enum scmi_clock_request_type request;
+
+    /* Data of the 'set_' requests */
+    union event_request_data request_data;
+
+#    ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+    /* Deferred response of the request */
+    struct clock_deferred_response response;
+#    endif
+};
+
+/* Bounded FIFO of the requests waiting for a clock */
+struct clock_request_queue {
+    /* Table of entries, of the configured request queue length */
+    struct clock_queued_request *entries;
+
+    /* Index of the oldest request */
+    uint8_t head;
+
+    /* Number of requests in the queue */
+    uint8_t count;
+
+    /* Statistics of the queue */
+    struct mod_scmi_clock_queue_stats stats;
 };
+#endif
+
+#ifdef BUILD_HAS_SCMI_DESCRIBE_IMAGES
+/* DESCRIBE_RATES entries of a clock with a discrete list of rates */
+struct scmi_clock_rates_image {
+    /* Table of serialised rates */
+    struct scmi_clock_rate *rates;
+
+    /* Number of rates in the image */
+    uint64_t rate_count;
+
+    /* Number of rates the table can hold */
+    uint64_t capacity;
+
+    /* The image holds the current rates of the clock */
+    bool valid;
+};
+#endif
 
 struct mod_scmi_clock_ctx {
     /*! SCMI Clock Module Configuration */
@@ -87,6 +159,16 @@ struct mod_scmi_clock_ctx {
     /* Pointer to a table of agent:clock_states */
     uint8_t *agent_clock_state_table;
 
+#ifdef BUILD_HAS_SCMI_DESCRIBE_IMAGES
+    /* Table of DESCRIBE_RATES images, per clock device */
+    struct scmi_clock_rates_image *rates_images;
+#endif
+
+#ifdef BUILD_HAS_SCMI_CLOCK_REQUEST_QUEUE
+    /* Table of request queues, per clock device */
+    struct clock_request_queue *request_queues;
+#endif
+
 #ifdef BUILD_HAS_MOD_RESOURCE_PERMS
     /* SCMI Resource Permissions API */
     const struct mod_res_permissions_api *res_perms_api;
@@ -445,6 +527,10 @@ static void clock_ops_set_busy(
     scmi_clock_ctx.clock_ops[clock_dev_idx].state = state;
     scmi_clock_ctx.clock_ops[clock_dev_idx].scmi_clock_idx = scmi_clock_idx;
     scmi_clock_ctx.clock_ops[clock_dev_idx].request = request;
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+    scmi_clock_ctx.clock_ops[clock_dev_idx].response =
+        (struct clock_deferred_response){ 0 };
+#endif
 }
 
 static void clock_ops_update_state(unsigned int clock_dev_idx, int status)
@@ -483,6 +569,51 @@ static inline bool clock_ops_is_available(unsigned int clock_dev_idx)
                            FWK_ID_NONE);
 }
 
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+/*
+ * Helpers for the responses of the requests which cannot be completed by the
+ * message handler. Deferring them lets the agent have other messages processed
+ * in the meantime when its transport channel has several message slots.
+ */
+static void clock_response_defer(
+    fwk_id_t service_id,
+    struct clock_deferred_response *response)
+{
+    int status;
+
+    if (response->deferred) {
+        return;
+    }
+
+    status =
+        scmi_clock_ctx.scmi_api->defer_response(service_id, &response->token);
+    if (status == FWK_SUCCESS) {
+        response->deferred = true;
+    } else if (status != FWK_E_SUPPORT) {
+        FWK_LOG_DEBUG("[SCMI-CLK] %s @%d", __func__, __LINE__);
+    }
+}
+
+static void clock_response_resume(
+    fwk_id_t service_id,
+    struct clock_deferred_response *response)
+{
+    int status;
+
+    if (!response->deferred) {
+        return;
+    }
+
+    response->deferred = false;
+
+    status =
+        scmi_clock_ctx.scmi_api->resume_response(service_id, response->token);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[SCMI-CLK] %s @%d", __func__, __LINE__);
+    }
+}
+#endif
+
 /*
  * Helper for the 'get_state' response
  */
@@ -687,25 +818,20 @@ static int scmi_clock_permissions_handler(
 #endif
 
 /*
- * Helper to create events for processing pending requests
+ * Helper to put the event processing a request, and mark the clock as busy
  */
-static int create_event_request(
+static int clock_request_put_event(
     fwk_id_t clock_id,
+    unsigned int clock_dev_idx,
     fwk_id_t service_id,
     enum scmi_clock_request_type request,
-    void *data,
+    const union event_request_data *request_data,
     uint32_t scmi_clock_idx)
 {
     int status;
-    union event_request_data request_data;
-    unsigned int clock_dev_idx = fwk_id_get_element_idx(clock_id);
     struct scmi_clock_event_request_params *params;
     enum mod_clock_state state = MOD_CLOCK_STATE_COUNT;
 
-    if (!clock_ops_is_available(clock_dev_idx)) {
-        return FWK_E_BUSY;
-    }
-
     struct fwk_event event = {
         .target_id = fwk_module_id_scmi_clock,
     };
@@ -721,6 +847,195 @@ static int create_event_request(
         event.id = mod_scmi_clock_event_id_get_rate;
         break;
 
+    case SCMI_CLOCK_REQUEST_SET_RATE:
+        event.id = mod_scmi_clock_event_id_set_rate;
+        break;
+
+    case SCMI_CLOCK_REQUEST_SET_STATE:
+        state = request_data->set_state_data.state;
+        event.id = mod_scmi_clock_event_id_set_state;
+        break;
+
+    default:
+        return FWK_E_PARAM;
+    }
+
+    params->clock_dev_id = clock_id;
+    params->request_data = *request_data;
+
+    status = fwk_put_event(&event);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    clock_ops_set_busy(
+        clock_dev_idx, service_id, scmi_clock_idx, state, request);
+
+    return FWK_SUCCESS;
+}
+
+#ifdef BUILD_HAS_SCMI_CLOCK_REQUEST_QUEUE
+/*
+ * Helpers for the queues of requests waiting for a busy clock
+ */
+static int clock_request_queue_push(
+    unsigned int clock_dev_idx,
+    fwk_id_t service_id,
+    enum scmi_clock_request_type request,
+    const union event_request_data *request_data,
+    uint32_t scmi_clock_idx)
+{
+    uint8_t length = scmi_clock_ctx.config->request_queue_length;
+    struct clock_request_queue *queue =
+        &scmi_clock_ctx.request_queues[clock_dev_idx];
+    struct clock_queued_request *entry;
+
+    if (queue->count >= length) {
+        queue->stats.rejected_count++;
+        return FWK_E_BUSY;
+    }
+
+    entry = &queue->entries[(queue->head + queue->count) % length];
+    entry->service_id = service_id;
+    entry->scmi_clock_idx = scmi_clock_idx;
+    entry->request = request;
+    entry->request_data = *request_data;
+#    ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+    entry->response = (struct clock_deferred_response){ 0 };
+    clock_response_defer(service_id, &entry->response);
+#    endif
+
+    queue->count++;
+    queue->stats.queued_count++;
+    if (queue->count > queue->stats.max_depth) {
+        queue->stats.max_depth = queue->count;
+    }
+
+    return FWK_SUCCESS;
+}
+
+static struct clock_queued_request *clock_request_queue_pop(
+    struct clock_request_queue *queue)
+{
+    uint8_t length = scmi_clock_ctx.config->request_queue_length;
+    struct clock_queued_request *entry = &queue->entries[queue->head];
+
+    queue->head = (uint8_t)((queue->head + 1) % length);
+    queue->count--;
+
+    return entry;
+}
+
+/*
+ * Answer the rate reads at the head of the queue of a clock with the result of
+ * the rate read that has just completed. No operation was queued between them
+ * and that read, so the rate cannot have been changed through SCMI since.
+ */
+static void clock_request_queue_answer_rate_gets(
+    unsigned int clock_dev_idx,
+    uint64_t *rate,
+    int status)
+{
+    struct clock_request_queue *queue =
+        &scmi_clock_ctx.request_queues[clock_dev_idx];
+    struct clock_queued_request *entry;
+
+    while ((queue->count > 0) &&
+           (queue->entries[queue->head].request ==
+            SCMI_CLOCK_REQUEST_GET_RATE)) {
+        entry = clock_request_queue_pop(queue);
+#    ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+        clock_response_resume(entry->service_id, &entry->response);
+#    endif
+        get_rate_respond(entry->service_id, rate, status);
+        queue->stats.coalesced_count++;
+    }
+}
+
+/*
+ * Start the oldest request waiting for a clock that has become available
+ */
+static void clock_request_queue_start_next(
+    fwk_id_t clock_id,
+    unsigned int clock_dev_idx)
+{
+    int status;
+    struct clock_request_queue *queue =
+        &scmi_clock_ctx.request_queues[clock_dev_idx];
+    struct clock_queued_request *entry;
+
+    while (queue->count > 0) {
+        entry = clock_request_queue_pop(queue);
+
+        status = clock_request_put_event(
+            clock_id,
+            clock_dev_idx,
+            entry->service_id,
+            entry->request,
+            &entry->request_data,
+            entry->scmi_clock_idx);
+        if (status == FWK_SUCCESS) {
+#    ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+            scmi_clock_ctx.clock_ops[clock_dev_idx].response = entry->response;
+#    endif
+            return;
+        }
+
+#    ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+        clock_response_resume(entry->service_id, &entry->response);
+#    endif
+        request_response(status, entry->service_id);
+    }
+}
+
+static int scmi_clock_get_queue_stats(
+    fwk_id_t clock_id,
+    struct mod_scmi_clock_queue_stats *stats)
+{
+    unsigned int clock_dev_idx;
+    struct clock_request_queue *queue;
+
+    if (stats == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    clock_dev_idx = fwk_id_get_element_idx(clock_id);
+    if (clock_dev_idx >= (unsigned int)scmi_clock_ctx.clock_devices) {
+        return FWK_E_PARAM;
+    }
+
+    queue = &scmi_clock_ctx.request_queues[clock_dev_idx];
+
+    *stats = queue->stats;
+    stats->depth = queue->count;
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_scmi_clock_queue_stats_api
+    scmi_clock_queue_stats_api = {
+        .get_queue_stats = scmi_clock_get_queue_stats,
+};
+#endif
+
+/*
+ * Helper to create events for processing pending requests
+ */
+static int create_event_request(
+    fwk_id_t clock_id,
+    fwk_id_t service_id,
+    enum scmi_clock_request_type request,
+    void *data,
+    uint32_t scmi_clock_idx)
+{
+    union event_request_data request_data = { 0 };
+    unsigned int clock_dev_idx = fwk_id_get_element_idx(clock_id);
+
+    switch (request) {
+    case SCMI_CLOCK_REQUEST_GET_STATE:
+    case SCMI_CLOCK_REQUEST_GET_RATE:
+        break;
+
     case SCMI_CLOCK_REQUEST_SET_RATE:
         {
         struct event_set_rate_request_data *rate_data =
@@ -729,11 +1044,7 @@ static int create_event_request(
         request_data.set_rate_data.rate[0] = rate_data->rate[0];
         request_data.set_rate_data.rate[1] = rate_data->rate[1];
         request_data.set_rate_data.round_mode = rate_data->round_mode;
-
-        params->request_data = request_data;
         }
-
-        event.id = mod_scmi_clock_event_id_set_rate;
         break;
 
     case SCMI_CLOCK_REQUEST_SET_STATE:
@@ -741,29 +1052,29 @@ static int create_event_request(
         struct event_set_state_request_data *state_data =
             (struct event_set_state_request_data *)data;
         request_data.set_state_data.state = state_data->state;
-        state = state_data->state;
-
-        params->request_data = request_data;
         }
-
-        event.id = mod_scmi_clock_event_id_set_state;
         break;
 
     default:
         return FWK_E_PARAM;
     }
 
-    params->clock_dev_id = clock_id;
-
-    status = fwk_put_event(&event);
-    if (status != FWK_SUCCESS) {
-        return status;
+    if (!clock_ops_is_available(clock_dev_idx)) {
+#ifdef BUILD_HAS_SCMI_CLOCK_REQUEST_QUEUE
+        return clock_request_queue_push(
+            clock_dev_idx, service_id, request, &request_data, scmi_clock_idx);
+#else
+        return FWK_E_BUSY;
+#endif
     }
 
-    clock_ops_set_busy(
-        clock_dev_idx, service_id, scmi_clock_idx, state, request);
-
-    return FWK_SUCCESS;
+    return clock_request_put_event(
+        clock_id,
+        clock_dev_idx,
+        service_id,
+        request,
+        &request_data,
+        scmi_clock_idx);
 }
 
 /*
@@ -1190,19 +1501,147 @@ exit:
 /*
  * Clock Describe Rates
  */
+#ifdef BUILD_HAS_SCMI_DESCRIBE_IMAGES
+/*
+ * Get the image of the rates of a clock, as they are sent in DESCRIBE_RATES
+ * responses, building it if it is not valid. The clock drivers may not be
+ * ready before the first request, so the image is only built then. NULL is
+ * returned if the image cannot be built, in which case the rates are read
+ * from the clock instead.
+ */
+static const struct scmi_clock_rates_image *scmi_clock_rates_image_get(
+    fwk_id_t clock_id,
+    uint64_t rate_count)
+{
+    struct scmi_clock_rates_image *image;
+    struct scmi_clock_rate *rates;
+    unsigned int index;
+    uint64_t rate;
+    int status;
+
+    image = &scmi_clock_ctx.rates_images[fwk_id_get_element_idx(clock_id)];
+    if (image->valid && (image->rate_count == rate_count)) {
+        return image;
+    }
+
+    image->valid = false;
+
+    if (rate_count > image->capacity) {
+        /* The previous table is kept if it cannot be grown */
+        rates = fwk_mm_realloc(
+            image->rates, (size_t)rate_count, sizeof(image->rates[0]));
+        if (rates == NULL) {
+            return NULL;
+        }
+
+        image->rates = rates;
+        image->capacity = rate_count;
+    }
+
+    for (index = 0; index < rate_count; index++) {
+        status = scmi_clock_ctx.clock_api->get_rate_from_index(
+            clock_id, index, &rate);
+        if (status != FWK_SUCCESS) {
+            return NULL;
+        }
+
+        image->rates[index].low = (uint32_t)rate;
+        image->rates[index].high = (uint32_t)(rate >> 32);
+    }
+
+    image->rate_count = rate_count;
+    image->valid = true;
+
+    return image;
+}
+
+static int scmi_clock_notify_rates_updated(fwk_id_t clock_id)
+{
+    unsigned int clock_dev_idx;
+
+    clock_dev_idx = fwk_id_get_element_idx(clock_id);
+    if (clock_dev_idx >= (unsigned int)scmi_clock_ctx.clock_devices) {
+        return FWK_E_PARAM;
+    }
+
+    scmi_clock_ctx.rates_images[clock_dev_idx].valid = false;
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_scmi_clock_rates_updated_api
+    scmi_clock_rates_updated_api = {
+        .notify_rates_updated = scmi_clock_notify_rates_updated,
+};
+#endif
+
+/*
+ * Write the discrete rates of a clock to the DESCRIBE_RATES response, after
+ * the rates already written.
+ */
+static int scmi_clock_write_rates(
+    fwk_id_t service_id,
+    fwk_id_t clock_id,
+    const struct mod_clock_info *info,
+    uint32_t index,
+    unsigned int rate_count,
+    uint32_t *payload_size)
+{
+    struct scmi_clock_rate scmi_rate;
+    uint64_t rate;
+    int status;
+#ifdef BUILD_HAS_SCMI_DESCRIBE_IMAGES
+    const struct scmi_clock_rates_image *image;
+
+    image = scmi_clock_rates_image_get(clock_id, info->range.rate_count);
+    if (image != NULL) {
+        /* Copy the rate entries from the image of the clock at once */
+        status = scmi_clock_ctx.scmi_api->write_payload(
+            service_id,
+            *payload_size,
+            &image->rates[index],
+            rate_count * sizeof(image->rates[0]));
+        if (status == FWK_SUCCESS) {
+            *payload_size += (uint32_t)(rate_count * sizeof(image->rates[0]));
+        }
+
+        return status;
+    }
+#endif
+
+    /* Set each rate entry in the payload to the associated frequency */
+    for (; rate_count > 0; rate_count--, index++) {
+        status = scmi_clock_ctx.clock_api->get_rate_from_index(
+            clock_id, index, &rate);
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+
+        scmi_rate.low = (uint32_t)rate;
+        scmi_rate.high = (uint32_t)(rate >> 32);
+
+        status = scmi_clock_ctx.scmi_api->write_payload(
+            service_id, *payload_size, &scmi_rate, sizeof(scmi_rate));
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+
+        *payload_size += (uint32_t)sizeof(scmi_rate);
+    }
+
+    return FWK_SUCCESS;
+}
+
 static int scmi_clock_describe_rates_handler(fwk_id_t service_id,
     const uint32_t *payload)
 {
     int status, respond_status;
     const struct mod_scmi_clock_device *clock_device;
-    unsigned int i;
     size_t max_payload_size;
     uint32_t payload_size;
     uint32_t index;
     unsigned int rate_count;
     unsigned int remaining_rates;
-    uint64_t rate;
-    struct scmi_clock_rate scmi_rate;
     struct scmi_clock_rate clock_range[3];
     struct mod_clock_info info;
     const struct scmi_clock_describe_rates_a2p *parameters;
@@ -1289,25 +1728,15 @@ static int scmi_clock_describe_rates_handler(fwk_id_t service_id,
                 remaining_rates
             );
 
-        /* Set each rate entry in the payload to the associated frequency */
-        for (i = 0; i < rate_count;
-             i++, payload_size += (uint32_t)sizeof(struct scmi_clock_rate)) {
-            status = scmi_clock_ctx.clock_api->get_rate_from_index(
-                clock_device->element_id,
-                index + i,
-                &rate);
-            if (status != FWK_SUCCESS) {
-                goto exit;
-            }
-
-            scmi_rate.low = (uint32_t)rate;
-            scmi_rate.high = (uint32_t)(rate >> 32);
-
-            status = scmi_clock_ctx.scmi_api->write_payload(service_id,
-                payload_size, &scmi_rate, sizeof(scmi_rate));
-            if (status != FWK_SUCCESS) {
-                goto exit;
-            }
+        status = scmi_clock_write_rates(
+            service_id,
+            clock_device->element_id,
+            &info,
+            index,
+            rate_count,
+            &payload_size);
+        if (status != FWK_SUCCESS) {
+            goto exit;
         }
     } else {
         /* The clock has a linear stepping */
@@ -1441,6 +1870,27 @@ static int scmi_clock_init(fwk_id_t module_id, unsigned int element_count,
     clock_ref_count_allocate();
     clock_ref_count_init();
 
+#ifdef BUILD_HAS_SCMI_DESCRIBE_IMAGES
+    scmi_clock_ctx.rates_images = fwk_mm_calloc(
+        (unsigned int)clock_devices, sizeof(scmi_clock_ctx.rates_images[0]));
+#endif
+
+#ifdef BUILD_HAS_SCMI_CLOCK_REQUEST_QUEUE
+    scmi_clock_ctx.request_queues = fwk_mm_calloc(
+        (unsigned int)clock_devices, sizeof(scmi_clock_ctx.request_queues[0]));
+
+    if (config->request_queue_length > 0) {
+        struct clock_queued_request *entries = fwk_mm_calloc(
+            (unsigned int)clock_devices * config->request_queue_length,
+            sizeof(entries[0]));
+
+        for (unsigned int i = 0; i < (unsigned int)clock_devices; i++) {
+            scmi_clock_ctx.request_queues[i].entries =
+                &entries[i * config->request_queue_length];
+        }
+    }
+#endif
+
     return FWK_SUCCESS;
 }
 
@@ -1476,6 +1926,24 @@ static int scmi_clock_bind(fwk_id_t id, unsigned int round)
 static int scmi_clock_process_bind_request(fwk_id_t source_id,
     fwk_id_t target_id, fwk_id_t api_id, const void **api)
 {
+#ifdef BUILD_HAS_SCMI_CLOCK_REQUEST_QUEUE
+    if (fwk_id_get_api_idx(api_id) ==
+        (unsigned int)MOD_SCMI_CLOCK_API_IDX_QUEUE_STATS) {
+        *api = &scmi_clock_queue_stats_api;
+
+        return FWK_SUCCESS;
+    }
+#endif
+
+#ifdef BUILD_HAS_SCMI_DESCRIBE_IMAGES
+    if (fwk_id_get_api_idx(api_id) ==
+        (unsigned int)MOD_SCMI_CLOCK_API_IDX_RATES_UPDATED) {
+        *api = &scmi_clock_rates_updated_api;
+
+        return FWK_SUCCESS;
+    }
+#endif
+
     if (!fwk_id_is_equal(source_id, FWK_ID_MODULE(FWK_MODULE_IDX_SCMI))) {
         return FWK_E_ACCESS;
     }
@@ -1517,6 +1985,10 @@ static int process_request_event(const struct fwk_event *event)
         agent_clock_state =
             scmi_clock_get_agent_clock_state(agent_id, scmi_clock_idx);
         clock_state = (enum mod_clock_state)agent_clock_state;
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+        clock_response_resume(
+            service_id, &scmi_clock_ctx.clock_ops[clock_dev_idx].response);
+#endif
         get_state_respond(
             params->clock_dev_id, service_id, &clock_state, status);
         break;
@@ -1526,7 +1998,15 @@ static int process_request_event(const struct fwk_event *event)
                                                     &rate);
         if (status != FWK_PENDING) {
             /* Request completed */
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+            clock_response_resume(
+                service_id, &scmi_clock_ctx.clock_ops[clock_dev_idx].response);
+#endif
             get_rate_respond(service_id, &rate, status);
+#ifdef BUILD_HAS_SCMI_CLOCK_REQUEST_QUEUE
+            clock_request_queue_answer_rate_gets(clock_dev_idx, &rate, status);
+            status = FWK_SUCCESS;
+#endif
         }
         break;
 
@@ -1542,6 +2022,10 @@ static int process_request_event(const struct fwk_event *event)
                                                set_rate_data.round_mode);
         if (status != FWK_PENDING) {
             /* Request completed */
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+            clock_response_resume(
+                service_id, &scmi_clock_ctx.clock_ops[clock_dev_idx].response);
+#endif
             set_request_respond(service_id, status);
             status = FWK_SUCCESS;
         }
@@ -1554,6 +2038,10 @@ static int process_request_event(const struct fwk_event *event)
                                                      set_state_data.state);
         if (status != FWK_PENDING) {
             /* Request completed */
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+            clock_response_resume(
+                service_id, &scmi_clock_ctx.clock_ops[clock_dev_idx].response);
+#endif
             set_request_respond(service_id, status);
             clock_ops_update_state(clock_dev_idx, status);
             status = FWK_SUCCESS;
@@ -1565,11 +2053,18 @@ static int process_request_event(const struct fwk_event *event)
     }
 
     if (status == FWK_PENDING) {
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+        clock_response_defer(
+            service_id, &scmi_clock_ctx.clock_ops[clock_dev_idx].response);
+#endif
         return FWK_SUCCESS;
     }
 
     if (status == FWK_SUCCESS) {
         clock_ops_set_available(clock_dev_idx);
+#ifdef BUILD_HAS_SCMI_CLOCK_REQUEST_QUEUE
+        clock_request_queue_start_next(params->clock_dev_id, clock_dev_idx);
+#endif
     }
 
     return status;
@@ -1588,6 +2083,11 @@ static int process_response_event(const struct fwk_event *event)
     clock_dev_idx = fwk_id_get_element_idx(event->source_id);
     service_id = clock_ops_get_service(clock_dev_idx);
 
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+    clock_response_resume(
+        service_id, &scmi_clock_ctx.clock_ops[clock_dev_idx].response);
+#endif
+
     if (params->status != FWK_SUCCESS) {
         request_response(params->status, service_id);
     } else {
@@ -1607,6 +2107,10 @@ static int process_response_event(const struct fwk_event *event)
             rate = params->value.rate;
 
             get_rate_respond(service_id, &rate, FWK_SUCCESS);
+#ifdef BUILD_HAS_SCMI_CLOCK_REQUEST_QUEUE
+            clock_request_queue_answer_rate_gets(
+                clock_dev_idx, &rate, FWK_SUCCESS);
+#endif
 
             break;
 
@@ -1626,6 +2130,9 @@ static int process_response_event(const struct fwk_event *event)
         }
     }
     clock_ops_set_available(clock_dev_idx);
+#ifdef BUILD_HAS_SCMI_CLOCK_REQUEST_QUEUE
+    clock_request_queue_start_next(event->source_id, clock_dev_idx);
+#endif
 
     return FWK_SUCCESS;
 }
@@ -1645,12 +2152,20 @@ static int scmi_clock_process_event(const struct fwk_event *event,
         return process_response_event(event);
     }
 
+#ifdef BUILD_HAS_SCMI_CLOCK_REQUEST_QUEUE
+    if (fwk_id_get_module_idx(event->source_id) ==
+        fwk_id_get_module_idx(fwk_module_id_scmi_clock)) {
+        /* Queued requests, started by this module */
+        return process_request_event(event);
+    }
+#endif
+
     return FWK_E_PARAM;
 }
 
 /* SCMI Clock Management Protocol Definition */
 const struct fwk_module module_scmi_clock = {
-    .api_count = 1,
+    .api_count = (unsigned int)MOD_SCMI_CLOCK_API_IDX_COUNT,
     .event_count = (unsigned int)SCMI_CLOCK_EVENT_IDX_COUNT,
     .type = FWK_MODULE_TYPE_PROTOCOL,
     .init = scmi_clock_init,
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -108,11 +108,21 @@ struct fwk_module_config config_scmi_clock = {
         .max_pending_transactions = 0,
         .agent_table = agent_table,
         .agent_count = FWK_ARRAY_SIZE(agent_table),
+#ifdef BUILD_HAS_SCMI_CLOCK_REQUEST_QUEUE
+        .request_queue_length = 2,
+#endif
     }),
 };
 
 static struct clock_operations clock_ops_table[CLOCK_DEV_IDX_COUNT];
 
+#ifdef BUILD_HAS_SCMI_CLOCK_REQUEST_QUEUE
+static struct clock_request_queue request_queue_table[CLOCK_DEV_IDX_COUNT];
+
+static struct clock_queued_request
+    queued_request_table[CLOCK_DEV_IDX_COUNT][2];
+#endif
+
 static uint8_t agent_clock_state_table
     [FAKE_SCMI_AGENT_IDX_COUNT * CLOCK_DEV_IDX_COUNT];
 
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2022-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -34,6 +34,34 @@
 
 static struct mod_scmi_clock_ctx scmi_clock_ctx;
 
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+static bool defer_supported;
+static unsigned int defer_count;
+static uint32_t next_deferred_token;
+static unsigned int resume_count;
+static uint32_t resumed_token;
+
+static int test_defer_response(fwk_id_t service_id, uint32_t *token)
+{
+    if (!defer_supported) {
+        return FWK_E_SUPPORT;
+    }
+
+    defer_count++;
+    *token = next_deferred_token++;
+
+    return FWK_SUCCESS;
+}
+
+static int test_resume_response(fwk_id_t service_id, uint32_t token)
+{
+    resume_count++;
+    resumed_token = token;
+
+    return FWK_SUCCESS;
+}
+#endif
+
 struct mod_scmi_from_protocol_api from_protocol_api = {
     .get_agent_count = mod_scmi_from_protocol_api_get_agent_count,
     .get_agent_id = mod_scmi_from_protocol_api_get_agent_id,
@@ -43,6 +71,10 @@ struct mod_scmi_from_protocol_api from_protocol_api = {
     .respond = mod_scmi_from_protocol_api_respond,
     .scmi_message_validation = mod_scmi_from_protocol_api_scmi_frame_validation,
     .notify = mod_scmi_from_protocol_api_notify,
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+    .defer_response = test_defer_response,
+    .resume_response = test_resume_response,
+#endif
 };
 
 #if defined(BUILD_HAS_MOD_RESOURCE_PERMS)
@@ -121,7 +153,21 @@ void setUp(void)
         scmi_clock_ctx.clock_ops[i].service_id = FWK_ID_NONE;
     }
 
+#ifdef BUILD_HAS_SCMI_CLOCK_REQUEST_QUEUE
+    memset(request_queue_table, 0, sizeof(request_queue_table));
+    for (unsigned int i = 0; i < CLOCK_DEV_IDX_COUNT; i++) {
+        request_queue_table[i].entries = queued_request_table[i];
+    }
+    scmi_clock_ctx.request_queues = request_queue_table;
+#endif
+
     scmi_clock_ctx.scmi_api = &from_protocol_api;
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+    defer_supported = false;
+    defer_count = 0;
+    next_deferred_token = 0x10;
+    resume_count = 0;
+#endif
     #if defined(BUILD_HAS_MOD_RESOURCE_PERMS)
         scmi_clock_ctx.res_perms_api = &perm_api;
     #endif
@@ -697,6 +743,486 @@ void test_mod_scmi_clock_state_update_ref_count_1_stopped(void)
     assert_clock_state_and_ref_count_meets_expectations();
 }
 
+#ifdef BUILD_HAS_SCMI_DESCRIBE_IMAGES
+#    define TEST_RATE_COUNT 4
+
+static struct scmi_clock_rate test_rates[TEST_RATE_COUNT];
+static struct scmi_clock_rates_image test_rates_images[CLOCK_DEV_IDX_COUNT];
+static unsigned int get_rate_from_index_count;
+static size_t rates_written_size;
+static struct scmi_clock_rate first_rate_written;
+
+static int test_clock_get_info(fwk_id_t clock_id, struct mod_clock_info *info)
+{
+    *info = (struct mod_clock_info){
+        .range = {
+            .rate_type = MOD_CLOCK_RATE_TYPE_DISCRETE,
+            .rate_count = TEST_RATE_COUNT,
+        },
+    };
+
+    return FWK_SUCCESS;
+}
+
+static int test_clock_get_rate_from_index(
+    fwk_id_t clock_id,
+    unsigned int rate_index,
+    uint64_t *rate)
+{
+    get_rate_from_index_count++;
+    *rate = ((uint64_t)(rate_index + 1) << 32) | (rate_index * 1000);
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_clock_api test_clock_api = {
+    .get_info = test_clock_get_info,
+    .get_rate_from_index = test_clock_get_rate_from_index,
+};
+
+int describe_rates_write_payload_callback(
+    fwk_id_t service_id,
+    size_t offset,
+    const void *payload,
+    size_t size,
+    int NumCalls)
+{
+    /* Record the rates, written after the header */
+    if (offset == sizeof(struct scmi_clock_describe_rates_p2a)) {
+        rates_written_size = size;
+        first_rate_written = *(const struct scmi_clock_rate *)payload;
+    }
+
+    return FWK_SUCCESS;
+}
+
+static void describe_rates_image_setup(uint64_t capacity)
+{
+    memset(test_rates_images, 0, sizeof(test_rates_images));
+    if (capacity > 0) {
+        test_rates_images[CLOCK_DEV_IDX_FAKE0].rates = test_rates;
+        test_rates_images[CLOCK_DEV_IDX_FAKE0].capacity = capacity;
+    }
+    scmi_clock_ctx.rates_images = test_rates_images;
+    scmi_clock_ctx.clock_api = &test_clock_api;
+    get_rate_from_index_count = 0;
+    rates_written_size = 0;
+
+    mod_scmi_from_protocol_api_write_payload_Stub(
+        describe_rates_write_payload_callback);
+}
+
+static void describe_rates_request(uint32_t rate_index)
+{
+    int status;
+    unsigned int agent_id = FAKE_SCMI_AGENT_IDX_OSPM0;
+    size_t max_payload_size = UINT16_MAX;
+
+    struct scmi_clock_describe_rates_a2p payload = {
+        .clock_id = SCMI_CLOCK_OSPM0_IDX0,
+        .rate_index = rate_index,
+    };
+
+    fwk_id_t service_id =
+        FWK_ID_ELEMENT_INIT(FAKE_MODULE_IDX, FAKE_SCMI_AGENT_IDX_OSPM0);
+
+    mod_scmi_from_protocol_api_get_agent_id_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    mod_scmi_from_protocol_api_get_agent_id_ReturnThruPtr_agent_id(&agent_id);
+    fwk_module_is_valid_element_id_ExpectAnyArgsAndReturn(true);
+    mod_scmi_from_protocol_api_get_max_payload_size_ExpectAnyArgsAndReturn(
+        FWK_SUCCESS);
+    mod_scmi_from_protocol_api_get_max_payload_size_ReturnThruPtr_size(
+        &max_payload_size);
+    mod_scmi_from_protocol_api_respond_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+
+    status = scmi_clock_describe_rates_handler(
+        service_id, (const uint32_t *)&payload);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+/*
+ * Test that the rates of a clock are read once, and served from the image of
+ * the clock afterwards
+ */
+void test_describe_rates_image_reused(void)
+{
+    describe_rates_image_setup(TEST_RATE_COUNT);
+
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(CLOCK_DEV_IDX_FAKE0);
+    describe_rates_request(0);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(CLOCK_DEV_IDX_FAKE0);
+    describe_rates_request(1);
+
+    TEST_ASSERT_EQUAL(TEST_RATE_COUNT, get_rate_from_index_count);
+    TEST_ASSERT_EQUAL(
+        sizeof(struct scmi_clock_rate) * (TEST_RATE_COUNT - 1),
+        rates_written_size);
+    TEST_ASSERT_EQUAL(1000, first_rate_written.low);
+    TEST_ASSERT_EQUAL(2, first_rate_written.high);
+}
+
+/* Test that the image is built again once the rates have been updated */
+void test_describe_rates_image_invalidated(void)
+{
+    const struct mod_scmi_clock_rates_updated_api *api;
+    fwk_id_t clock_id =
+        FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_CLOCK, CLOCK_DEV_IDX_FAKE0);
+
+    describe_rates_image_setup(TEST_RATE_COUNT);
+
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(CLOCK_DEV_IDX_FAKE0);
+    describe_rates_request(0);
+
+#    ifdef BUILD_HAS_SCMI_CLOCK_REQUEST_QUEUE
+    fwk_id_get_api_idx_ExpectAnyArgsAndReturn(
+        MOD_SCMI_CLOCK_API_IDX_RATES_UPDATED);
+#    endif
+    fwk_id_get_api_idx_ExpectAnyArgsAndReturn(
+        MOD_SCMI_CLOCK_API_IDX_RATES_UPDATED);
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        scmi_clock_process_bind_request(
+            fwk_module_id_clock,
+            fwk_module_id_scmi_clock,
+            FWK_ID_API(
+                FWK_MODULE_IDX_SCMI_CLOCK,
+                MOD_SCMI_CLOCK_API_IDX_RATES_UPDATED),
+            (const void **)&api));
+
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(CLOCK_DEV_IDX_COUNT);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, api->notify_rates_updated(clock_id));
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(CLOCK_DEV_IDX_FAKE0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, api->notify_rates_updated(clock_id));
+
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(CLOCK_DEV_IDX_FAKE0);
+    describe_rates_request(0);
+
+    TEST_ASSERT_EQUAL(2 * TEST_RATE_COUNT, get_rate_from_index_count);
+}
+
+/*
+ * Test that the rates are read from the clock one at a time when there is no
+ * memory for the image
+ */
+void test_describe_rates_image_no_memory(void)
+{
+    describe_rates_image_setup(0);
+
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(CLOCK_DEV_IDX_FAKE0);
+    fwk_mm_realloc_ExpectAndReturn(
+        NULL, TEST_RATE_COUNT, sizeof(struct scmi_clock_rate), NULL);
+    describe_rates_request(0);
+
+    TEST_ASSERT_EQUAL(TEST_RATE_COUNT, get_rate_from_index_count);
+    TEST_ASSERT_EQUAL(sizeof(struct scmi_clock_rate), rates_written_size);
+    TEST_ASSERT_FALSE(test_rates_images[CLOCK_DEV_IDX_FAKE0].valid);
+    TEST_ASSERT_NULL(test_rates_images[CLOCK_DEV_IDX_FAKE0].rates);
+}
+#endif
+
+#ifdef BUILD_HAS_SCMI_CLOCK_REQUEST_QUEUE
+static unsigned int queue_get_rate_count;
+static fwk_id_t queue_put_event_id;
+
+static int queue_clock_get_rate(fwk_id_t clock_id, uint64_t *rate)
+{
+    queue_get_rate_count++;
+    *rate = UINT64_C(0x100000200);
+
+    return FWK_SUCCESS;
+}
+
+static int queue_clock_set_rate(
+    fwk_id_t clock_id,
+    uint64_t rate,
+    enum mod_clock_round_mode round_mode)
+{
+    return FWK_SUCCESS;
+}
+
+static const struct mod_clock_api queue_clock_api = {
+    .get_rate = queue_clock_get_rate,
+    .set_rate = queue_clock_set_rate,
+};
+
+static int queue_put_event_callback(struct fwk_event *event, int NumCalls)
+{
+    queue_put_event_id = event->id;
+
+    return FWK_SUCCESS;
+}
+
+static int queue_rate_get_respond_callback(
+    fwk_id_t service_id,
+    const void *payload,
+    size_t size,
+    int NumCalls)
+{
+    const struct scmi_clock_rate_get_p2a *return_values = payload;
+
+    TEST_ASSERT_EQUAL(sizeof(*return_values), size);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, return_values->status);
+    TEST_ASSERT_EQUAL(0x200, return_values->rate[0]);
+    TEST_ASSERT_EQUAL(0x1, return_values->rate[1]);
+
+    return FWK_SUCCESS;
+}
+
+static void queue_set_clock_busy(
+    fwk_id_t service_id,
+    enum scmi_clock_request_type request)
+{
+    clock_ops_set_busy(
+        CLOCK_DEV_IDX_FAKE0,
+        service_id,
+        SCMI_CLOCK_OSPM0_IDX0,
+        MOD_CLOCK_STATE_COUNT,
+        request);
+}
+
+static int queue_request(fwk_id_t service_id, enum scmi_clock_request_type req)
+{
+    struct event_set_rate_request_data rate_data = {
+        .round_mode = MOD_CLOCK_ROUND_MODE_NEAREST,
+    };
+
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(CLOCK_DEV_IDX_FAKE0);
+    fwk_id_is_equal_ExpectAnyArgsAndReturn(false);
+
+    return create_event_request(
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_CLOCK, CLOCK_DEV_IDX_FAKE0),
+        service_id,
+        req,
+        &rate_data,
+        SCMI_CLOCK_OSPM0_IDX0);
+}
+
+/*
+ * Test that rate reads received while a rate read is in progress are queued,
+ * and answered with the result of that read
+ */
+void test_queue_rate_get_coalesced(void)
+{
+    int status;
+    struct mod_scmi_clock_queue_stats stats;
+    struct fwk_event event = { 0 };
+    struct scmi_clock_event_request_params *params =
+        (struct scmi_clock_event_request_params *)event.params;
+
+    fwk_id_t service_ospm0 =
+        FWK_ID_ELEMENT_INIT(FAKE_MODULE_IDX, FAKE_SCMI_AGENT_IDX_OSPM0);
+    fwk_id_t service_ospm1 =
+        FWK_ID_ELEMENT_INIT(FAKE_MODULE_IDX, FAKE_SCMI_AGENT_IDX_OSPM1);
+
+    scmi_clock_ctx.clock_api = &queue_clock_api;
+    queue_get_rate_count = 0;
+    queue_set_clock_busy(service_ospm0, SCMI_CLOCK_REQUEST_GET_RATE);
+
+    status = queue_request(service_ospm1, SCMI_CLOCK_REQUEST_GET_RATE);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    status = queue_request(service_ospm0, SCMI_CLOCK_REQUEST_GET_RATE);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* The queue is full */
+    status = queue_request(service_ospm1, SCMI_CLOCK_REQUEST_GET_RATE);
+    TEST_ASSERT_EQUAL(FWK_E_BUSY, status);
+
+    /* Complete the read in progress, answering the queued reads too */
+    params->clock_dev_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_CLOCK, CLOCK_DEV_IDX_FAKE0);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(CLOCK_DEV_IDX_FAKE0);
+    fwk_id_get_event_idx_ExpectAnyArgsAndReturn(SCMI_CLOCK_EVENT_IDX_GET_RATE);
+    mod_scmi_from_protocol_api_respond_Stub(queue_rate_get_respond_callback);
+
+    status = process_request_event(&event);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, queue_get_rate_count);
+    TEST_ASSERT_EQUAL(
+        FWK_ID_NONE.value,
+        clock_ops_table[CLOCK_DEV_IDX_FAKE0].service_id.value);
+    mod_scmi_from_protocol_api_respond_Stub(NULL);
+
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(CLOCK_DEV_IDX_FAKE0);
+    status = scmi_clock_get_queue_stats(params->clock_dev_id, &stats);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(0, stats.depth);
+    TEST_ASSERT_EQUAL(2, stats.max_depth);
+    TEST_ASSERT_EQUAL(2, stats.queued_count);
+    TEST_ASSERT_EQUAL(2, stats.coalesced_count);
+    TEST_ASSERT_EQUAL(1, stats.rejected_count);
+}
+
+/*
+ * Test that the oldest queued request is started when the operation in
+ * progress completes
+ */
+void test_queue_start_next_on_completion(void)
+{
+    int status;
+    struct fwk_event event = { 0 };
+    struct scmi_clock_event_request_params *params =
+        (struct scmi_clock_event_request_params *)event.params;
+
+    fwk_id_t service_ospm0 =
+        FWK_ID_ELEMENT_INIT(FAKE_MODULE_IDX, FAKE_SCMI_AGENT_IDX_OSPM0);
+    fwk_id_t service_ospm1 =
+        FWK_ID_ELEMENT_INIT(FAKE_MODULE_IDX, FAKE_SCMI_AGENT_IDX_OSPM1);
+
+    scmi_clock_ctx.clock_api = &queue_clock_api;
+    queue_get_rate_count = 0;
+    queue_set_clock_busy(service_ospm0, SCMI_CLOCK_REQUEST_SET_RATE);
+
+    status = queue_request(service_ospm1, SCMI_CLOCK_REQUEST_GET_RATE);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* Complete the rate change, which starts the queued read */
+    params->clock_dev_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_CLOCK, CLOCK_DEV_IDX_FAKE0);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(CLOCK_DEV_IDX_FAKE0);
+    fwk_id_get_event_idx_ExpectAnyArgsAndReturn(SCMI_CLOCK_EVENT_IDX_SET_RATE);
+    mod_scmi_from_protocol_api_respond_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    __fwk_put_event_Stub(queue_put_event_callback);
+
+    status = process_request_event(&event);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(0, queue_get_rate_count);
+    TEST_ASSERT_EQUAL(
+        mod_scmi_clock_event_id_get_rate.value, queue_put_event_id.value);
+    TEST_ASSERT_EQUAL(
+        service_ospm1.value,
+        clock_ops_table[CLOCK_DEV_IDX_FAKE0].service_id.value);
+    TEST_ASSERT_EQUAL(
+        SCMI_CLOCK_REQUEST_GET_RATE,
+        clock_ops_table[CLOCK_DEV_IDX_FAKE0].request);
+    TEST_ASSERT_EQUAL(0, request_queue_table[CLOCK_DEV_IDX_FAKE0].count);
+}
+
+#    ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+static int deferred_clock_set_rate(
+    fwk_id_t clock_id,
+    uint64_t rate,
+    enum mod_clock_round_mode round_mode)
+{
+    return FWK_PENDING;
+}
+
+static const struct mod_clock_api deferred_clock_api = {
+    .get_rate = queue_clock_get_rate,
+    .set_rate = deferred_clock_set_rate,
+};
+
+static int deferred_respond_callback(
+    fwk_id_t service_id,
+    const void *payload,
+    size_t size,
+    int NumCalls)
+{
+    /* The deferred message must be resumed before it is responded to */
+    TEST_ASSERT_EQUAL(1, resume_count);
+
+    return FWK_SUCCESS;
+}
+
+/*
+ * Test that the response to a request completed asynchronously by the clock
+ * driver is deferred, and resumed when the driver completes the request
+ */
+void test_deferred_response_on_pending(void)
+{
+    int status;
+    struct fwk_event event = { 0 };
+    struct scmi_clock_event_request_params *params =
+        (struct scmi_clock_event_request_params *)event.params;
+    struct mod_clock_resp_params *resp_params =
+        (struct mod_clock_resp_params *)event.params;
+
+    fwk_id_t service_ospm0 =
+        FWK_ID_ELEMENT_INIT(FAKE_MODULE_IDX, FAKE_SCMI_AGENT_IDX_OSPM0);
+
+    scmi_clock_ctx.clock_api = &deferred_clock_api;
+    defer_supported = true;
+    queue_set_clock_busy(service_ospm0, SCMI_CLOCK_REQUEST_SET_RATE);
+
+    params->clock_dev_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_CLOCK, CLOCK_DEV_IDX_FAKE0);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(CLOCK_DEV_IDX_FAKE0);
+    fwk_id_get_event_idx_ExpectAnyArgsAndReturn(SCMI_CLOCK_EVENT_IDX_SET_RATE);
+
+    status = process_request_event(&event);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, defer_count);
+    TEST_ASSERT_EQUAL(0, resume_count);
+    TEST_ASSERT_TRUE(clock_ops_table[CLOCK_DEV_IDX_FAKE0].response.deferred);
+
+    /* The clock driver completes the rate change */
+    event = (struct fwk_event){
+        .source_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_CLOCK, CLOCK_DEV_IDX_FAKE0),
+    };
+    resp_params->status = FWK_SUCCESS;
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(CLOCK_DEV_IDX_FAKE0);
+    fwk_id_get_event_idx_ExpectAnyArgsAndReturn(
+        MOD_CLOCK_EVENT_IDX_SET_RATE_REQUEST);
+    mod_scmi_from_protocol_api_respond_Stub(deferred_respond_callback);
+
+    status = process_response_event(&event);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(0x10, resumed_token);
+    TEST_ASSERT_FALSE(clock_ops_table[CLOCK_DEV_IDX_FAKE0].response.deferred);
+    mod_scmi_from_protocol_api_respond_Stub(NULL);
+}
+
+/*
+ * Test that a request waiting for its clock is deferred, and that the deferred
+ * message follows the request once started
+ */
+void test_deferred_response_queued(void)
+{
+    int status;
+    struct fwk_event event = { 0 };
+    struct scmi_clock_event_request_params *params =
+        (struct scmi_clock_event_request_params *)event.params;
+
+    fwk_id_t service_ospm0 =
+        FWK_ID_ELEMENT_INIT(FAKE_MODULE_IDX, FAKE_SCMI_AGENT_IDX_OSPM0);
+    fwk_id_t service_ospm1 =
+        FWK_ID_ELEMENT_INIT(FAKE_MODULE_IDX, FAKE_SCMI_AGENT_IDX_OSPM1);
+
+    scmi_clock_ctx.clock_api = &queue_clock_api;
+    defer_supported = true;
+    queue_set_clock_busy(service_ospm0, SCMI_CLOCK_REQUEST_SET_RATE);
+
+    status = queue_request(service_ospm1, SCMI_CLOCK_REQUEST_GET_RATE);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, defer_count);
+
+    /* Complete the rate change, which starts the queued read */
+    params->clock_dev_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_CLOCK, CLOCK_DEV_IDX_FAKE0);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(CLOCK_DEV_IDX_FAKE0);
+    fwk_id_get_event_idx_ExpectAnyArgsAndReturn(SCMI_CLOCK_EVENT_IDX_SET_RATE);
+    mod_scmi_from_protocol_api_respond_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    __fwk_put_event_Stub(queue_put_event_callback);
+
+    status = process_request_event(&event);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(0, resume_count);
+    TEST_ASSERT_TRUE(clock_ops_table[CLOCK_DEV_IDX_FAKE0].response.deferred);
+
+    /* Complete the read, responding to the resumed message */
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(CLOCK_DEV_IDX_FAKE0);
+    fwk_id_get_event_idx_ExpectAnyArgsAndReturn(SCMI_CLOCK_EVENT_IDX_GET_RATE);
+    mod_scmi_from_protocol_api_respond_Stub(deferred_respond_callback);
+
+    status = process_request_event(&event);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(0x10, resumed_token);
+    TEST_ASSERT_EQUAL(1, defer_count);
+    mod_scmi_from_protocol_api_respond_Stub(NULL);
+    __fwk_put_event_Stub(NULL);
+}
+#    endif
+#endif
+
 int scmi_test_main(void)
 {
     UNITY_BEGIN();
@@ -723,6 +1249,19 @@ int scmi_test_main(void)
         RUN_TEST(test_mod_scmi_clock_state_update_ref_count_1_running);
         RUN_TEST(test_mod_scmi_clock_state_update_ref_count_2_stopped);
         RUN_TEST(test_mod_scmi_clock_state_update_ref_count_1_stopped);
+#    ifdef BUILD_HAS_SCMI_DESCRIBE_IMAGES
+        RUN_TEST(test_describe_rates_image_reused);
+        RUN_TEST(test_describe_rates_image_invalidated);
+        RUN_TEST(test_describe_rates_image_no_memory);
+#    endif
+#    ifdef BUILD_HAS_SCMI_CLOCK_REQUEST_QUEUE
+        RUN_TEST(test_queue_rate_get_coalesced);
+        RUN_TEST(test_queue_start_next_on_completion);
+#        ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+        RUN_TEST(test_deferred_response_on_pending);
+        RUN_TEST(test_deferred_response_queued);
+#        endif
+#    endif
 
     #endif
     return UNITY_END();
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -480,4 +480,8 @@ void perf_prot_ops_notify_level(
     uint32_t level,
     uint32_t cookie);
 
+#ifdef BUILD_HAS_SCMI_DESCRIBE_IMAGES
+void perf_prot_ops_invalidate_levels(unsigned int domain_idx);
+#endif
+
 #endif /* INTERNAL_SCMI_PERF_H */
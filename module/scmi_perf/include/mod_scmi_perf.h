@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -272,6 +272,24 @@ struct mod_scmi_perf_updated_api {
         fwk_id_t domain_id,
         uintptr_t cookie,
         uint32_t level);
+
+#ifdef BUILD_HAS_SCMI_DESCRIBE_IMAGES
+    /*!
+     * \brief Inform SCMI Perf that the operating points of a domain have been
+     *      updated.
+     *
+     * \details The DESCRIBE_LEVELS responses of the domain are built again
+     *      from the new operating points on the next request.
+     *
+     * \note A driver that changes the operating points of a domain without
+     *      changing their number must call this function. Otherwise the
+     *      agents keep being served the previous levels. No driver of this
+     *      tree changes its operating points at runtime.
+     *
+     * \param domain_id Domain identifier.
+     */
+    void (*notify_opps_updated)(fwk_id_t domain_id);
+#endif
 };
 
 /*!
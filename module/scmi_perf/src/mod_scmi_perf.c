@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -343,8 +343,31 @@ static void scmi_perf_notify_level_updated(
     domain_ctx->curr_level = level;
 }
 
+#if defined(BUILD_HAS_SCMI_PERF_PROTOCOL_OPS) && \
+    defined(BUILD_HAS_SCMI_DESCRIBE_IMAGES)
+/*
+ * The operating points of a domain have been updated. The levels served to
+ * the agents for all the relevant logical domains are built again.
+ */
+static void scmi_perf_notify_opps_updated(fwk_id_t domain_id)
+{
+    uint32_t i;
+
+    for (i = 0; i < scmi_perf_ctx.domain_count; i++) {
+        if (fwk_id_get_element_idx(get_dependency_id((unsigned int)i)) ==
+            fwk_id_get_element_idx(domain_id)) {
+            perf_prot_ops_invalidate_levels((unsigned int)i);
+        }
+    }
+}
+#endif
+
 static struct mod_scmi_perf_updated_api perf_update_api = {
     .notify_level_updated = scmi_perf_notify_level_updated,
+#if defined(BUILD_HAS_SCMI_PERF_PROTOCOL_OPS) && \
+    defined(BUILD_HAS_SCMI_DESCRIBE_IMAGES)
+    .notify_opps_updated = scmi_perf_notify_opps_updated,
+#endif
 };
 
 #if defined(BUILD_HAS_SCMI_PERF_PROTOCOL_OPS) || \
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -30,6 +30,22 @@
 #include <fwk_module.h>
 #include <fwk_string.h>
 
+#ifdef BUILD_HAS_SCMI_PERF_FCH_DIRTY_TRACKING
+#    include <fwk_interrupt.h>
+#    include <fwk_mm.h>
+
+#    define PERF_FCH_MASK_WORD_BITS 32U
+
+/* Last level requested from the fast channel of a domain */
+struct perf_fch_level_request {
+    /* Level requested */
+    uint32_t level;
+
+    /* Current level of the domain when the level was requested */
+    uint32_t from_level;
+};
+#endif
+
 struct mod_scmi_perf_fc_ctx {
     struct mod_scmi_perf_ctx *perf_ctx;
 
@@ -50,6 +66,23 @@ struct mod_scmi_perf_fc_ctx {
      */
     bool callback_registered;
 #endif
+
+#ifdef BUILD_HAS_SCMI_PERF_FCH_DIRTY_TRACKING
+    /* Mask of the domains signalled by a doorbell and not yet processed */
+    volatile uint32_t *dirty_mask;
+
+    /* Number of words in the dirty mask */
+    unsigned int dirty_mask_words;
+
+    /*
+     * Some fast channels are polled on a timer, which does not tell which
+     * domain was written. All the domains are compared on every period.
+     */
+    bool polled;
+
+    /* Table of the last level requested for each domain */
+    struct perf_fch_level_request *last_request;
+#endif
 };
 
 static unsigned int fast_channel_elem_size[MOD_SCMI_PERF_FAST_CHANNEL_COUNT] = {
@@ -137,11 +170,13 @@ static struct fast_channel_ctx *get_fch_ctx(
 }
 
 static int fch_context_init(
+    unsigned int domain_idx,
     const struct scmi_perf_fch_config *fch_config,
     struct fast_channel_ctx *fch_ctx)
 {
     int status = FWK_E_DATA;
     enum mod_transport_fch_interrupt_type interrupt_type;
+    uintptr_t callback_param = (uintptr_t)NULL;
 
     status = fch_ctx->transport_fch_api->transport_get_fch_address(
         fch_config->transport_id, &fch_ctx->fch_address);
@@ -171,9 +206,18 @@ static int fch_context_init(
         }
 
         perf_fch_ctx.callback_registered = true;
+#    ifdef BUILD_HAS_SCMI_PERF_FCH_DIRTY_TRACKING
+        perf_fch_ctx.polled = true;
+#    endif
     } else if (interrupt_type == MOD_TRANSPORT_FCH_INTERRUPT_TYPE_HW) {
+#    ifdef BUILD_HAS_SCMI_PERF_FCH_DIRTY_TRACKING
+        /* The doorbell tells which domain was written, as its index + 1 */
+        callback_param = (uintptr_t)domain_idx + 1U;
+#    else
+        (void)domain_idx;
+#    endif
         status = fch_ctx->transport_fch_api->transport_fch_register_callback(
-            fch_config->transport_id, (uintptr_t)NULL, fast_channel_callback);
+            fch_config->transport_id, callback_param, fast_channel_callback);
 
         if (status != FWK_SUCCESS) {
             return FWK_E_DATA;
@@ -471,6 +515,16 @@ static void fast_channel_callback(uintptr_t param)
 {
     int status;
 
+#ifdef BUILD_HAS_SCMI_PERF_FCH_DIRTY_TRACKING
+    unsigned int domain_idx;
+
+    if ((param != (uintptr_t)NULL) && (perf_fch_ctx.dirty_mask != NULL)) {
+        domain_idx = (unsigned int)(param - 1U);
+        perf_fch_ctx.dirty_mask[domain_idx / PERF_FCH_MASK_WORD_BITS] |=
+            (1U << (domain_idx % PERF_FCH_MASK_WORD_BITS));
+    }
+#endif
+
     struct fwk_event_light event = (struct fwk_event_light){
         .id = FWK_ID_EVENT(
             FWK_MODULE_IDX_SCMI_PERF,
@@ -589,7 +643,116 @@ static void perf_fch_process_plugins_handler(void)
 }
 #endif
 
-#ifndef BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER
+#if !defined(BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER) && \
+    defined(BUILD_HAS_SCMI_PERF_FCH_DIRTY_TRACKING)
+static inline bool perf_fch_status_accepted(int status)
+{
+    return (status == FWK_SUCCESS) || (status == FWK_PENDING);
+}
+
+/*
+ * Apply the level and limits of a domain that differ from the current ones of
+ * the domain. The current level and limits also follow the changes made by
+ * other means than the fast channels, so a value written again by the agent
+ * after such a change is applied again. A request that fails leaves them
+ * unchanged, so that it is tried again on the next processing.
+ *
+ * A level request may still be pending when the domain is processed again. The
+ * level is then not requested again as long as the current level of the domain
+ * has not changed since it was requested.
+ */
+static void perf_fch_process_domain(unsigned int domain_idx)
+{
+    struct mod_scmi_perf_fast_channel_limit *set_limit;
+    struct scmi_perf_domain_ctx *domain_ctx;
+    struct perf_fch_level_request *last_request;
+    uint32_t *set_level;
+    uint32_t tlevel, tmax, tmin;
+    uint32_t from_level;
+    int status;
+
+    set_limit = get_fc_set_limit_addr(domain_idx);
+    set_level = get_fc_set_level_addr(domain_idx);
+    domain_ctx = &perf_fch_ctx.perf_ctx->domain_ctx_table[domain_idx];
+    last_request = &perf_fch_ctx.last_request[domain_idx];
+
+    if (set_level != NULL) {
+        tlevel = *set_level;
+        from_level = domain_ctx->curr_level;
+        if ((tlevel > 0) && (tlevel != from_level) &&
+            ((tlevel != last_request->level) ||
+             (from_level != last_request->from_level))) {
+            status = perf_fch_ctx.api_fch_stub->perf_set_level(
+                get_dependency_id(domain_idx), 0, tlevel);
+            if (perf_fch_status_accepted(status)) {
+                last_request->level = tlevel;
+                last_request->from_level = from_level;
+            } else {
+                FWK_LOG_DEBUG("[SCMI-PERF] %s @%d", __func__, __LINE__);
+            }
+        }
+    }
+
+    if (set_limit != NULL) {
+        tmax = set_limit->range_max;
+        tmin = set_limit->range_min;
+        if (((tmax == 0) && (tmin == 0)) ||
+            ((tmax == domain_ctx->level_limits.maximum) &&
+             (tmin == domain_ctx->level_limits.minimum))) {
+            return;
+        }
+
+        status = perf_fch_ctx.api_fch_stub->perf_set_limits(
+            get_dependency_id(domain_idx),
+            0,
+            &((struct mod_scmi_perf_level_limits){
+                .minimum = tmin,
+                .maximum = tmax,
+            }));
+        if (!perf_fch_status_accepted(status)) {
+            FWK_LOG_DEBUG("[SCMI-PERF] %s @%d", __func__, __LINE__);
+        }
+    }
+}
+
+static void perf_fch_process(void)
+{
+    struct mod_scmi_perf_ctx *perf_ctx = perf_fch_ctx.perf_ctx;
+    unsigned int flags;
+    unsigned int word;
+    unsigned int bit;
+    uint32_t dirty;
+
+    for (word = 0; word < perf_fch_ctx.dirty_mask_words; word++) {
+        /* Take the doorbells received so far, new ones set the bits again */
+        flags = fwk_interrupt_global_disable();
+        dirty = perf_fch_ctx.dirty_mask[word];
+        perf_fch_ctx.dirty_mask[word] = 0;
+        fwk_interrupt_global_enable(flags);
+
+        if (perf_fch_ctx.polled) {
+            dirty = UINT32_MAX;
+        }
+
+        while (dirty != 0) {
+            bit = (unsigned int)__builtin_ctz(dirty);
+            dirty &= dirty - 1U;
+
+            if ((word * PERF_FCH_MASK_WORD_BITS + bit) >=
+                perf_ctx->domain_count) {
+                break;
+            }
+
+            if (perf_fch_domain_has_fastchannels(
+                    word * PERF_FCH_MASK_WORD_BITS + bit)) {
+                perf_fch_process_domain(word * PERF_FCH_MASK_WORD_BITS + bit);
+            }
+        }
+    }
+
+    decrement_pending_req_count();
+}
+#elif !defined(BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER)
 static void perf_fch_process(void)
 {
     struct mod_scmi_perf_fast_channel_limit *set_limit;
@@ -654,6 +817,16 @@ int perf_fch_init(
     perf_fch_ctx.perf_ctx = mod_ctx;
     perf_fch_ctx.api_fch_stub = api;
 
+#ifdef BUILD_HAS_SCMI_PERF_FCH_DIRTY_TRACKING
+    perf_fch_ctx.dirty_mask_words =
+        (mod_ctx->domain_count + PERF_FCH_MASK_WORD_BITS - 1U) /
+        PERF_FCH_MASK_WORD_BITS;
+    perf_fch_ctx.dirty_mask = fwk_mm_calloc(
+        perf_fch_ctx.dirty_mask_words, sizeof(perf_fch_ctx.dirty_mask[0]));
+    perf_fch_ctx.last_request = fwk_mm_calloc(
+        mod_ctx->domain_count, sizeof(perf_fch_ctx.last_request[0]));
+#endif
+
     return FWK_SUCCESS;
 }
 
@@ -698,7 +871,7 @@ static void *get_fch_local_address(
     fch_config = get_fch_config(domain_idx, fch_idx);
     fch_ctx = get_fch_ctx(domain_idx, fch_idx);
 
-    status = fch_context_init(fch_config, fch_ctx);
+    status = fch_context_init(domain_idx, fch_config, fch_ctx);
 
     if (status != FWK_SUCCESS) {
         return NULL;
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2023-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2023-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -46,6 +46,23 @@ struct scmi_perf_event_parameters {
 
 #define MOD_SCMI_PERF_NOTIFICATION_COUNT 2
 
+#ifdef BUILD_HAS_SCMI_DESCRIBE_IMAGES
+/* DESCRIBE_LEVELS entries of a domain, as sent to the agents */
+struct perf_levels_image {
+    /* Table of serialised levels */
+    struct scmi_perf_level *levels;
+
+    /* Number of levels in the image */
+    size_t level_count;
+
+    /* Number of levels the table can hold */
+    size_t capacity;
+
+    /* The image holds the current levels of the domain */
+    bool valid;
+};
+#endif
+
 static int scmi_perf_protocol_version_handler(
     fwk_id_t service_id,
     const uint32_t *payload);
@@ -158,6 +175,11 @@ static struct scmi_perf_protocol_ctx {
     const struct mod_stats_api *stats_api;
 #endif
 
+#ifdef BUILD_HAS_SCMI_DESCRIBE_IMAGES
+    /* Table of DESCRIBE_LEVELS images, per domain */
+    struct perf_levels_image *levels_images;
+#endif
+
 } perf_prot_ctx;
 
 /* This identifier is either:
@@ -415,6 +437,165 @@ exit:
     return status;
 }
 
+#ifdef BUILD_HAS_SCMI_DESCRIBE_IMAGES
+/*
+ * Get the image of the levels of a domain, as they are sent in DESCRIBE_LEVELS
+ * responses, building it if it is not valid. NULL is returned if the image
+ * cannot be built, in which case the levels are read from DVFS instead.
+ */
+static const struct perf_levels_image *perf_levels_image_get(
+    unsigned int domain_idx,
+    size_t opp_count)
+{
+    struct perf_levels_image *image;
+    struct scmi_perf_level *perf_level;
+    struct scmi_perf_level *levels;
+    struct mod_dvfs_opp opp;
+    fwk_id_t domain_id;
+    uint16_t latency;
+    size_t level_index;
+    int status;
+
+    image = &perf_prot_ctx.levels_images[domain_idx];
+    if (image->valid && (image->level_count == opp_count)) {
+        return image;
+    }
+
+    image->valid = false;
+
+    if (opp_count > image->capacity) {
+        /* The previous table is kept if it cannot be grown */
+        levels =
+            fwk_mm_realloc(image->levels, opp_count, sizeof(image->levels[0]));
+        if (levels == NULL) {
+            return NULL;
+        }
+
+        image->levels = levels;
+        image->capacity = opp_count;
+    }
+
+    domain_id = get_dependency_id(domain_idx);
+    status = perf_prot_ctx.scmi_perf_ctx->dvfs_api->get_latency(
+        domain_id, &latency);
+    if (status != FWK_SUCCESS) {
+        return NULL;
+    }
+
+    for (level_index = 0; level_index < opp_count; level_index++) {
+        status = perf_prot_ctx.scmi_perf_ctx->dvfs_api->get_nth_opp(
+            domain_id, level_index, &opp);
+        if (status != FWK_SUCCESS) {
+            return NULL;
+        }
+
+        perf_level = &image->levels[level_index];
+        perf_level->power_cost = (opp.power != 0) ? opp.power : opp.voltage;
+        perf_level->performance_level = opp.level;
+        perf_level->attributes = latency;
+    }
+
+    image->level_count = opp_count;
+    image->valid = true;
+
+    return image;
+}
+
+static void perf_levels_images_build(void)
+{
+    struct mod_scmi_perf_ctx *scmi_perf_ctx = perf_prot_ctx.scmi_perf_ctx;
+    unsigned int domain_idx;
+    size_t opp_count;
+    int status;
+
+    for (domain_idx = 0; domain_idx < scmi_perf_ctx->domain_count;
+         domain_idx++) {
+        status = scmi_perf_ctx->dvfs_api->get_opp_count(
+            get_dependency_id(domain_idx), &opp_count);
+        if ((status == FWK_SUCCESS) && (opp_count > 0)) {
+            /* A failed image is built again on the first request */
+            (void)perf_levels_image_get(domain_idx, opp_count);
+        }
+    }
+}
+
+void perf_prot_ops_invalidate_levels(unsigned int domain_idx)
+{
+    perf_prot_ctx.levels_images[domain_idx].valid = false;
+}
+#endif
+
+/*
+ * Write the levels of a domain to the DESCRIBE_LEVELS response, after the
+ * levels already written.
+ */
+static int perf_write_levels(
+    fwk_id_t service_id,
+    unsigned int domain_idx,
+    size_t opp_count,
+    unsigned int level_index,
+    unsigned int num_levels,
+    size_t *payload_size)
+{
+    struct mod_scmi_perf_ctx *scmi_perf_ctx = perf_prot_ctx.scmi_perf_ctx;
+    struct scmi_perf_level perf_level;
+    struct mod_dvfs_opp opp;
+    fwk_id_t domain_id;
+    uint16_t latency;
+    int status;
+#ifdef BUILD_HAS_SCMI_DESCRIBE_IMAGES
+    const struct perf_levels_image *image;
+
+    image = perf_levels_image_get(domain_idx, opp_count);
+    if (image != NULL) {
+        /* Copy the levels from the image of the domain at once */
+        status = scmi_perf_ctx->scmi_api->write_payload(
+            service_id,
+            *payload_size,
+            &image->levels[level_index],
+            num_levels * sizeof(image->levels[0]));
+        if (status == FWK_SUCCESS) {
+            *payload_size += num_levels * sizeof(image->levels[0]);
+        }
+
+        return status;
+    }
+#endif
+
+    domain_id = get_dependency_id(domain_idx);
+    status = scmi_perf_ctx->dvfs_api->get_latency(domain_id, &latency);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    /* Copy DVFS data into returned data structure */
+    for (; num_levels > 0; num_levels--, level_index++) {
+        status =
+            scmi_perf_ctx->dvfs_api->get_nth_opp(domain_id, level_index, &opp);
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+
+        if (opp.power != 0) {
+            perf_level.power_cost = opp.power;
+        } else {
+            perf_level.power_cost = opp.voltage;
+        }
+        perf_level.performance_level = opp.level;
+        perf_level.attributes = latency;
+
+        status = scmi_perf_ctx->scmi_api->write_payload(
+            service_id, *payload_size, &perf_level, sizeof(perf_level));
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+
+        *payload_size += sizeof(perf_level);
+    }
+
+    return FWK_SUCCESS;
+}
+
 static int scmi_perf_describe_levels_handler(
     fwk_id_t service_id,
     const uint32_t *payload)
@@ -423,12 +604,9 @@ static int scmi_perf_describe_levels_handler(
     size_t max_payload_size;
     const struct scmi_perf_describe_levels_a2p *parameters;
     fwk_id_t domain_id;
-    struct scmi_perf_level perf_level;
     unsigned int num_levels, level_index, level_index_max;
     size_t payload_size;
     size_t opp_count;
-    struct mod_dvfs_opp opp;
-    uint16_t latency;
     struct scmi_perf_describe_levels_p2a return_values = {
         .status = (int32_t)SCMI_GENERIC_ERROR,
     };
@@ -481,35 +659,17 @@ static int scmi_perf_describe_levels_handler(
 
     level_index_max = (level_index + num_levels - 1);
 
-    status = scmi_perf_ctx->dvfs_api->get_latency(domain_id, &latency);
+    status = perf_write_levels(
+        service_id,
+        parameters->domain_id,
+        opp_count,
+        level_index,
+        num_levels,
+        &payload_size);
     if (status != FWK_SUCCESS) {
         goto exit;
     }
 
-    /* Copy DVFS data into returned data structure */
-    for (; level_index <= level_index_max;
-         level_index++, payload_size += sizeof(perf_level)) {
-        status =
-            scmi_perf_ctx->dvfs_api->get_nth_opp(domain_id, level_index, &opp);
-        if (status != FWK_SUCCESS) {
-            goto exit;
-        }
-
-        if (opp.power != 0) {
-            perf_level.power_cost = opp.power;
-        } else {
-            perf_level.power_cost = opp.voltage;
-        }
-        perf_level.performance_level = opp.level;
-        perf_level.attributes = latency;
-
-        status = scmi_perf_ctx->scmi_api->write_payload(
-            service_id, payload_size, &perf_level, sizeof(perf_level));
-        if (status != FWK_SUCCESS) {
-            goto exit;
-        }
-    }
-
     return_values = (struct scmi_perf_describe_levels_p2a){
         .status = SCMI_SUCCESS,
         .num_levels =
@@ -1225,6 +1385,12 @@ int perf_prot_ops_init(
         perf_prot_ctx.perf_ops_table[i].service_id = FWK_ID_NONE;
     }
 
+#ifdef BUILD_HAS_SCMI_DESCRIBE_IMAGES
+    perf_prot_ctx.levels_images = fwk_mm_calloc(
+        perf_prot_ctx.scmi_perf_ctx->domain_count,
+        sizeof(perf_prot_ctx.levels_images[0]));
+#endif
+
     return FWK_SUCCESS;
 }
 
@@ -1286,6 +1452,10 @@ int perf_prot_ops_start(fwk_id_t id)
     }
 #endif
 
+#ifdef BUILD_HAS_SCMI_DESCRIBE_IMAGES
+    perf_levels_images_build();
+#endif
+
     return status;
 }
 
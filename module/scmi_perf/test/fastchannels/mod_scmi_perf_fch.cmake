@@ -1,6 +1,6 @@
 #
 # Arm SCP/MCP Software
-# Copyright (c) 2022-2024, Arm Limited and Contributors. All rights reserved.
+# Copyright (c) 2022-2026, Arm Limited and Contributors. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
@@ -41,6 +41,7 @@ include(${SCP_ROOT}/unit_test/module_common.cmake)
 target_compile_definitions(${UNIT_TEST_TARGET} PUBLIC
     "BUILD_HAS_SCMI_PERF_FAST_CHANNELS"
     "BUILD_HAS_FAST_CHANNELS"
-    "BUILD_HAS_MOD_TRANSPORT")
+    "BUILD_HAS_MOD_TRANSPORT"
+    "BUILD_HAS_SCMI_PERF_FCH_DIRTY_TRACKING")
 target_compile_definitions(${UNIT_TEST_TARGET} PUBLIC
     "BUILD_HAS_SCMI_PERF_PROTOCOL_OPS")
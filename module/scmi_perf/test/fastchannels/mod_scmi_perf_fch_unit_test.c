@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2022-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -525,6 +525,15 @@ void utest_perf_fch_init_success(void)
     };
     perf_fch_ctx.perf_ctx->config = &config;
 
+#ifdef BUILD_HAS_SCMI_PERF_FCH_DIRTY_TRACKING
+    uint32_t dirty_mask[1];
+    struct perf_fch_level_request last_request[SCMI_PERF_ELEMENT_IDX_COUNT];
+
+    fwk_mm_calloc_ExpectAndReturn(1, sizeof(dirty_mask[0]), dirty_mask);
+    fwk_mm_calloc_ExpectAndReturn(
+        scmi_perf_ctx.domain_count, sizeof(last_request[0]), last_request);
+#endif
+
     status = perf_fch_init(
         fwk_module_id_scmi_perf, element_count, data, &scmi_perf_ctx, &api);
     TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
@@ -532,8 +541,213 @@ void utest_perf_fch_init_success(void)
     TEST_ASSERT_EQUAL(&api, perf_fch_ctx.api_fch_stub);
     TEST_ASSERT_EQUAL(
         SCMI_PERF_FC_MIN_RATE_LIMIT, perf_fch_ctx.fast_channels_rate_limit);
+#ifdef BUILD_HAS_SCMI_PERF_FCH_DIRTY_TRACKING
+    TEST_ASSERT_EQUAL_PTR(dirty_mask, perf_fch_ctx.dirty_mask);
+    TEST_ASSERT_EQUAL(1, perf_fch_ctx.dirty_mask_words);
+    TEST_ASSERT_EQUAL_PTR(last_request, perf_fch_ctx.last_request);
+#endif
+}
+
+#ifdef BUILD_HAS_SCMI_PERF_FCH_DIRTY_TRACKING
+static struct scmi_perf_domain_ctx
+    fch_domain_table[SCMI_PERF_ELEMENT_IDX_COUNT];
+static uint32_t fch_dirty_mask[1];
+static struct perf_fch_level_request
+    fch_last_request[SCMI_PERF_ELEMENT_IDX_COUNT];
+static uint32_t fch_level_set;
+static struct mod_scmi_perf_fast_channel_limit fch_limit_set;
+
+static unsigned int set_level_count;
+static uint32_t set_level_value;
+static int set_level_status;
+static unsigned int set_limits_count;
+
+/*
+ * The requests complete at once, as with a synchronous DVFS driver, unless
+ * set_level_status is FWK_PENDING.
+ */
+static int fch_perf_set_level(
+    fwk_id_t domain_id,
+    unsigned int agent_id,
+    uint32_t perf_level)
+{
+    set_level_count++;
+    set_level_value = perf_level;
+
+    if (set_level_status == FWK_SUCCESS) {
+        fch_domain_table[domain_id.element.element_idx].curr_level =
+            perf_level;
+    }
+
+    return set_level_status;
 }
 
+static int fch_perf_set_limits(
+    fwk_id_t domain_id,
+    unsigned int agent_id,
+    const struct mod_scmi_perf_level_limits *limits)
+{
+    set_limits_count++;
+
+    fch_domain_table[domain_id.element.element_idx].level_limits = *limits;
+
+    return FWK_SUCCESS;
+}
+
+static struct mod_scmi_perf_private_api_perf_stub fch_api_stub = {
+    .perf_set_level = fch_perf_set_level,
+    .perf_set_limits = fch_perf_set_limits,
+};
+
+static void fch_dirty_tracking_setup(bool polled)
+{
+    struct fast_channel_ctx *fch_ctx;
+
+    memset(fch_domain_table, 0, sizeof(fch_domain_table));
+    memset(fch_dirty_mask, 0, sizeof(fch_dirty_mask));
+    memset(fch_last_request, 0, sizeof(fch_last_request));
+    memset(&fch_limit_set, 0, sizeof(fch_limit_set));
+    fch_level_set = 0;
+
+    fch_ctx = fch_domain_table[SCMI_PERF_ELEMENT_IDX_0].fch_ctx;
+    fch_ctx[MOD_SCMI_PERF_FAST_CHANNEL_LEVEL_SET]
+        .fch_address.local_view_address = (uintptr_t)&fch_level_set;
+    fch_ctx[MOD_SCMI_PERF_FAST_CHANNEL_LIMIT_SET]
+        .fch_address.local_view_address = (uintptr_t)&fch_limit_set;
+
+    scmi_perf_ctx.domain_ctx_table = fch_domain_table;
+    perf_fch_ctx.api_fch_stub = &fch_api_stub;
+    perf_fch_ctx.dirty_mask = fch_dirty_mask;
+    perf_fch_ctx.dirty_mask_words = 1;
+    perf_fch_ctx.last_request = fch_last_request;
+    perf_fch_ctx.polled = polled;
+    perf_fch_ctx.pending_req_count = 0;
+
+    set_level_count = 0;
+    set_level_value = 0;
+    set_level_status = FWK_SUCCESS;
+    set_limits_count = 0;
+}
+
+void utest_perf_fch_process_dirty_tracking_doorbell(void)
+{
+    fch_dirty_tracking_setup(false);
+
+    /* A domain is only processed once its doorbell has been rung */
+    fch_level_set = 100;
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(0, set_level_count);
+
+    __fwk_put_event_light_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    fast_channel_callback((uintptr_t)SCMI_PERF_ELEMENT_IDX_0 + 1U);
+    TEST_ASSERT_EQUAL(1U << SCMI_PERF_ELEMENT_IDX_0, fch_dirty_mask[0]);
+
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(1, set_level_count);
+    TEST_ASSERT_EQUAL(100, set_level_value);
+    TEST_ASSERT_EQUAL(0, set_limits_count);
+    TEST_ASSERT_EQUAL(0, fch_dirty_mask[0]);
+
+    /* The same level written again is not requested again */
+    __fwk_put_event_light_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    fast_channel_callback((uintptr_t)SCMI_PERF_ELEMENT_IDX_0 + 1U);
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(1, set_level_count);
+
+    fch_level_set = 200;
+    fch_limit_set.range_min = 100;
+    fch_limit_set.range_max = 300;
+    __fwk_put_event_light_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    fast_channel_callback((uintptr_t)SCMI_PERF_ELEMENT_IDX_0 + 1U);
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(2, set_level_count);
+    TEST_ASSERT_EQUAL(200, set_level_value);
+    TEST_ASSERT_EQUAL(1, set_limits_count);
+}
+
+void utest_perf_fch_process_dirty_tracking_polled(void)
+{
+    fch_dirty_tracking_setup(true);
+
+    /* A level that is refused is requested again on the next period */
+    fch_level_set = 100;
+    set_level_status = FWK_E_RANGE;
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(1, set_level_count);
+
+    set_level_status = FWK_SUCCESS;
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(2, set_level_count);
+
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(2, set_level_count);
+
+    fch_limit_set.range_min = 100;
+    fch_limit_set.range_max = 300;
+    perf_fch_process();
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(2, set_level_count);
+    TEST_ASSERT_EQUAL(1, set_limits_count);
+}
+
+/*
+ * Test that a level and limits changed by other means than the fast channels
+ * are set again from the unchanged fast channels
+ */
+void utest_perf_fch_process_dirty_tracking_external_change(void)
+{
+    struct scmi_perf_domain_ctx *domain_ctx =
+        &fch_domain_table[SCMI_PERF_ELEMENT_IDX_0];
+
+    fch_dirty_tracking_setup(true);
+
+    fch_level_set = 100;
+    fch_limit_set.range_min = 100;
+    fch_limit_set.range_max = 300;
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(1, set_level_count);
+    TEST_ASSERT_EQUAL(1, set_limits_count);
+
+    /* A PERFORMANCE_LEVEL_SET and PERFORMANCE_LIMITS_SET by message */
+    domain_ctx->curr_level = 200;
+    domain_ctx->level_limits.maximum = 400;
+
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(2, set_level_count);
+    TEST_ASSERT_EQUAL(100, set_level_value);
+    TEST_ASSERT_EQUAL(2, set_limits_count);
+    TEST_ASSERT_EQUAL(300, domain_ctx->level_limits.maximum);
+}
+
+/* Test that a level still pending from a fast channel is not requested again */
+void utest_perf_fch_process_dirty_tracking_pending_level(void)
+{
+    struct scmi_perf_domain_ctx *domain_ctx =
+        &fch_domain_table[SCMI_PERF_ELEMENT_IDX_0];
+
+    fch_dirty_tracking_setup(true);
+
+    fch_level_set = 100;
+    set_level_status = FWK_PENDING;
+    perf_fch_process();
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(1, set_level_count);
+
+    /* Another level written while the first one is pending is requested */
+    fch_level_set = 150;
+    perf_fch_process();
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(2, set_level_count);
+    TEST_ASSERT_EQUAL(150, set_level_value);
+
+    /* Once the level of the domain has changed, the level is compared again */
+    domain_ctx->curr_level = 200;
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(3, set_level_count);
+    TEST_ASSERT_EQUAL(150, set_level_value);
+}
+#endif
+
 int scmi_perf_fch_test_main(void)
 {
     UNITY_BEGIN();
@@ -550,6 +764,13 @@ int scmi_perf_fch_test_main(void)
 
     RUN_TEST(utest_perf_fch_init_success);
 
+#ifdef BUILD_HAS_SCMI_PERF_FCH_DIRTY_TRACKING
+    RUN_TEST(utest_perf_fch_process_dirty_tracking_doorbell);
+    RUN_TEST(utest_perf_fch_process_dirty_tracking_polled);
+    RUN_TEST(utest_perf_fch_process_dirty_tracking_external_change);
+    RUN_TEST(utest_perf_fch_process_dirty_tracking_pending_level);
+#endif
+
     return UNITY_END();
 }
 
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2022-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -69,6 +69,11 @@ static const struct mod_dvfs_domain_api dvfs_domain_api = {
 
 char *name = "Test Name";
 
+#ifdef BUILD_HAS_SCMI_DESCRIBE_IMAGES
+static struct scmi_perf_level test_levels[TEST_OPP_COUNT];
+static struct perf_levels_image test_levels_images[SCMI_PERF_ELEMENT_IDX_COUNT];
+#endif
+
 void setUp(void)
 {
     scmi_perf_ctx.scmi_api = &from_protocol_api;
@@ -85,10 +90,20 @@ void setUp(void)
 #endif
 
     scmi_perf_ctx.dvfs_api = &dvfs_domain_api;
+
+#ifdef BUILD_HAS_SCMI_DESCRIBE_IMAGES
+    memset(test_levels_images, 0, sizeof(test_levels_images));
+    test_levels_images[0].levels = test_levels;
+    test_levels_images[0].capacity = TEST_OPP_COUNT;
+    perf_prot_ctx.levels_images = test_levels_images;
+#endif
 }
 
 void tearDown(void)
 {
+#ifdef BUILD_HAS_SCMI_DESCRIBE_IMAGES
+    mod_dvfs_domain_api_get_latency_Stub(NULL);
+#endif
 }
 
 int version_handler_respond_callback(
@@ -453,6 +468,31 @@ int describe_levels_handler_valid_param_write_payload_callback(
     size_t size,
     int NumCalls)
 {
+#ifdef BUILD_HAS_SCMI_DESCRIBE_IMAGES
+    /* The levels are written at once from the image of the domain */
+    if (NumCalls == 0) {
+        const struct scmi_perf_level *returned_perf_level =
+            (const struct scmi_perf_level *)payload;
+
+        TEST_ASSERT_EQUAL(
+            sizeof(struct scmi_perf_level) * TEST_OPP_COUNT, size);
+        for (unsigned int i = 0; i < TEST_OPP_COUNT; i++) {
+            TEST_ASSERT_EQUAL(
+                test_dvfs_config.opps[i].voltage,
+                returned_perf_level[i].power_cost);
+            TEST_ASSERT_EQUAL(
+                test_dvfs_config.opps[i].level,
+                returned_perf_level[i].performance_level);
+            TEST_ASSERT_EQUAL(
+                test_dvfs_config.latency, returned_perf_level[i].attributes);
+        }
+
+        return FWK_SUCCESS;
+    }
+
+    NumCalls += TEST_OPP_COUNT - 1;
+#endif
+
     if (NumCalls < TEST_OPP_COUNT) {
         struct scmi_perf_level *returned_perf_level =
             (struct scmi_perf_level *)payload;
@@ -530,6 +570,180 @@ void utest_scmi_perf_describe_levels_handler_valid_param(void)
     TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
 }
 
+#ifdef BUILD_HAS_SCMI_DESCRIBE_IMAGES
+static unsigned int get_nth_opp_count;
+
+int get_nth_opp_count_callback(
+    fwk_id_t domain_id,
+    size_t n,
+    struct mod_dvfs_opp *opp,
+    int NumCalls)
+{
+    get_nth_opp_count++;
+
+    return get_nth_opp_callback(domain_id, n, opp, NumCalls);
+}
+
+static size_t levels_written_size;
+static uint32_t first_level_written;
+
+int describe_levels_handler_image_write_payload_callback(
+    fwk_id_t service_id,
+    size_t offset,
+    const void *payload,
+    size_t size,
+    int NumCalls)
+{
+    const struct scmi_perf_level *returned_perf_level =
+        (const struct scmi_perf_level *)payload;
+
+    /* Record the levels, written after the header */
+    if (offset == sizeof(struct scmi_perf_describe_levels_p2a)) {
+        levels_written_size = size;
+        first_level_written = returned_perf_level[0].performance_level;
+    }
+
+    return FWK_SUCCESS;
+}
+
+static void describe_levels_image_request(uint32_t level_index)
+{
+    int status;
+
+    fwk_id_t service_id =
+        FWK_ID_ELEMENT_INIT(TEST_MODULE_IDX, TEST_SCMI_AGENT_IDX_0);
+
+    struct scmi_perf_describe_levels_a2p payload = {
+        .domain_id = 0,
+        .level_index = level_index,
+    };
+
+    static size_t size = UINT16_MAX;
+    static size_t opp_count = TEST_OPP_COUNT;
+
+    mod_scmi_from_protocol_api_get_max_payload_size_ExpectAnyArgsAndReturn(
+        FWK_SUCCESS);
+    mod_scmi_from_protocol_api_get_max_payload_size_ReturnThruPtr_size(&size);
+    mod_dvfs_domain_api_get_opp_count_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    mod_dvfs_domain_api_get_opp_count_ReturnThruPtr_opp_count(&opp_count);
+    mod_scmi_from_protocol_api_respond_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    mod_scmi_from_protocol_api_scmi_frame_validation_ExpectAnyArgsAndReturn(
+        SCMI_SUCCESS);
+
+    status = to_protocol_api->message_handler(
+        (fwk_id_t)MOD_SCMI_PROTOCOL_ID_PERF,
+        service_id,
+        (const uint32_t *)&payload,
+        payload_size_table[MOD_SCMI_PERF_DESCRIBE_LEVELS],
+        MOD_SCMI_PERF_DESCRIBE_LEVELS);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+static unsigned int get_latency_count;
+
+int get_latency_count_callback(
+    fwk_id_t domain_id,
+    uint16_t *latency,
+    int NumCalls)
+{
+    get_latency_count++;
+    *latency = test_dvfs_config.latency;
+
+    return FWK_SUCCESS;
+}
+
+static void describe_levels_image_setup(void)
+{
+    get_nth_opp_count = 0;
+    get_latency_count = 0;
+    levels_written_size = 0;
+    mod_dvfs_domain_api_get_nth_opp_Stub(get_nth_opp_count_callback);
+    mod_dvfs_domain_api_get_latency_Stub(get_latency_count_callback);
+    mod_scmi_from_protocol_api_write_payload_Stub(
+        describe_levels_handler_image_write_payload_callback);
+    mod_scmi_from_protocol_api_respond_Stub(NULL);
+}
+
+/*
+ * Test that the levels are read from DVFS once, and served from the image of
+ * the domain afterwards
+ */
+void utest_scmi_perf_describe_levels_handler_image_reused(void)
+{
+    describe_levels_image_setup();
+
+    describe_levels_image_request(0);
+    describe_levels_image_request(2);
+
+    TEST_ASSERT_EQUAL(1, get_latency_count);
+    TEST_ASSERT_EQUAL(TEST_OPP_COUNT, get_nth_opp_count);
+    TEST_ASSERT_EQUAL(TEST_OPP_COUNT, test_levels_images[0].level_count);
+    TEST_ASSERT_EQUAL(
+        sizeof(struct scmi_perf_level) * (TEST_OPP_COUNT - 2),
+        levels_written_size);
+    TEST_ASSERT_EQUAL(test_dvfs_config.opps[2].level, first_level_written);
+}
+
+static unsigned int get_element_idx_callback(fwk_id_t id, int NumCalls)
+{
+    return id.element.element_idx;
+}
+
+/*
+ * Test that the image is built again once DVFS has signalled that the
+ * operating points of the domain have been updated
+ */
+void utest_scmi_perf_describe_levels_handler_image_invalidated(void)
+{
+    describe_levels_image_setup();
+
+    describe_levels_image_request(0);
+    TEST_ASSERT_TRUE(test_levels_images[0].valid);
+
+    test_levels_images[1].valid = true;
+    test_levels_images[2].valid = true;
+
+    fwk_id_get_element_idx_Stub(get_element_idx_callback);
+
+    /* Only the images of the domains of the updated DVFS domain are dropped */
+    perf_update_api.notify_opps_updated(
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_DVFS, DVFS_ELEMENT_IDX_1));
+    TEST_ASSERT_TRUE(test_levels_images[0].valid);
+    TEST_ASSERT_FALSE(test_levels_images[1].valid);
+    TEST_ASSERT_TRUE(test_levels_images[2].valid);
+
+    perf_update_api.notify_opps_updated(
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_DVFS, DVFS_ELEMENT_IDX_0));
+    TEST_ASSERT_FALSE(test_levels_images[0].valid);
+
+    fwk_id_get_element_idx_Stub(NULL);
+
+    describe_levels_image_request(0);
+    TEST_ASSERT_TRUE(test_levels_images[0].valid);
+    TEST_ASSERT_EQUAL(2 * TEST_OPP_COUNT, get_nth_opp_count);
+}
+
+/*
+ * Test that the levels are read from DVFS one at a time when there is no
+ * memory for the image
+ */
+void utest_scmi_perf_describe_levels_handler_image_no_memory(void)
+{
+    describe_levels_image_setup();
+    test_levels_images[0].levels = NULL;
+    test_levels_images[0].capacity = 0;
+
+    fwk_mm_realloc_ExpectAndReturn(
+        NULL, TEST_OPP_COUNT, sizeof(struct scmi_perf_level), NULL);
+    describe_levels_image_request(0);
+
+    TEST_ASSERT_EQUAL(TEST_OPP_COUNT, get_nth_opp_count);
+    TEST_ASSERT_EQUAL(sizeof(struct scmi_perf_level), levels_written_size);
+    TEST_ASSERT_FALSE(test_levels_images[0].valid);
+    TEST_ASSERT_NULL(test_levels_images[0].levels);
+}
+#endif
+
 /* Test the describe_levels_handler function with an invalid domain_id */
 int describe_levels_handler_invalid_domain_id_respond_callback(
     fwk_id_t service_id,
@@ -1041,6 +1255,11 @@ int scmi_perf_protocol_ops_test_main(void)
     RUN_TEST(utest_scmi_perf_describe_levels_handler_valid_param);
     RUN_TEST(utest_scmi_perf_describe_levels_handler_invalid_domain_id);
     RUN_TEST(utest_scmi_perf_describe_levels_handler_invalid_level_index);
+#ifdef BUILD_HAS_SCMI_DESCRIBE_IMAGES
+    RUN_TEST(utest_scmi_perf_describe_levels_handler_image_reused);
+    RUN_TEST(utest_scmi_perf_describe_levels_handler_image_invalidated);
+    RUN_TEST(utest_scmi_perf_describe_levels_handler_image_no_memory);
+#endif
 
 #ifdef BUILD_HAS_SCMI_PERF_FAST_CHANNELS
     RUN_TEST(utest_scmi_perf_describe_fast_channels_valid_params);
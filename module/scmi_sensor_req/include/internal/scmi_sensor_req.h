@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -24,6 +24,17 @@
  */
 #define SCMI_PROTOCOL_VERSION_SENSOR UINT32_C(0x30000)
 
+/*
+ * SCMI sensor requester event indices
+ */
+enum scmi_sensor_req_event_idx {
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+    /* No response has been received for the pending reading */
+    SCMI_SENSOR_REQ_EVENT_IDX_READING_TIMEOUT,
+#endif
+    SCMI_SENSOR_REQ_EVENT_IDX_COUNT,
+};
+
 /*
  * SENSOR_READING_GET
  */
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -67,6 +67,24 @@ struct scmi_sensor_req_config {
      * \brief Async flag
      */
     enum scmi_sensor_req_async_flag async_flag;
+
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+    /*!
+     * \brief Time to wait for the response to a reading, in milliseconds.
+     *
+     * \details A reading whose response has not been received in time is
+     *      completed with ::FWK_E_TIMEOUT. Zero waits forever. Requires the
+     *      timer module.
+     */
+    unsigned int reading_timeout_ms;
+
+    /*!
+     * \brief Identifier of the alarm timing out the readings.
+     *
+     * \details Only used when reading_timeout_ms is not zero.
+     */
+    fwk_id_t reading_timeout_alarm_id;
+#endif
 };
 
 /*!
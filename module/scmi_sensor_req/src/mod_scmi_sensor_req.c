@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -15,11 +15,16 @@
 
 #include <mod_scmi.h>
 #include <mod_sensor.h>
+#if defined(BUILD_HAS_SCMI_REQUESTER_PIPELINING) && \
+    defined(BUILD_HAS_MOD_TIMER)
+#    include <mod_timer.h>
+#endif
 
 #include <fwk_assert.h>
 #include <fwk_core.h>
 #include <fwk_event.h>
 #include <fwk_id.h>
+#include <fwk_log.h>
 #include <fwk_macros.h>
 #include <fwk_mm.h>
 #include <fwk_module.h>
@@ -35,6 +40,16 @@
  */
 struct scmi_sensor_req_elem_ctx {
     const struct scmi_sensor_req_config *config;
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+    /* Whether a reading request is awaiting its response */
+    bool reading_pending;
+    /* Token of the reading request awaiting its response */
+    uint8_t reading_token;
+#    ifdef BUILD_HAS_MOD_TIMER
+    /* Alarm API used to time out the pending reading */
+    const struct mod_timer_alarm_api *alarm_api;
+#    endif
+#endif
 };
 
 /*
@@ -79,6 +94,7 @@ static_assert(
     FWK_ARRAY_SIZE(handler_table) == FWK_ARRAY_SIZE(payload_size_table),
     "[SCMI] Sensor management protocol table sizes not consistent");
 
+#ifndef BUILD_HAS_SCMI_REQUESTER_PIPELINING
 /*
  * Static helper for getting the corresponding sensor HAL ID from
  * a given Service ID.
@@ -109,6 +125,108 @@ static int get_sensor_hal_id_from_service_id(
 
     return status;
 }
+#endif
+
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+/*
+ * The reading timeout alarm parameter identifies both the element and the
+ * reading, so that a timeout racing with the response cannot fail the next
+ * reading of the sensor.
+ */
+#    define READING_TIMEOUT_PARAM(element_idx, token) \
+        (((uintptr_t)(token) << 16) | (uintptr_t)(element_idx))
+#    define READING_TIMEOUT_ELEMENT_IDX(param) \
+        ((unsigned int)((param) & UINT16_MAX))
+#    define READING_TIMEOUT_TOKEN(param) ((uint8_t)((param) >> 16))
+
+#    ifdef BUILD_HAS_MOD_TIMER
+static void reading_timeout_alarm_callback(uintptr_t param)
+{
+    struct fwk_event event = (struct fwk_event){
+        .id = FWK_ID_EVENT(
+            FWK_MODULE_IDX_SCMI_SENSOR_REQ,
+            SCMI_SENSOR_REQ_EVENT_IDX_READING_TIMEOUT),
+        .source_id = FWK_ID_MODULE(FWK_MODULE_IDX_SCMI_SENSOR_REQ),
+        .target_id = FWK_ID_ELEMENT(
+            FWK_MODULE_IDX_SCMI_SENSOR_REQ, READING_TIMEOUT_ELEMENT_IDX(param)),
+    };
+
+    event.params[0] = READING_TIMEOUT_TOKEN(param);
+
+    if (fwk_put_event(&event) != FWK_SUCCESS) {
+        FWK_LOG_ERR("[SCMI-SENSOR-REQ] Reading timeout event lost");
+    }
+}
+#    endif
+
+/* Start timing out the reading which has just been requested */
+static void reading_timeout_start(
+    struct scmi_sensor_req_elem_ctx *ctx,
+    uint32_t element_idx)
+{
+#    ifdef BUILD_HAS_MOD_TIMER
+    int status;
+
+    if (ctx->alarm_api == NULL) {
+        return;
+    }
+
+    status = ctx->alarm_api->start(
+        ctx->config->reading_timeout_alarm_id,
+        ctx->config->reading_timeout_ms,
+        MOD_TIMER_ALARM_TYPE_ONCE,
+        reading_timeout_alarm_callback,
+        READING_TIMEOUT_PARAM(element_idx, ctx->reading_token));
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_ERR("[SCMI-SENSOR-REQ] Reading timeout not started");
+    }
+#    endif
+}
+
+static void reading_timeout_stop(struct scmi_sensor_req_elem_ctx *ctx)
+{
+#    ifdef BUILD_HAS_MOD_TIMER
+    if (ctx->alarm_api != NULL) {
+        (void)ctx->alarm_api->stop(ctx->config->reading_timeout_alarm_id);
+    }
+#    endif
+}
+
+/*
+ * Static helper for getting the Sensor HAL ID of the reading request a
+ * response completes. Several sensors can share a service, each with a
+ * reading request in flight, so the response is matched by token.
+ */
+static int get_sensor_hal_id_from_response(
+    fwk_id_t service_id,
+    fwk_id_t *sensor_hal_id)
+{
+    struct scmi_sensor_req_elem_ctx *ctx;
+    unsigned int sens_req_idx;
+    uint16_t token;
+    int status;
+
+    status = scmi_sensor_req_ctx.scmi_api->get_response_token(
+        service_id, &token);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    for (sens_req_idx = 0u; sens_req_idx < scmi_sensor_req_ctx.element_count;
+         sens_req_idx++) {
+        ctx = &scmi_sensor_req_ctx.ctx_table[sens_req_idx];
+        if (ctx->reading_pending && (ctx->reading_token == token) &&
+            fwk_id_is_equal(service_id, ctx->config->service_id)) {
+            ctx->reading_pending = false;
+            reading_timeout_stop(ctx);
+            *sensor_hal_id = ctx->config->sensor_hal_id;
+            return FWK_SUCCESS;
+        }
+    }
+
+    return FWK_E_PARAM;
+}
+#endif
 
 /*
  * Sensor Requester Response handlers
@@ -131,7 +249,11 @@ static int scmi_sensor_req_ret_reading_handler(
     /*
      * Get the Sensor ID element which corresponds to service_id.
      */
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+    status = get_sensor_hal_id_from_response(service_id, &sensor_hal_id);
+#else
     status = get_sensor_hal_id_from_service_id(service_id, &sensor_hal_id);
+#endif
 
     if (status == FWK_SUCCESS) {
         /*
@@ -165,6 +287,7 @@ static int scmi_sensor_req_get_value(fwk_id_t id, mod_sensor_value_t *value)
     int status;
     uint8_t scmi_protocol_id = (uint8_t)MOD_SCMI_PROTOCOL_ID_SENSOR;
     uint8_t scmi_message_id = (uint8_t)MOD_SCMI_SENSOR_READING_GET;
+    uint8_t token;
     uint32_t element_idx;
     struct scmi_sensor_req_elem_ctx *ctx;
     struct scmi_sensor_protocol_reading_get_a2p payload = { 0 };
@@ -174,23 +297,37 @@ static int scmi_sensor_req_get_value(fwk_id_t id, mod_sensor_value_t *value)
     if (element_idx < scmi_sensor_req_ctx.element_count) {
         ctx = &(scmi_sensor_req_ctx.ctx_table[element_idx]);
 
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+        /* The reading already requested completes this request as well */
+        if (ctx->reading_pending) {
+            return FWK_PENDING;
+        }
+#endif
+
         payload.sensor_id = ctx->config->scmi_sensor_id;
         payload.flags = (uint32_t)(ctx->config->async_flag);
 
+        /*
+         * Token is incremented with each message sent to ease debugging and
+         * to match the responses of the sensors sharing a service.
+         */
+        token = scmi_sensor_req_ctx.token++;
+
         status = scmi_sensor_req_ctx.scmi_api->scmi_send_message(
             scmi_message_id,
             scmi_protocol_id,
-            /*
-             * Token is incremented with each message sent to ease
-             * debugging
-             */
-            scmi_sensor_req_ctx.token++,
+            token,
             ctx->config->service_id,
             (const void *)&payload,
             sizeof(payload),
             true);
 
         if (status == FWK_SUCCESS) {
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+            ctx->reading_pending = true;
+            ctx->reading_token = token;
+            reading_timeout_start(ctx, element_idx);
+#endif
             status = FWK_PENDING;
         }
     } else {
@@ -314,6 +451,19 @@ static int scmi_sensor_req_bind(fwk_id_t id, unsigned int round)
                 ctx->config->sensor_hal_id,
                 mod_sensor_api_id_driver_response,
                 &scmi_sensor_req_ctx.resp_api);
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+            if ((status == FWK_SUCCESS) &&
+                (ctx->config->reading_timeout_ms != 0)) {
+#    ifdef BUILD_HAS_MOD_TIMER
+                status = fwk_module_bind(
+                    ctx->config->reading_timeout_alarm_id,
+                    MOD_TIMER_API_ID_ALARM,
+                    &ctx->alarm_api);
+#    else
+                status = FWK_E_PANIC;
+#    endif
+            }
+#endif
         }
     }
 
@@ -343,11 +493,49 @@ static int scmi_sensor_req_process_bind_request(
     return FWK_E_ACCESS;
 }
 
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+/*
+ * No response has been received in time for the pending reading. Fail it, so
+ * that the sensor can request it again, and discard the late response.
+ */
+static int scmi_sensor_req_process_event(
+    const struct fwk_event *event,
+    struct fwk_event *resp_event)
+{
+    struct mod_sensor_driver_resp_params resp_params = {
+        .status = FWK_E_TIMEOUT,
+    };
+    struct scmi_sensor_req_elem_ctx *ctx;
+
+    if (fwk_id_get_event_idx(event->id) !=
+        (unsigned int)SCMI_SENSOR_REQ_EVENT_IDX_READING_TIMEOUT) {
+        return FWK_E_PARAM;
+    }
+
+    ctx = &(scmi_sensor_req_ctx
+                .ctx_table[fwk_id_get_element_idx(event->target_id)]);
+    if (!ctx->reading_pending || (ctx->reading_token != event->params[0])) {
+        /* The response has been received in the meantime */
+        return FWK_SUCCESS;
+    }
+
+    ctx->reading_pending = false;
+    scmi_sensor_req_ctx.resp_api->reading_complete(
+        ctx->config->sensor_hal_id, &resp_params);
+
+    return FWK_SUCCESS;
+}
+#endif
+
 const struct fwk_module module_scmi_sensor_req = {
     .api_count = (unsigned int)2,
+    .event_count = (unsigned int)SCMI_SENSOR_REQ_EVENT_IDX_COUNT,
     .type = FWK_MODULE_TYPE_PROTOCOL,
     .init = scmi_sensor_req_init,
     .element_init = scmi_sensor_req_elem_init,
     .bind = scmi_sensor_req_bind,
     .process_bind_request = scmi_sensor_req_process_bind_request,
+#ifdef BUILD_HAS_SCMI_REQUESTER_PIPELINING
+    .process_event = scmi_sensor_req_process_event,
+#endif
 };
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -14,6 +14,7 @@ enum fwk_module_idx {
     FWK_MODULE_IDX_SCMI_SENSOR_REQ,
     FWK_MODULE_IDX_SCMI,
     FWK_MODULE_IDX_SENSOR,
+    FWK_MODULE_IDX_TIMER,
     FWK_MODULE_IDX_COUNT,
 };
 
@@ -0,0 +1,328 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_id.h>
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+
+#include <mod_scmi.h>
+#include <mod_scmi_sensor_req.h>
+
+#include <fwk_macros.h>
+
+#include <stdlib.h>
+
+#include UNIT_TEST_SRC
+
+#define FAKE_SCMI_SERVICE_IDX 0
+#define FAKE_TIMEOUT_MS       10
+
+enum fake_sensors {
+    FAKE_SENSOR_IDX_0,
+    FAKE_SENSOR_IDX_1,
+    FAKE_SENSOR_IDX_COUNT,
+};
+
+/* Both sensors share the same SCMI service */
+static const struct scmi_sensor_req_config sensor_config[] = {
+    [FAKE_SENSOR_IDX_0] = {
+        .service_id =
+            FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_SCMI, FAKE_SCMI_SERVICE_IDX),
+        .scmi_sensor_id = 4,
+        .sensor_hal_id =
+            FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_SENSOR, FAKE_SENSOR_IDX_0),
+        .reading_timeout_ms = FAKE_TIMEOUT_MS,
+    },
+    [FAKE_SENSOR_IDX_1] = {
+        .service_id =
+            FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_SCMI, FAKE_SCMI_SERVICE_IDX),
+        .scmi_sensor_id = 5,
+        .sensor_hal_id =
+            FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_SENSOR, FAKE_SENSOR_IDX_1),
+        .reading_timeout_ms = FAKE_TIMEOUT_MS,
+    },
+};
+
+static const fwk_id_t service_id =
+    FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_SCMI, FAKE_SCMI_SERVICE_IDX);
+
+static unsigned int send_count;
+static uint8_t sent_token;
+static uint16_t response_token;
+
+static unsigned int complete_count;
+static fwk_id_t completed_sensor_id;
+static struct mod_sensor_driver_resp_params completed_params;
+
+static unsigned int alarm_start_count;
+static unsigned int alarm_stop_count;
+static uintptr_t alarm_param;
+
+static int scmi_send_message(
+    uint8_t scmi_message_id,
+    uint8_t scmi_protocol_id,
+    uint8_t token,
+    fwk_id_t service_id,
+    const void *payload,
+    size_t payload_size,
+    bool request_ack_by_interrupt)
+{
+    send_count++;
+    sent_token = token;
+
+    return FWK_SUCCESS;
+}
+
+static int response_message_handler(fwk_id_t service_id)
+{
+    return FWK_SUCCESS;
+}
+
+static int get_response_token(fwk_id_t service_id, uint16_t *token)
+{
+    *token = response_token;
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_scmi_from_protocol_req_api scmi_api = {
+    .scmi_send_message = scmi_send_message,
+    .response_message_handler = response_message_handler,
+    .get_response_token = get_response_token,
+};
+
+static void reading_complete(
+    fwk_id_t id,
+    struct mod_sensor_driver_resp_params *response)
+{
+    complete_count++;
+    completed_sensor_id = id;
+    completed_params = *response;
+}
+
+static const struct mod_sensor_driver_response_api resp_api = {
+    .reading_complete = reading_complete,
+};
+
+static int alarm_start(
+    fwk_id_t alarm_id,
+    unsigned int milliseconds,
+    enum mod_timer_alarm_type type,
+    void (*callback)(uintptr_t param),
+    uintptr_t param)
+{
+    TEST_ASSERT_EQUAL(FAKE_TIMEOUT_MS, milliseconds);
+    TEST_ASSERT_EQUAL(MOD_TIMER_ALARM_TYPE_ONCE, type);
+
+    alarm_start_count++;
+    alarm_param = param;
+
+    return FWK_SUCCESS;
+}
+
+static int alarm_stop(fwk_id_t alarm_id)
+{
+    alarm_stop_count++;
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_timer_alarm_api alarm_api = {
+    .start = alarm_start,
+    .stop = alarm_stop,
+};
+
+static void *calloc_callback(size_t num, size_t size, int NumCalls)
+{
+    return calloc(num, size);
+}
+
+static unsigned int get_element_idx_callback(fwk_id_t id, int NumCalls)
+{
+    return id.element.element_idx;
+}
+
+static unsigned int get_event_idx_callback(fwk_id_t id, int NumCalls)
+{
+    return id.event.event_idx;
+}
+
+static bool is_equal_callback(fwk_id_t left, fwk_id_t right, int NumCalls)
+{
+    return left.value == right.value;
+}
+
+/* Platform side: respond to the reading request with the given token */
+static int respond(uint16_t token, uint32_t value)
+{
+    struct scmi_sensor_protocol_reading_get_p2a payload = {
+        .status = SCMI_SUCCESS,
+        .sensor_value_low = value,
+    };
+
+    response_token = token;
+
+    return scmi_sensor_req_message_handler(
+        FWK_ID_MODULE(FWK_MODULE_IDX_SCMI_SENSOR_REQ),
+        service_id,
+        (const uint32_t *)&payload,
+        sizeof(payload),
+        MOD_SCMI_SENSOR_READING_GET);
+}
+
+static int timeout(unsigned int element_idx, uint8_t token)
+{
+    struct fwk_event event = {
+        .id = FWK_ID_EVENT_INIT(
+            FWK_MODULE_IDX_SCMI_SENSOR_REQ,
+            SCMI_SENSOR_REQ_EVENT_IDX_READING_TIMEOUT),
+        .target_id =
+            FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_SCMI_SENSOR_REQ, element_idx),
+    };
+
+    event.params[0] = token;
+
+    return scmi_sensor_req_process_event(&event, NULL);
+}
+
+static int get_value(unsigned int element_idx)
+{
+    mod_sensor_value_t value;
+
+    return scmi_sensor_req_get_value(
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SCMI_SENSOR_REQ, element_idx), &value);
+}
+
+void setUp(void)
+{
+    unsigned int element_idx;
+
+    fwk_mm_calloc_StubWithCallback(calloc_callback);
+    fwk_id_get_element_idx_StubWithCallback(get_element_idx_callback);
+    fwk_id_get_event_idx_StubWithCallback(get_event_idx_callback);
+    fwk_id_is_equal_StubWithCallback(is_equal_callback);
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        scmi_sensor_req_init(
+            fwk_module_id_scmi_sensor_req, FAKE_SENSOR_IDX_COUNT, NULL));
+
+    for (element_idx = 0; element_idx < FAKE_SENSOR_IDX_COUNT; element_idx++) {
+        TEST_ASSERT_EQUAL(
+            FWK_SUCCESS,
+            scmi_sensor_req_elem_init(
+                FWK_ID_ELEMENT(FWK_MODULE_IDX_SCMI_SENSOR_REQ, element_idx),
+                0,
+                &sensor_config[element_idx]));
+        scmi_sensor_req_ctx.ctx_table[element_idx].alarm_api = &alarm_api;
+    }
+
+    scmi_sensor_req_ctx.scmi_api = &scmi_api;
+    scmi_sensor_req_ctx.resp_api = &resp_api;
+
+    send_count = 0;
+    complete_count = 0;
+    alarm_start_count = 0;
+    alarm_stop_count = 0;
+}
+
+void tearDown(void)
+{
+    fwk_mm_calloc_Stub(NULL);
+    fwk_id_get_element_idx_Stub(NULL);
+    fwk_id_get_event_idx_Stub(NULL);
+    fwk_id_is_equal_Stub(NULL);
+}
+
+/* Test that the responses are routed by token to the sensors of a service */
+void test_reading_shared_service(void)
+{
+    uint8_t token_0, token_1;
+
+    TEST_ASSERT_EQUAL(FWK_PENDING, get_value(FAKE_SENSOR_IDX_0));
+    token_0 = sent_token;
+    TEST_ASSERT_EQUAL(FWK_PENDING, get_value(FAKE_SENSOR_IDX_1));
+    token_1 = sent_token;
+    TEST_ASSERT_EQUAL(2, alarm_start_count);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, respond(token_1, 51));
+    TEST_ASSERT_EQUAL(1, complete_count);
+    TEST_ASSERT_EQUAL(
+        sensor_config[FAKE_SENSOR_IDX_1].sensor_hal_id.value,
+        completed_sensor_id.value);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, completed_params.status);
+    TEST_ASSERT_EQUAL(51, completed_params.value);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, respond(token_0, 40));
+    TEST_ASSERT_EQUAL(2, complete_count);
+    TEST_ASSERT_EQUAL(
+        sensor_config[FAKE_SENSOR_IDX_0].sensor_hal_id.value,
+        completed_sensor_id.value);
+    TEST_ASSERT_EQUAL(2, alarm_stop_count);
+}
+
+/* Test that a reading requested again while pending is not sent twice */
+void test_reading_pending_not_resent(void)
+{
+    TEST_ASSERT_EQUAL(FWK_PENDING, get_value(FAKE_SENSOR_IDX_0));
+    TEST_ASSERT_EQUAL(FWK_PENDING, get_value(FAKE_SENSOR_IDX_0));
+    TEST_ASSERT_EQUAL(1, send_count);
+    TEST_ASSERT_EQUAL(1, alarm_start_count);
+}
+
+/*
+ * Test that a reading whose response is not received in time is failed, that
+ * the sensor can request it again and that the late response is discarded
+ */
+void test_reading_timeout(void)
+{
+    uint8_t token;
+
+    TEST_ASSERT_EQUAL(FWK_PENDING, get_value(FAKE_SENSOR_IDX_1));
+    token = sent_token;
+    TEST_ASSERT_EQUAL(
+        FAKE_SENSOR_IDX_1, READING_TIMEOUT_ELEMENT_IDX(alarm_param));
+    TEST_ASSERT_EQUAL(token, READING_TIMEOUT_TOKEN(alarm_param));
+
+    /* The timeout of a reading already responded to is ignored */
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, timeout(FAKE_SENSOR_IDX_1, token + 1));
+    TEST_ASSERT_EQUAL(0, complete_count);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, timeout(FAKE_SENSOR_IDX_1, token));
+    TEST_ASSERT_EQUAL(1, complete_count);
+    TEST_ASSERT_EQUAL(FWK_E_TIMEOUT, completed_params.status);
+    TEST_ASSERT_EQUAL(
+        sensor_config[FAKE_SENSOR_IDX_1].sensor_hal_id.value,
+        completed_sensor_id.value);
+    TEST_ASSERT_FALSE(
+        scmi_sensor_req_ctx.ctx_table[FAKE_SENSOR_IDX_1].reading_pending);
+
+    /* The late response does not complete another reading */
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, respond(token, 10));
+    TEST_ASSERT_EQUAL(1, complete_count);
+
+    /* The reading can be requested again */
+    TEST_ASSERT_EQUAL(FWK_PENDING, get_value(FAKE_SENSOR_IDX_1));
+    TEST_ASSERT_EQUAL(2, send_count);
+}
+
+int scmi_sensor_req_test_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_reading_shared_service);
+    RUN_TEST(test_reading_pending_not_resent);
+    RUN_TEST(test_reading_timeout);
+    return UNITY_END();
+}
+
+int main(void)
+{
+    return scmi_sensor_req_test_main();
+}
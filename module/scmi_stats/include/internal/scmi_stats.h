@@ -0,0 +1,86 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *      SCMI Statistics Protocol Support
+ */
+
+#ifndef INTERNAL_SCMI_STATS_H
+#define INTERNAL_SCMI_STATS_H
+
+#include <mod_scmi.h>
+
+#include <stdint.h>
+
+/*
+ * Protocol Attributes
+ */
+
+#define SCMI_STATS_PROTOCOL_ATTRIBUTES_BUCKET_COUNT_POS 0
+
+#define SCMI_STATS_PROTOCOL_ATTRIBUTES_BUCKET_COUNT_MASK \
+    (UINT32_C(0xFF) << SCMI_STATS_PROTOCOL_ATTRIBUTES_BUCKET_COUNT_POS)
+
+/*
+ * Latency Describe
+ */
+
+#define SCMI_STATS_LATENCY_DESCRIBE_COUNT_POS     0U
+#define SCMI_STATS_LATENCY_DESCRIBE_REMAINING_POS 16U
+
+#define SCMI_STATS_LATENCY_DESCRIBE_COUNT_MASK \
+    (UINT32_C(0xFFF) << SCMI_STATS_LATENCY_DESCRIBE_COUNT_POS)
+#define SCMI_STATS_LATENCY_DESCRIBE_REMAINING_MASK \
+    (UINT32_C(0xFFFF) << SCMI_STATS_LATENCY_DESCRIBE_REMAINING_POS)
+
+#define SCMI_STATS_LATENCY_DESCRIBE_NUM_ENTRIES(ENTRY_COUNT, REMAINING) \
+    ((((ENTRY_COUNT) << SCMI_STATS_LATENCY_DESCRIBE_COUNT_POS) & \
+      SCMI_STATS_LATENCY_DESCRIBE_COUNT_MASK) | \
+     (((REMAINING) << SCMI_STATS_LATENCY_DESCRIBE_REMAINING_POS) & \
+      SCMI_STATS_LATENCY_DESCRIBE_REMAINING_MASK))
+
+#define SCMI_STATS_LATENCY_ENTRY_AGENT_ID_POS    16U
+#define SCMI_STATS_LATENCY_ENTRY_PROTOCOL_ID_POS 8U
+#define SCMI_STATS_LATENCY_ENTRY_MESSAGE_ID_POS  0U
+
+#define SCMI_STATS_LATENCY_ENTRY_ID(AGENT_ID, PROTOCOL_ID, MESSAGE_ID) \
+    (((uint32_t)(AGENT_ID) << SCMI_STATS_LATENCY_ENTRY_AGENT_ID_POS) | \
+     ((uint32_t)(PROTOCOL_ID) << SCMI_STATS_LATENCY_ENTRY_PROTOCOL_ID_POS) | \
+     ((uint32_t)(MESSAGE_ID) << SCMI_STATS_LATENCY_ENTRY_MESSAGE_ID_POS))
+
+#define SCMI_STATS_LATENCY_ENTRIES_MAX(MAILBOX_SIZE) \
+    ((sizeof(struct scmi_stats_latency_describe_p2a) < (MAILBOX_SIZE)) ? \
+         (((MAILBOX_SIZE) - sizeof(struct scmi_stats_latency_describe_p2a)) / \
+          sizeof(struct scmi_stats_latency_entry)) : \
+         0)
+
+struct scmi_stats_latency_entry {
+    uint32_t id;
+    uint32_t count;
+    uint32_t error_count;
+    uint32_t max_latency;
+    uint32_t histogram[MOD_SCMI_LATENCY_HISTOGRAM_BUCKET_COUNT];
+};
+
+struct scmi_stats_latency_describe_a2p {
+    uint32_t entry_index;
+};
+
+struct scmi_stats_latency_describe_p2a {
+    int32_t status;
+    uint32_t num_entries;
+    struct scmi_stats_latency_entry entries[];
+};
+
+/*
+ * Latency Reset
+ */
+
+struct scmi_stats_latency_reset_p2a {
+    int32_t status;
+};
+
+#endif /* INTERNAL_SCMI_STATS_H */
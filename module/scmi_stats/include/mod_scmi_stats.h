@@ -0,0 +1,45 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *      SCMI Statistics Protocol Support.
+ */
+
+#ifndef MOD_SCMI_STATS_H
+#define MOD_SCMI_STATS_H
+
+#include <stdint.h>
+
+/*!
+ * \ingroup GroupModules Modules
+ * \defgroup GroupSCMI_STATS SCMI Statistics Protocol
+ * \{
+ */
+
+/*!
+ * \brief SCMI statistics protocol
+ */
+#define MOD_SCMI_PROTOCOL_ID_STATS UINT32_C(0x92)
+
+/*!
+ * \brief SCMI statistics protocol version
+ */
+#define MOD_SCMI_PROTOCOL_VERSION_STATS UINT32_C(0x10000)
+
+/*!
+ * \brief Identifiers of the SCMI Statistics Protocol commands
+ */
+enum mod_scmi_stats_command_id {
+    MOD_SCMI_STATS_LATENCY_DESCRIBE = 0x3,
+    MOD_SCMI_STATS_LATENCY_RESET = 0x4,
+    MOD_SCMI_STATS_COMMAND_COUNT,
+};
+
+/*!
+ * \}
+ */
+
+#endif /* MOD_SCMI_STATS_H */
@@ -0,0 +1,519 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *     SCMI Statistics Protocol Support.
+ */
+
+#include <internal/scmi_stats.h>
+
+#include <mod_scmi.h>
+#include <mod_scmi_stats.h>
+
+#include <fwk_assert.h>
+#include <fwk_id.h>
+#include <fwk_log.h>
+#include <fwk_macros.h>
+#include <fwk_module.h>
+#include <fwk_module_idx.h>
+#include <fwk_status.h>
+#include <fwk_string.h>
+
+#ifdef BUILD_HAS_DEBUGGER
+#    include <cli.h>
+
+#    include <string.h>
+#endif
+
+#ifdef BUILD_HAS_MOD_RESOURCE_PERMS
+#    include <mod_resource_perms.h>
+#endif
+
+#include <stdint.h>
+
+#ifndef BUILD_HAS_SCMI_LATENCY_STATS
+#    error "SCMI statistics protocol used without SCMI latency statistics."
+#endif
+
+struct scmi_stats_ctx {
+    /* SCMI module API */
+    const struct mod_scmi_from_protocol_api *scmi_api;
+
+    /* SCMI latency statistics API */
+    const struct mod_scmi_latency_stats_api *latency_stats_api;
+
+#ifdef BUILD_HAS_MOD_RESOURCE_PERMS
+    /* SCMI Resource Permissions API */
+    const struct mod_res_permissions_api *res_perms_api;
+#endif
+};
+
+static int scmi_stats_protocol_version_handler(
+    fwk_id_t service_id,
+    const uint32_t *payload);
+static int scmi_stats_protocol_attributes_handler(
+    fwk_id_t service_id,
+    const uint32_t *payload);
+static int scmi_stats_protocol_message_attributes_handler(
+    fwk_id_t service_id,
+    const uint32_t *payload);
+static int scmi_stats_latency_describe_handler(
+    fwk_id_t service_id,
+    const uint32_t *payload);
+static int scmi_stats_latency_reset_handler(
+    fwk_id_t service_id,
+    const uint32_t *payload);
+
+/*
+ * Internal variables.
+ */
+static struct scmi_stats_ctx scmi_stats_ctx;
+
+static handler_table_t handler_table[MOD_SCMI_STATS_COMMAND_COUNT] = {
+    [MOD_SCMI_PROTOCOL_VERSION] = scmi_stats_protocol_version_handler,
+    [MOD_SCMI_PROTOCOL_ATTRIBUTES] = scmi_stats_protocol_attributes_handler,
+    [MOD_SCMI_PROTOCOL_MESSAGE_ATTRIBUTES] =
+        scmi_stats_protocol_message_attributes_handler,
+    [MOD_SCMI_STATS_LATENCY_DESCRIBE] = scmi_stats_latency_describe_handler,
+    [MOD_SCMI_STATS_LATENCY_RESET] = scmi_stats_latency_reset_handler,
+};
+
+static const unsigned int payload_size_table[MOD_SCMI_STATS_COMMAND_COUNT] = {
+    [MOD_SCMI_PROTOCOL_VERSION] = 0,
+    [MOD_SCMI_PROTOCOL_ATTRIBUTES] = 0,
+    [MOD_SCMI_PROTOCOL_MESSAGE_ATTRIBUTES] =
+        (unsigned int)sizeof(struct scmi_protocol_message_attributes_a2p),
+    [MOD_SCMI_STATS_LATENCY_DESCRIBE] =
+        (unsigned int)sizeof(struct scmi_stats_latency_describe_a2p),
+    [MOD_SCMI_STATS_LATENCY_RESET] = 0,
+};
+
+/*
+ * Protocol Version
+ */
+static int scmi_stats_protocol_version_handler(
+    fwk_id_t service_id,
+    const uint32_t *payload)
+{
+    struct scmi_protocol_version_p2a return_values = {
+        .status = (int32_t)SCMI_SUCCESS,
+        .version = MOD_SCMI_PROTOCOL_VERSION_STATS,
+    };
+
+    return scmi_stats_ctx.scmi_api->respond(
+        service_id, &return_values, sizeof(return_values));
+}
+
+/*
+ * Protocol Attributes
+ */
+static int scmi_stats_protocol_attributes_handler(
+    fwk_id_t service_id,
+    const uint32_t *payload)
+{
+    struct scmi_protocol_attributes_p2a return_values = {
+        .status = (int32_t)SCMI_SUCCESS,
+        .attributes = ((uint32_t)MOD_SCMI_LATENCY_HISTOGRAM_BUCKET_COUNT
+                       << SCMI_STATS_PROTOCOL_ATTRIBUTES_BUCKET_COUNT_POS) &
+            SCMI_STATS_PROTOCOL_ATTRIBUTES_BUCKET_COUNT_MASK,
+    };
+
+    return scmi_stats_ctx.scmi_api->respond(
+        service_id, &return_values, sizeof(return_values));
+}
+
+/*
+ * Protocol Message Attributes
+ */
+static int scmi_stats_protocol_message_attributes_handler(
+    fwk_id_t service_id,
+    const uint32_t *payload)
+{
+    size_t response_size;
+    const struct scmi_protocol_message_attributes_a2p *parameters;
+    unsigned int message_id;
+    struct scmi_protocol_message_attributes_p2a return_values = {
+        .status = (int32_t)SCMI_SUCCESS,
+        .attributes = 0,
+    };
+
+    parameters = (const struct scmi_protocol_message_attributes_a2p *)payload;
+    message_id = parameters->message_id;
+
+    if ((message_id >= FWK_ARRAY_SIZE(handler_table)) ||
+        (handler_table[message_id] == NULL)) {
+        return_values.status = (int32_t)SCMI_NOT_FOUND;
+    }
+
+    response_size = (return_values.status == SCMI_SUCCESS) ?
+        sizeof(return_values) :
+        sizeof(return_values.status);
+
+    return scmi_stats_ctx.scmi_api->respond(
+        service_id, &return_values, response_size);
+}
+
+/*
+ * Latency Describe
+ */
+static int scmi_stats_latency_describe_handler(
+    fwk_id_t service_id,
+    const uint32_t *payload)
+{
+    int status, respond_status;
+    size_t max_payload_size;
+    uint32_t payload_size;
+    unsigned int i;
+    unsigned int index;
+    unsigned int total_count;
+    unsigned int entry_count;
+    const struct scmi_stats_latency_describe_a2p *parameters;
+    struct mod_scmi_latency_stats stats;
+    struct scmi_stats_latency_entry entry;
+    struct scmi_stats_latency_describe_p2a return_values = {
+        .status = (int32_t)SCMI_GENERIC_ERROR,
+    };
+
+    parameters = (const struct scmi_stats_latency_describe_a2p *)payload;
+    index = parameters->entry_index;
+    payload_size = (uint32_t)sizeof(return_values);
+
+    status = scmi_stats_ctx.latency_stats_api->get_count(&total_count);
+    if (status != FWK_SUCCESS) {
+        goto exit;
+    }
+
+    if (index > total_count) {
+        return_values.status = (int32_t)SCMI_OUT_OF_RANGE;
+        goto exit;
+    }
+
+    /*
+     * Get the maximum payload size to determine how many entries can be
+     * returned in one response.
+     */
+    status = scmi_stats_ctx.scmi_api->get_max_payload_size(
+        service_id, &max_payload_size);
+    if (status != FWK_SUCCESS) {
+        goto exit;
+    }
+
+    if (SCMI_STATS_LATENCY_ENTRIES_MAX(max_payload_size) == 0) {
+        status = FWK_E_SIZE;
+        goto exit;
+    }
+
+    entry_count = (unsigned int)FWK_MIN(
+        SCMI_STATS_LATENCY_ENTRIES_MAX(max_payload_size),
+        total_count - index);
+
+    for (i = 0; i < entry_count; i++,
+        payload_size += (uint32_t)sizeof(struct scmi_stats_latency_entry)) {
+        status =
+            scmi_stats_ctx.latency_stats_api->get_stats(index + i, &stats);
+        if (status != FWK_SUCCESS) {
+            goto exit;
+        }
+
+        entry = (struct scmi_stats_latency_entry){
+            .id = SCMI_STATS_LATENCY_ENTRY_ID(
+                stats.agent_id, stats.protocol_id, stats.message_id),
+            .count = stats.count,
+            .error_count = stats.error_count,
+            .max_latency = stats.max_latency,
+        };
+        fwk_str_memcpy(
+            entry.histogram, stats.histogram, sizeof(entry.histogram));
+
+        status = scmi_stats_ctx.scmi_api->write_payload(
+            service_id, payload_size, &entry, sizeof(entry));
+        if (status != FWK_SUCCESS) {
+            goto exit;
+        }
+    }
+
+    return_values.num_entries = SCMI_STATS_LATENCY_DESCRIBE_NUM_ENTRIES(
+        entry_count, (total_count - index) - entry_count);
+    return_values.status = (int32_t)SCMI_SUCCESS;
+
+exit:
+    respond_status = scmi_stats_ctx.scmi_api->write_payload(
+        service_id, 0, &return_values, sizeof(return_values));
+    if (respond_status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[SCMI-STATS] %s @%d", __func__, __LINE__);
+    }
+
+    respond_status = scmi_stats_ctx.scmi_api->respond(
+        service_id,
+        NULL,
+        (return_values.status == SCMI_SUCCESS) ? payload_size :
+                                                 sizeof(return_values.status));
+    if (respond_status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[SCMI-STATS] %s @%d", __func__, __LINE__);
+    }
+
+    return status;
+}
+
+/*
+ * Latency Reset
+ */
+static int scmi_stats_latency_reset_handler(
+    fwk_id_t service_id,
+    const uint32_t *payload)
+{
+    int status;
+    struct scmi_stats_latency_reset_p2a return_values = {
+        .status = (int32_t)SCMI_SUCCESS,
+    };
+
+    status = scmi_stats_ctx.latency_stats_api->reset();
+    if (status != FWK_SUCCESS) {
+        return_values.status = (int32_t)SCMI_GENERIC_ERROR;
+    }
+
+    return scmi_stats_ctx.scmi_api->respond(
+        service_id, &return_values, sizeof(return_values));
+}
+
+#ifdef BUILD_HAS_MOD_RESOURCE_PERMS
+/*
+ * SCMI Resource Permissions handler
+ */
+static int scmi_stats_permissions_handler(
+    fwk_id_t service_id,
+    unsigned int message_id)
+{
+    enum mod_res_perms_permissions perms;
+    unsigned int agent_id;
+    int status;
+
+    status = scmi_stats_ctx.scmi_api->get_agent_id(service_id, &agent_id);
+    if (status != FWK_SUCCESS) {
+        return FWK_E_ACCESS;
+    }
+
+    /* Reading the statistics is allowed to every agent */
+    if (message_id < MOD_SCMI_STATS_LATENCY_RESET) {
+        return FWK_SUCCESS;
+    }
+
+    /*
+     * The statistics are shared by all the agents, so resetting them is
+     * restricted to the agents the platform grants the command to.
+     */
+    perms = scmi_stats_ctx.res_perms_api->agent_has_message_permission(
+        agent_id, MOD_SCMI_PROTOCOL_ID_STATS, message_id);
+
+    if (perms == MOD_RES_PERMS_ACCESS_ALLOWED) {
+        return FWK_SUCCESS;
+    } else {
+        return FWK_E_ACCESS;
+    }
+}
+#endif
+
+/*
+ * SCMI module -> SCMI statistics module interface
+ */
+static int scmi_stats_get_scmi_protocol_id(
+    fwk_id_t protocol_id,
+    uint8_t *scmi_protocol_id)
+{
+    *scmi_protocol_id = (uint8_t)MOD_SCMI_PROTOCOL_ID_STATS;
+
+    return FWK_SUCCESS;
+}
+
+static int scmi_stats_message_handler(
+    fwk_id_t protocol_id,
+    fwk_id_t service_id,
+    const uint32_t *payload,
+    size_t payload_size,
+    unsigned int message_id)
+{
+    int32_t return_value;
+#ifdef BUILD_HAS_MOD_RESOURCE_PERMS
+    int status;
+#endif
+
+    static_assert(
+        FWK_ARRAY_SIZE(handler_table) == FWK_ARRAY_SIZE(payload_size_table),
+        "[SCMI] Statistics protocol table sizes not consistent");
+    fwk_assert(payload != NULL);
+
+    if (message_id >= FWK_ARRAY_SIZE(handler_table)) {
+        return_value = (int32_t)SCMI_NOT_FOUND;
+        goto error;
+    }
+
+    if (payload_size != payload_size_table[message_id]) {
+        return_value = (int32_t)SCMI_PROTOCOL_ERROR;
+        goto error;
+    }
+
+#ifdef BUILD_HAS_MOD_RESOURCE_PERMS
+    status = scmi_stats_permissions_handler(service_id, message_id);
+    if (status != FWK_SUCCESS) {
+        return_value = (int32_t)SCMI_DENIED;
+        goto error;
+    }
+#endif
+
+    return handler_table[message_id](service_id, payload);
+
+error:
+    return scmi_stats_ctx.scmi_api->respond(
+        service_id, &return_value, sizeof(return_value));
+}
+
+static struct mod_scmi_to_protocol_api scmi_stats_mod_scmi_to_protocol_api = {
+    .get_scmi_protocol_id = scmi_stats_get_scmi_protocol_id,
+    .message_handler = scmi_stats_message_handler,
+};
+
+#ifdef BUILD_HAS_DEBUGGER
+/*
+ * Debugger CLI command
+ */
+static const char scmi_stats_cli_call[] = "scmistats";
+static const char scmi_stats_cli_help[] =
+    "  Displays the SCMI message latency statistics.\n"
+    "    Usage: scmistats [reset]\n"
+    "      The histogram bucket 'i' counts the responses sent in less than\n"
+    "      16 << (2 * i) microseconds, the last bucket counts the others.\n";
+
+static int32_t scmi_stats_cli_f(int32_t argc, char **argv)
+{
+    int status;
+    unsigned int count;
+    unsigned int index;
+    unsigned int bucket;
+    struct mod_scmi_latency_stats stats;
+
+    if ((argc == 2) && (strcmp(argv[1], "reset") == 0)) {
+        return scmi_stats_ctx.latency_stats_api->reset();
+    }
+
+    status = scmi_stats_ctx.latency_stats_api->get_count(&count);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    cli_print("agent prot msg count errors max(us) histogram\n");
+
+    for (index = 0; index < count; index++) {
+        status = scmi_stats_ctx.latency_stats_api->get_stats(index, &stats);
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+
+        cli_printf(
+            NONE,
+            "%5u 0x%02x 0x%02x %u %u %u",
+            (unsigned int)stats.agent_id,
+            (unsigned int)stats.protocol_id,
+            (unsigned int)stats.message_id,
+            (unsigned int)stats.count,
+            (unsigned int)stats.error_count,
+            (unsigned int)stats.max_latency);
+
+        for (bucket = 0; bucket < MOD_SCMI_LATENCY_HISTOGRAM_BUCKET_COUNT;
+             bucket++) {
+            cli_printf(NONE, " %u", (unsigned int)stats.histogram[bucket]);
+        }
+        cli_print("\n");
+    }
+
+    return FWK_SUCCESS;
+}
+#endif
+
+/*
+ * Framework handlers
+ */
+
+static int scmi_stats_init(
+    fwk_id_t module_id,
+    unsigned int element_count,
+    const void *data)
+{
+    return FWK_SUCCESS;
+}
+
+static int scmi_stats_bind(fwk_id_t id, unsigned int round)
+{
+    int status;
+
+    if (round == 1) {
+        return FWK_SUCCESS;
+    }
+
+    /* Bind to the SCMI module, storing API pointers for later use. */
+    status = fwk_module_bind(
+        FWK_ID_MODULE(FWK_MODULE_IDX_SCMI),
+        FWK_ID_API(FWK_MODULE_IDX_SCMI, MOD_SCMI_API_IDX_PROTOCOL),
+        &scmi_stats_ctx.scmi_api);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    status = fwk_module_bind(
+        FWK_ID_MODULE(FWK_MODULE_IDX_SCMI),
+        FWK_ID_API(FWK_MODULE_IDX_SCMI, MOD_SCMI_API_IDX_LATENCY_STATS),
+        &scmi_stats_ctx.latency_stats_api);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+#ifdef BUILD_HAS_MOD_RESOURCE_PERMS
+    status = fwk_module_bind(
+        FWK_ID_MODULE(FWK_MODULE_IDX_RESOURCE_PERMS),
+        FWK_ID_API(FWK_MODULE_IDX_RESOURCE_PERMS, MOD_RES_PERM_RESOURCE_PERMS),
+        &scmi_stats_ctx.res_perms_api);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+#endif
+
+    return FWK_SUCCESS;
+}
+
+static int scmi_stats_start(fwk_id_t id)
+{
+#ifdef BUILD_HAS_DEBUGGER
+    return cli_command_register((cli_command_st){
+        scmi_stats_cli_call, scmi_stats_cli_help, &scmi_stats_cli_f, false });
+#else
+    return FWK_SUCCESS;
+#endif
+}
+
+static int scmi_stats_process_bind_request(
+    fwk_id_t source_id,
+    fwk_id_t target_id,
+    fwk_id_t api_id,
+    const void **api)
+{
+    /* Only accept binding requests from the SCMI module. */
+    if (!fwk_id_is_equal(source_id, FWK_ID_MODULE(FWK_MODULE_IDX_SCMI))) {
+        return FWK_E_ACCESS;
+    }
+
+    *api = &scmi_stats_mod_scmi_to_protocol_api;
+
+    return FWK_SUCCESS;
+}
+
+/* SCMI Statistics Protocol Definition */
+const struct fwk_module module_scmi_stats = {
+    .api_count = 1,
+    .type = FWK_MODULE_TYPE_PROTOCOL,
+    .init = scmi_stats_init,
+    .bind = scmi_stats_bind,
+    .start = scmi_stats_start,
+    .process_bind_request = scmi_stats_process_bind_request,
+};
@@ -0,0 +1,337 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_id.h>
+#include <Mockfwk_module.h>
+
+#include <mod_scmi.h>
+
+#include <fwk_macros.h>
+
+#include <string.h>
+
+#include UNIT_TEST_SRC
+
+#define STATS_ENTRY_COUNT 3
+
+/* Room for the response header and two latency entries */
+#define MAX_PAYLOAD_SIZE \
+    (sizeof(struct scmi_stats_latency_describe_p2a) + \
+     (2 * sizeof(struct scmi_stats_latency_entry)))
+
+static const fwk_id_t service_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_SCMI, 0);
+
+static struct mod_scmi_latency_stats stats_table[STATS_ENTRY_COUNT];
+static unsigned int stats_count;
+static unsigned int reset_count;
+
+static uint32_t response[64];
+static size_t response_size;
+
+#ifdef BUILD_HAS_MOD_RESOURCE_PERMS
+#    define PRIVILEGED_AGENT_ID 1
+#    define UNPRIVILEGED_AGENT_ID 2
+
+static unsigned int agent_id;
+
+static int get_agent_id(fwk_id_t service_id, unsigned int *id)
+{
+    *id = agent_id;
+
+    return FWK_SUCCESS;
+}
+
+static enum mod_res_perms_permissions agent_has_message_permission(
+    uint32_t agent_id,
+    uint32_t protocol_id,
+    uint32_t message_id)
+{
+    TEST_ASSERT_EQUAL(MOD_SCMI_PROTOCOL_ID_STATS, protocol_id);
+
+    return (agent_id == PRIVILEGED_AGENT_ID) ? MOD_RES_PERMS_ACCESS_ALLOWED :
+                                               MOD_RES_PERMS_ACCESS_DENIED;
+}
+
+static const struct mod_res_permissions_api res_perms_api = {
+    .agent_has_message_permission = agent_has_message_permission,
+};
+#endif
+
+static int get_max_payload_size(fwk_id_t service_id, size_t *size)
+{
+    *size = MAX_PAYLOAD_SIZE;
+
+    return FWK_SUCCESS;
+}
+
+static int write_payload(
+    fwk_id_t service_id,
+    size_t offset,
+    const void *payload,
+    size_t size)
+{
+    TEST_ASSERT_LESS_OR_EQUAL(MAX_PAYLOAD_SIZE, offset + size);
+    memcpy((uint8_t *)response + offset, payload, size);
+
+    return FWK_SUCCESS;
+}
+
+static int respond(fwk_id_t service_id, const void *payload, size_t size)
+{
+    if (payload != NULL) {
+        memcpy(response, payload, size);
+    }
+    response_size = size;
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_scmi_from_protocol_api scmi_api = {
+#ifdef BUILD_HAS_MOD_RESOURCE_PERMS
+    .get_agent_id = get_agent_id,
+#endif
+    .get_max_payload_size = get_max_payload_size,
+    .write_payload = write_payload,
+    .respond = respond,
+};
+
+static int get_count(unsigned int *count)
+{
+    *count = stats_count;
+
+    return FWK_SUCCESS;
+}
+
+static int get_stats(unsigned int index, struct mod_scmi_latency_stats *stats)
+{
+    if (index >= stats_count) {
+        return FWK_E_RANGE;
+    }
+
+    *stats = stats_table[index];
+
+    return FWK_SUCCESS;
+}
+
+static int reset(void)
+{
+    reset_count++;
+    stats_count = 0;
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_scmi_latency_stats_api latency_stats_api = {
+    .get_count = get_count,
+    .get_stats = get_stats,
+    .reset = reset,
+};
+
+static int handle_message(
+    unsigned int message_id,
+    const uint32_t *payload,
+    size_t payload_size)
+{
+    return scmi_stats_message_handler(
+        fwk_module_id_scmi_stats,
+        service_id,
+        payload,
+        payload_size,
+        message_id);
+}
+
+void setUp(void)
+{
+    unsigned int index;
+
+    scmi_stats_ctx.scmi_api = &scmi_api;
+    scmi_stats_ctx.latency_stats_api = &latency_stats_api;
+#ifdef BUILD_HAS_MOD_RESOURCE_PERMS
+    scmi_stats_ctx.res_perms_api = &res_perms_api;
+    agent_id = PRIVILEGED_AGENT_ID;
+#endif
+
+    for (index = 0; index < STATS_ENTRY_COUNT; index++) {
+        stats_table[index] = (struct mod_scmi_latency_stats){
+            .agent_id = 1,
+            .protocol_id = MOD_SCMI_PROTOCOL_ID_PERF,
+            .message_id = index,
+            .count = 10 + index,
+            .error_count = index,
+            .max_latency = 100 * index,
+            .histogram = { [1] = 10 + index },
+        };
+    }
+    stats_count = STATS_ENTRY_COUNT;
+    reset_count = 0;
+
+    memset(response, 0, sizeof(response));
+    response_size = 0;
+}
+
+void tearDown(void)
+{
+}
+
+void test_protocol_attributes(void)
+{
+    uint32_t payload = 0;
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS, handle_message(MOD_SCMI_PROTOCOL_ATTRIBUTES, &payload, 0));
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, (int32_t)response[0]);
+    TEST_ASSERT_EQUAL(MOD_SCMI_LATENCY_HISTOGRAM_BUCKET_COUNT, response[1]);
+}
+
+void test_message_errors(void)
+{
+    uint32_t payload = 0;
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        handle_message(MOD_SCMI_STATS_COMMAND_COUNT, &payload, 0));
+    TEST_ASSERT_EQUAL(SCMI_NOT_FOUND, (int32_t)response[0]);
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        handle_message(MOD_SCMI_STATS_LATENCY_DESCRIBE, &payload, 0));
+    TEST_ASSERT_EQUAL(SCMI_PROTOCOL_ERROR, (int32_t)response[0]);
+
+    payload = MOD_SCMI_STATS_COMMAND_COUNT;
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        handle_message(
+            MOD_SCMI_PROTOCOL_MESSAGE_ATTRIBUTES, &payload, sizeof(payload)));
+    TEST_ASSERT_EQUAL(SCMI_NOT_FOUND, (int32_t)response[0]);
+    TEST_ASSERT_EQUAL(sizeof(int32_t), response_size);
+}
+
+/*
+ * Test that the entries are returned in as many responses as needed, each
+ * response holding as many entries as fit in the payload
+ */
+void test_latency_describe(void)
+{
+    const struct scmi_stats_latency_describe_p2a *return_values =
+        (const struct scmi_stats_latency_describe_p2a *)response;
+    struct scmi_stats_latency_describe_a2p parameters = { .entry_index = 0 };
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        handle_message(
+            MOD_SCMI_STATS_LATENCY_DESCRIBE,
+            (const uint32_t *)&parameters,
+            sizeof(parameters)));
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, return_values->status);
+    TEST_ASSERT_EQUAL(
+        SCMI_STATS_LATENCY_DESCRIBE_NUM_ENTRIES(2, 1),
+        return_values->num_entries);
+    TEST_ASSERT_EQUAL(MAX_PAYLOAD_SIZE, response_size);
+    TEST_ASSERT_EQUAL(
+        SCMI_STATS_LATENCY_ENTRY_ID(1, MOD_SCMI_PROTOCOL_ID_PERF, 1),
+        return_values->entries[1].id);
+    TEST_ASSERT_EQUAL(11, return_values->entries[1].count);
+    TEST_ASSERT_EQUAL(1, return_values->entries[1].error_count);
+    TEST_ASSERT_EQUAL(100, return_values->entries[1].max_latency);
+    TEST_ASSERT_EQUAL(11, return_values->entries[1].histogram[1]);
+
+    parameters.entry_index = 2;
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        handle_message(
+            MOD_SCMI_STATS_LATENCY_DESCRIBE,
+            (const uint32_t *)&parameters,
+            sizeof(parameters)));
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, return_values->status);
+    TEST_ASSERT_EQUAL(
+        SCMI_STATS_LATENCY_DESCRIBE_NUM_ENTRIES(1, 0),
+        return_values->num_entries);
+    TEST_ASSERT_EQUAL(
+        SCMI_STATS_LATENCY_ENTRY_ID(1, MOD_SCMI_PROTOCOL_ID_PERF, 2),
+        return_values->entries[0].id);
+
+    /* Starting right after the last entry returns no entry */
+    parameters.entry_index = STATS_ENTRY_COUNT;
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        handle_message(
+            MOD_SCMI_STATS_LATENCY_DESCRIBE,
+            (const uint32_t *)&parameters,
+            sizeof(parameters)));
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, return_values->status);
+    TEST_ASSERT_EQUAL(0, return_values->num_entries);
+
+    parameters.entry_index = STATS_ENTRY_COUNT + 1;
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        handle_message(
+            MOD_SCMI_STATS_LATENCY_DESCRIBE,
+            (const uint32_t *)&parameters,
+            sizeof(parameters)));
+    TEST_ASSERT_EQUAL(SCMI_OUT_OF_RANGE, return_values->status);
+    TEST_ASSERT_EQUAL(sizeof(int32_t), response_size);
+}
+
+void test_latency_reset(void)
+{
+    uint32_t payload = 0;
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS, handle_message(MOD_SCMI_STATS_LATENCY_RESET, &payload, 0));
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, (int32_t)response[0]);
+    TEST_ASSERT_EQUAL(1, reset_count);
+    TEST_ASSERT_EQUAL(0, stats_count);
+}
+
+#ifdef BUILD_HAS_MOD_RESOURCE_PERMS
+/*
+ * Test that the statistics can be read by any agent but only reset by the
+ * agents granted the command
+ */
+void test_latency_reset_denied(void)
+{
+    uint32_t payload = 0;
+    struct scmi_stats_latency_describe_a2p parameters = { .entry_index = 0 };
+
+    agent_id = UNPRIVILEGED_AGENT_ID;
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS, handle_message(MOD_SCMI_STATS_LATENCY_RESET, &payload, 0));
+    TEST_ASSERT_EQUAL(SCMI_DENIED, (int32_t)response[0]);
+    TEST_ASSERT_EQUAL(0, reset_count);
+    TEST_ASSERT_EQUAL(STATS_ENTRY_COUNT, stats_count);
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        handle_message(
+            MOD_SCMI_STATS_LATENCY_DESCRIBE,
+            (const uint32_t *)&parameters,
+            sizeof(parameters)));
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, (int32_t)response[0]);
+}
+#endif
+
+int scmi_stats_test_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_protocol_attributes);
+    RUN_TEST(test_message_errors);
+    RUN_TEST(test_latency_describe);
+    RUN_TEST(test_latency_reset);
+#ifdef BUILD_HAS_MOD_RESOURCE_PERMS
+    RUN_TEST(test_latency_reset_denied);
+#endif
+    return UNITY_END();
+}
+
+int main(void)
+{
+    return scmi_stats_test_main();
+}
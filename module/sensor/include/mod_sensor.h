@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -137,6 +137,23 @@ enum mod_sensor_type {
 struct mod_sensor_trip_point_info {
     /*! Sensor trip point count */
     uint32_t count;
+
+    /*!
+     * \brief Hysteresis applied when the value falls back below a trip point.
+     *
+     * \details Once the value has risen above a trip point, the trip point is
+     *      only considered crossed back once the value falls to or below
+     *      the trip point value minus this hysteresis.
+     */
+    uint64_t hysteresis;
+
+    /*!
+     * \brief Number of consecutive readings that must agree on a trip point
+     *      crossing before it is reported.
+     *
+     * \details A value of 0 or 1 reports crossings on the first reading.
+     */
+    uint32_t debounce_count;
 };
 
 /*!
@@ -357,6 +374,61 @@ struct mod_sensor_trip_point_params {
     enum mod_sensor_trip_point_mode mode;
 };
 
+#ifdef BUILD_HAS_SENSOR_FILTER
+/*!
+ * \brief Largest smoothing factor shift of the exponential moving average.
+ */
+#define MOD_SENSOR_FILTER_EMA_SHIFT_MAX 16
+
+/*!
+ * \brief Sensor reading filter type.
+ */
+enum mod_sensor_filter_type {
+    /*! No smoothing, the readings are only clamped if configured */
+    MOD_SENSOR_FILTER_NONE = 0,
+
+    /*! Exponential moving average */
+    MOD_SENSOR_FILTER_EMA,
+
+    /*! Average of the last readings */
+    MOD_SENSOR_FILTER_MOVING_AVERAGE,
+
+    /*! Median of the last readings */
+    MOD_SENSOR_FILTER_MEDIAN,
+};
+
+/*!
+ * \brief Sensor reading filter configuration.
+ *
+ * \details Each new reading is first clamped to within `max_step` of the
+ *      previous filtered value, and then goes through the filter.
+ */
+struct mod_sensor_filter_config {
+    /*! Filter type */
+    enum mod_sensor_filter_type type;
+
+    /*!
+     * \brief Smoothing factor of the exponential moving average.
+     *
+     * \details Each reading is given a weight of 1 / 2^ema_shift. Must not
+     *      be greater than ::MOD_SENSOR_FILTER_EMA_SHIFT_MAX.
+     */
+    uint8_t ema_shift;
+
+    /*! Number of readings of the moving average and median windows */
+    uint8_t window_length;
+
+    /*!
+     * \brief Largest change of the value accepted from one reading to the
+     *      next.
+     *
+     * \details Readings further away from the previous filtered value are
+     *      clamped. When zero, readings are not clamped.
+     */
+    uint64_t max_step;
+};
+#endif
+
 /*!
  * \brief Sensor device configuration.
  *
@@ -382,8 +454,70 @@ struct mod_sensor_dev_config {
     /*! Sensor timestamp default values configuration */
     struct mod_sensor_timestamp_info timestamp;
 #endif
+
+#ifdef BUILD_HAS_SENSOR_CACHE
+    /*!
+     * \brief Maximum age, in microseconds, of a cached reading.
+     *
+     * \details A successful reading younger than this is returned by
+     *      ::mod_sensor_api::get_data without calling the driver. Older
+     *      readings are refreshed by the driver, once for all the requests
+     *      received while the refresh is pending. When zero, every request
+     *      reads the driver.
+     */
+    uint32_t cache_max_age_us;
+#endif
+
+#ifdef BUILD_HAS_SENSOR_SAMPLING
+    /*!
+     * \brief Number of background samples kept for the sensor.
+     *
+     * \details Sensors with a non-zero history length are read in the
+     *      background at their update interval. Sensors with more than one
+     *      axis, or a zero update interval, are not sampled.
+     */
+    uint8_t history_length;
+#endif
+
+#ifdef BUILD_HAS_SENSOR_FILTER
+    /*!
+     * \brief Filter applied to the readings.
+     *
+     * \details Filters only apply to sensors with a single axis.
+     */
+    struct mod_sensor_filter_config filter;
+#endif
 };
 
+#ifdef BUILD_HAS_SCMI_SENSOR_EVENTS
+/*!
+ * \brief Sensor trip point statistics.
+ */
+struct mod_sensor_trip_point_stats {
+    /*!
+     * Number of readings that went below a trip point value the previous
+     * reading was above, and whose crossing was held back by the hysteresis
+     */
+    uint32_t hysteresis_suppressed_count;
+
+    /*! Number of readings whose crossings were held back by the debounce */
+    uint32_t debounce_suppressed_count;
+};
+#endif
+
+#ifdef BUILD_HAS_SENSOR_CACHE
+/*!
+ * \brief Sensor reading cache statistics.
+ */
+struct mod_sensor_cache_stats {
+    /*! Number of requests served from the cache */
+    uint32_t hit_count;
+
+    /*! Number of requests which found the cached reading stale */
+    uint32_t miss_count;
+};
+#endif
+
 /*!
  * \brief Sensor data.
  *
@@ -402,6 +536,11 @@ struct mod_sensor_data {
         mod_sensor_value_t value;
     };
 
+#ifdef BUILD_HAS_SENSOR_FILTER
+    /*! Sensor scalar value before filtering */
+    mod_sensor_value_t raw_value;
+#endif
+
 #ifdef BUILD_HAS_SENSOR_TIMESTAMP
     /*! Timestamp value */
     uint64_t timestamp;
@@ -424,8 +563,40 @@ struct mod_sensor_config {
 
     /*! Trip point API identifier */
     fwk_id_t trip_point_api_id;
+
+#ifdef BUILD_HAS_SENSOR_SAMPLING
+    /*!
+     * \brief Identifier of the alarm driving the background sampling.
+     *
+     * \details The background sampling is disabled if this identifier is
+     *      left undefined or set to ::FWK_ID_NONE.
+     */
+    fwk_optional_id_t sampling_alarm_id;
+
+    /*!
+     * \brief Period, in milliseconds, of the background sampling ticks.
+     *
+     * \details The update intervals of the sensors are rounded up to a
+     *      multiple of this period, so that sensors with close intervals are
+     *      read on the same ticks.
+     */
+    unsigned int sampling_period_ms;
+#endif
 };
 
+#ifdef BUILD_HAS_SENSOR_SAMPLING
+/*!
+ * \brief Background sample of a sensor.
+ */
+struct mod_sensor_sample {
+    /*! Sensor value */
+    mod_sensor_value_t value;
+
+    /*! Time of the reading, in nanoseconds, from ::fwk_time_current */
+    uint64_t timestamp;
+};
+#endif
+
 /*!
  * \brief Sensor driver API.
  *
@@ -719,6 +890,53 @@ struct mod_sensor_api {
         uint32_t axis,
         struct mod_sensor_axis_info *info);
 #endif
+
+#ifdef BUILD_HAS_SENSOR_CACHE
+    /*!
+     * \brief Get the reading cache statistics of a sensor.
+     *
+     * \param id Specific sensor device id.
+     * \param[out] stats The cache statistics.
+     *
+     * \retval ::FWK_SUCCESS Operation succeeded.
+     * \retval ::FWK_E_PARAM The `stats` parameter was a null pointer value.
+     */
+    int (*get_cache_stats)(fwk_id_t id, struct mod_sensor_cache_stats *stats);
+#endif
+
+#ifdef BUILD_HAS_SENSOR_SAMPLING
+    /*!
+     * \brief Get the most recent background samples of a sensor.
+     *
+     * \param id Specific sensor device id.
+     * \param[out] samples Table receiving the samples, most recent first.
+     * \param[in, out] count Number of entries of the table on entry, and
+     *      number of samples written on return.
+     *
+     * \retval ::FWK_SUCCESS Operation succeeded.
+     * \retval ::FWK_E_PARAM A null pointer was given.
+     * \retval ::FWK_E_SUPPORT The sensor is not sampled in the background.
+     */
+    int (*get_history)(
+        fwk_id_t id,
+        struct mod_sensor_sample *samples,
+        unsigned int *count);
+#endif
+
+#ifdef BUILD_HAS_SCMI_SENSOR_EVENTS
+    /*!
+     * \brief Get the trip point statistics of a sensor.
+     *
+     * \param id Specific sensor device id.
+     * \param[out] stats Trip point statistics.
+     *
+     * \retval ::FWK_SUCCESS Operation succeeded.
+     * \retval ::FWK_E_PARAM The `stats` parameter was a null pointer value.
+     */
+    int (*get_trip_point_stats)(
+        fwk_id_t id,
+        struct mod_sensor_trip_point_stats *stats);
+#endif
 };
 
 /*!
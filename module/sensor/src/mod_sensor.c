@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -21,6 +21,9 @@
 #include <fwk_module_idx.h>
 #include <fwk_status.h>
 #include <fwk_string.h>
+#if defined(BUILD_HAS_SENSOR_CACHE) || defined(BUILD_HAS_SENSOR_SAMPLING)
+#    include <fwk_time.h>
+#endif
 
 #include <stdbool.h>
 #include <stddef.h>
@@ -71,63 +74,390 @@ static inline void sensor_data_copy(
 #endif
 }
 
+#ifdef BUILD_HAS_SENSOR_CACHE
+static inline bool sensor_cache_is_enabled(const struct sensor_dev_ctx *ctx)
+{
+    return ctx->config->cache_max_age_us > 0;
+}
+
+static bool sensor_cache_is_fresh(const struct sensor_dev_ctx *ctx)
+{
+    if (ctx->last_read.status != FWK_SUCCESS) {
+        return false;
+    }
+
+    /* A reading taken within the resolution of the time driver has no age */
+    return fwk_time_elapsed(ctx->last_read_time, fwk_time_current()) <=
+        FWK_US(ctx->config->cache_max_age_us);
+}
+
+static void sensor_cache_update(struct sensor_dev_ctx *ctx)
+{
+    if (sensor_cache_is_enabled(ctx)) {
+        ctx->last_read_time = fwk_time_current();
+    }
+}
+#endif
+
+#ifdef BUILD_HAS_SENSOR_FILTER
+/*
+ * Limit the change of the value to max_step from the previous filtered value.
+ */
+static mod_sensor_value_t sensor_filter_clamp(
+    const struct sensor_dev_ctx *ctx,
+    mod_sensor_value_t value)
+{
+    uint64_t max_step = ctx->config->filter.max_step;
+    mod_sensor_value_t previous = ctx->filter.value;
+
+    if ((max_step == 0) || (ctx->filter.count == 0)) {
+        return value;
+    }
+
+    if ((value > previous) && ((uint64_t)(value - previous) > max_step)) {
+        return previous + (mod_sensor_value_t)max_step;
+    }
+
+    if ((value < previous) && ((uint64_t)(previous - value) > max_step)) {
+        return previous - (mod_sensor_value_t)max_step;
+    }
+
+    return value;
+}
+
+static mod_sensor_value_t sensor_filter_ema(
+    struct sensor_filter_ctx *filter,
+    uint8_t shift,
+    mod_sensor_value_t value)
+{
+    mod_sensor_value_t scale = (mod_sensor_value_t)1 << shift;
+
+    if (filter->count == 0) {
+        filter->accumulator = value * scale;
+        filter->count = 1;
+    } else {
+        filter->accumulator += value - (filter->accumulator / scale);
+    }
+
+    return filter->accumulator / scale;
+}
+
+static mod_sensor_value_t sensor_filter_moving_average(
+    struct sensor_filter_ctx *filter,
+    uint8_t length,
+    mod_sensor_value_t value)
+{
+    if (filter->count == length) {
+        filter->accumulator -= filter->window[filter->head];
+    } else {
+        filter->count++;
+    }
+
+    filter->accumulator += value;
+    filter->window[filter->head] = value;
+    filter->head = (filter->head + 1) % length;
+
+    return filter->accumulator / (mod_sensor_value_t)filter->count;
+}
+
+static mod_sensor_value_t sensor_filter_median(
+    struct sensor_filter_ctx *filter,
+    uint8_t length,
+    mod_sensor_value_t value)
+{
+    mod_sensor_value_t *sorted = filter->sorted;
+    mod_sensor_value_t lower, upper;
+    unsigned int i, count = filter->count;
+
+    if (count == length) {
+        /* Drop the oldest reading from the sorted readings */
+        for (i = 0; sorted[i] != filter->window[filter->head]; i++) {
+            continue;
+        }
+        for (; i < (count - 1); i++) {
+            sorted[i] = sorted[i + 1];
+        }
+        count--;
+    }
+
+    for (i = count; (i > 0) && (sorted[i - 1] > value); i--) {
+        sorted[i] = sorted[i - 1];
+    }
+    sorted[i] = value;
+    count++;
+
+    filter->count = count;
+    filter->window[filter->head] = value;
+    filter->head = (filter->head + 1) % length;
+
+    lower = sorted[(count - 1) / 2];
+    upper = sorted[count / 2];
+
+    return lower + ((upper - lower) / 2);
+}
+
+/*
+ * Filter a new reading. The unfiltered value is kept in raw_value.
+ */
+static void sensor_filter_apply(struct sensor_dev_ctx *ctx)
+{
+    const struct mod_sensor_filter_config *config = &ctx->config->filter;
+    struct sensor_filter_ctx *filter = &ctx->filter;
+    mod_sensor_value_t value;
+
+#ifdef BUILD_HAS_SENSOR_MULTI_AXIS
+    if (ctx->axis_count > 1) {
+        return;
+    }
+#endif
+
+    value = ctx->last_read.value;
+    ctx->last_read.raw_value = value;
+
+    if ((config->type == MOD_SENSOR_FILTER_NONE) && (config->max_step == 0)) {
+        return;
+    }
+
+    value = sensor_filter_clamp(ctx, value);
+
+    switch (config->type) {
+    case MOD_SENSOR_FILTER_EMA:
+        value = sensor_filter_ema(filter, config->ema_shift, value);
+        break;
+
+    case MOD_SENSOR_FILTER_MOVING_AVERAGE:
+        value = sensor_filter_moving_average(
+            filter, config->window_length, value);
+        break;
+
+    case MOD_SENSOR_FILTER_MEDIAN:
+        value = sensor_filter_median(filter, config->window_length, value);
+        break;
+
+    default:
+        filter->count = 1;
+        break;
+    }
+
+    filter->value = value;
+    ctx->last_read.value = value;
+}
+#endif
+
 #ifdef BUILD_HAS_SCMI_SENSOR_EVENTS
-static bool trip_point_evaluate(
-    struct sensor_trip_point_ctx *ctx,
-    uint64_t value)
+static uint64_t trip_point_value(struct sensor_dev_ctx *ctx, uint32_t rank)
+{
+    uint32_t trip_point_idx = ctx->trip_point_band.order[rank];
+
+    return ctx->trip_point_ctx[trip_point_idx].params.tp_value;
+}
+
+/*
+ * Sort the trip points by increasing value. There are only a few trip points
+ * per sensor and they are seldom changed, so an insertion sort is enough.
+ */
+static void trip_point_sort(struct sensor_dev_ctx *ctx)
+{
+    uint32_t *order = ctx->trip_point_band.order;
+    uint32_t i, j, trip_point_idx;
+    uint64_t value;
+
+    for (i = 1; i < ctx->config->trip_point.count; i++) {
+        trip_point_idx = order[i];
+        value = ctx->trip_point_ctx[trip_point_idx].params.tp_value;
+
+        for (j = i; (j > 0) && (trip_point_value(ctx, j - 1) > value); j--) {
+            order[j] = order[j - 1];
+        }
+
+        order[j] = trip_point_idx;
+    }
+}
+
+static void trip_point_cross(
+    fwk_id_t id,
+    struct sensor_dev_ctx *ctx,
+    uint32_t trip_point_idx,
+    bool above_threshold)
 {
-    uint64_t threshold;
-    bool new_above_threshold, trigger = false;
+    struct sensor_trip_point_ctx *tp_ctx;
+    bool trigger;
 
-    threshold = ctx->params.tp_value;
-    new_above_threshold = value > threshold;
+    tp_ctx = &ctx->trip_point_ctx[trip_point_idx];
+    tp_ctx->above_threshold = above_threshold;
 
-    switch (ctx->params.mode) {
+    switch (tp_ctx->params.mode) {
     case MOD_SENSOR_TRIP_POINT_MODE_POSITIVE:
-        if (!ctx->above_threshold && value > threshold)
-            trigger = true;
+        trigger = above_threshold;
         break;
 
     case MOD_SENSOR_TRIP_POINT_MODE_NEGATIVE:
-        if (ctx->above_threshold && (value <= threshold))
-            trigger = true;
+        trigger = !above_threshold;
         break;
 
     case MOD_SENSOR_TRIP_POINT_MODE_TRANSITION:
-        if ((!ctx->above_threshold && value > threshold) ||
-            (ctx->above_threshold && value <= threshold))
-            trigger = true;
+        trigger = true;
         break;
 
     default:
+        trigger = false;
         break;
     }
 
-    ctx->above_threshold = new_above_threshold;
-    return trigger;
+    if (trigger && (sensor_mod_ctx.sensor_trip_point_api != NULL)) {
+        sensor_mod_ctx.sensor_trip_point_api->notify_sensor_trip_point(
+            id, above_threshold, trip_point_idx);
+    }
+}
+
+/*
+ * Evaluate every trip point against the value and rebuild the band from
+ * scratch. This is done after the trip points have been changed.
+ */
+static void trip_point_resync(
+    fwk_id_t id,
+    struct sensor_dev_ctx *ctx,
+    uint64_t value)
+{
+    struct sensor_trip_point_band_ctx *band_ctx = &ctx->trip_point_band;
+    uint32_t rank, trip_point_idx;
+    bool above_threshold;
+
+    band_ctx->band = 0;
+
+    for (rank = 0; rank < ctx->config->trip_point.count; rank++) {
+        trip_point_idx = band_ctx->order[rank];
+        above_threshold = value > trip_point_value(ctx, rank);
+
+        if (above_threshold) {
+            band_ctx->band = rank + 1;
+        }
+
+        if (above_threshold !=
+            ctx->trip_point_ctx[trip_point_idx].above_threshold) {
+            trip_point_cross(id, ctx, trip_point_idx, above_threshold);
+        }
+    }
+
+    band_ctx->raw_band = band_ctx->band;
+    band_ctx->pending_count = 0;
+    band_ctx->resync = false;
+}
+
+/*
+ * Find the band of a value without the hysteresis, starting from a band next
+ * to it.
+ */
+static uint32_t trip_point_raw_band_find(
+    struct sensor_dev_ctx *ctx,
+    uint64_t value,
+    uint32_t band)
+{
+    while ((band < ctx->config->trip_point.count) &&
+           (value > trip_point_value(ctx, band))) {
+        band++;
+    }
+
+    while ((band > 0) && (value <= trip_point_value(ctx, band - 1))) {
+        band--;
+    }
+
+    return band;
+}
+
+/*
+ * Find the band of a value. Only the trip points next to the current band are
+ * looked at, going further out only while the value keeps crossing them.
+ */
+static uint32_t trip_point_band_find(
+    struct sensor_dev_ctx *ctx,
+    uint64_t value)
+{
+    struct sensor_trip_point_band_ctx *band_ctx = &ctx->trip_point_band;
+    uint64_t hysteresis = ctx->config->trip_point.hysteresis;
+    uint64_t threshold, lower_threshold;
+    uint32_t band = band_ctx->band;
+    uint32_t raw_band;
+
+    raw_band = trip_point_raw_band_find(ctx, value, band);
+    if (raw_band >= band) {
+        band_ctx->raw_band = raw_band;
+        return raw_band;
+    }
+
+    while (band > raw_band) {
+        threshold = trip_point_value(ctx, band - 1);
+        lower_threshold = (threshold > hysteresis) ? threshold - hysteresis : 0;
+        if (value > lower_threshold) {
+            break;
+        }
+
+        band--;
+    }
+
+    /*
+     * Only count the readings that went below a trip point value the previous
+     * reading was above, and that the hysteresis held back.
+     */
+    if ((band > raw_band) && (raw_band < band_ctx->raw_band)) {
+        band_ctx->stats.hysteresis_suppressed_count++;
+    }
+
+    band_ctx->raw_band = raw_band;
+
+    return band;
 }
-#endif
 
-#ifdef BUILD_HAS_SCMI_SENSOR_EVENTS
 static void trip_point_process(fwk_id_t id, struct mod_sensor_data *data)
 {
     struct sensor_dev_ctx *ctx;
-    unsigned int i;
+    struct sensor_trip_point_band_ctx *band_ctx;
+    uint32_t debounce_count, band;
 
     fwk_check(!fwk_id_is_equal(id, FWK_ID_NONE));
     ctx = ctx_table + fwk_id_get_element_idx(id);
 
-    if (!ctx->trip_point_ctx->enabled) {
+    if ((ctx->trip_point_ctx == NULL) || !ctx->trip_point_ctx->enabled) {
+        return;
+    }
+
+    band_ctx = &ctx->trip_point_band;
+
+    if (band_ctx->resync) {
+        trip_point_resync(id, ctx, data->value);
+        return;
+    }
+
+    band = trip_point_band_find(ctx, data->value);
+    if (band == band_ctx->band) {
+        band_ctx->pending_count = 0;
         return;
     }
 
-    for (i = 0; i < ctx->config->trip_point.count; i++) {
-        if (trip_point_evaluate(&(ctx->trip_point_ctx[i]), data->value)) {
-            /* Handle trip point event*/
-            if (sensor_mod_ctx.sensor_trip_point_api != NULL)
-                sensor_mod_ctx.sensor_trip_point_api->notify_sensor_trip_point(
-                    id, ctx->trip_point_ctx->above_threshold, i);
+    debounce_count = ctx->config->trip_point.debounce_count;
+    if (debounce_count > 1) {
+        if (band != band_ctx->pending_band) {
+            band_ctx->pending_band = band;
+            band_ctx->pending_count = 0;
+        }
+
+        band_ctx->pending_count++;
+        if (band_ctx->pending_count < debounce_count) {
+            band_ctx->stats.debounce_suppressed_count++;
+            return;
         }
+
+        band_ctx->pending_count = 0;
+    }
+
+    while (band_ctx->band < band) {
+        trip_point_cross(id, ctx, band_ctx->order[band_ctx->band], true);
+        band_ctx->band++;
+    }
+
+    while (band_ctx->band > band) {
+        band_ctx->band--;
+        trip_point_cross(id, ctx, band_ctx->order[band_ctx->band], false);
     }
 }
 #endif
@@ -157,6 +487,247 @@ static int is_sensor_enabled(fwk_id_t id, bool *sensor_is_enabled)
     return FWK_E_PARAM;
 }
 
+/*
+ * Book-keeping of a successful synchronous reading
+ */
+static void sensor_reading_update(fwk_id_t id, struct sensor_dev_ctx *ctx)
+{
+#ifdef BUILD_HAS_SENSOR_FILTER
+    sensor_filter_apply(ctx);
+#endif
+#ifdef BUILD_HAS_SENSOR_CACHE
+    sensor_cache_update(ctx);
+#endif
+#ifdef BUILD_HAS_SCMI_SENSOR_EVENTS
+    trip_point_process(id, &ctx->last_read);
+#endif
+#ifdef BUILD_HAS_SENSOR_TIMESTAMP
+    ctx->last_read.timestamp = sensor_get_timestamp(id);
+#endif
+}
+
+static inline bool sensor_driver_is_idle(const struct sensor_dev_ctx *ctx)
+{
+#ifdef BUILD_HAS_SENSOR_SAMPLING
+    if (ctx->sampling.pending) {
+        return false;
+    }
+#endif
+
+    return ctx->concurrency_readings.pending_requests == 0;
+}
+
+#ifdef BUILD_HAS_SENSOR_SAMPLING
+/*
+ * Background sampling
+ */
+static void sensor_history_push(struct sensor_dev_ctx *ctx)
+{
+    struct sensor_sampling_ctx *sampling = &ctx->sampling;
+    uint8_t length = ctx->config->history_length;
+    struct mod_sensor_sample *sample;
+
+    if (ctx->last_read.status != FWK_SUCCESS) {
+        return;
+    }
+
+    sample = &sampling->history[sampling->head];
+    sample->value = ctx->last_read.value;
+    sample->timestamp = fwk_time_current();
+
+    sampling->head = (uint8_t)((sampling->head + 1) % length);
+    if (sampling->count < length) {
+        sampling->count++;
+    }
+}
+
+/*
+ * Convert the update interval of a sensor, update_interval *
+ * 10^update_interval_multiplier seconds, to a number of sampling ticks.
+ */
+static uint32_t sensor_sampling_interval_ticks(
+    const struct mod_sensor_info *info)
+{
+    uint64_t interval_ms = info->update_interval;
+    uint64_t period_ms = sensor_mod_ctx.config->sampling_period_ms;
+    uint64_t ticks;
+    int exponent = info->update_interval_multiplier + 3;
+
+    if (interval_ms == 0) {
+        return 0;
+    }
+
+    for (; (exponent > 0) && (interval_ms <= UINT32_MAX); exponent--) {
+        interval_ms *= 10u;
+    }
+
+    for (; exponent < 0; exponent++) {
+        interval_ms /= 10u;
+    }
+
+    ticks = (interval_ms + period_ms - 1u) / period_ms;
+    if (ticks == 0) {
+        /* Intervals shorter than a millisecond are sampled on every tick */
+        return 1;
+    }
+
+    return (ticks > UINT32_MAX) ? UINT32_MAX : (uint32_t)ticks;
+}
+
+static void sensor_sampling_configure(struct sensor_dev_ctx *ctx)
+{
+    int status;
+    struct mod_sensor_info info;
+
+    ctx->sampling.interval_ticks = 0;
+
+    if ((sensor_mod_ctx.alarm_api == NULL) ||
+        (ctx->sampling.history == NULL) || (ctx->axis_count > 1)) {
+        return;
+    }
+
+    status = ctx->driver_api->get_info(ctx->config->driver_id, &info);
+    if (status != FWK_SUCCESS) {
+        return;
+    }
+
+    ctx->sampling.interval_ticks = sensor_sampling_interval_ticks(&info);
+}
+
+static void sensor_sample(unsigned int sensor_idx)
+{
+    int status;
+    bool sensor_enabled;
+    struct sensor_dev_ctx *ctx = &ctx_table[sensor_idx];
+    fwk_id_t id = fwk_id_build_element_id(fwk_module_id_sensor, sensor_idx);
+
+    if (ctx->sampling.pending || ctx->concurrency_readings.dequeuing) {
+        return;
+    }
+
+    if (ctx->concurrency_readings.pending_requests > 0) {
+        /* Record the result of the reading requested through get_data() */
+        ctx->sampling.pending = true;
+        return;
+    }
+
+    status = is_sensor_enabled(id, &sensor_enabled);
+    if ((status != FWK_SUCCESS) || !sensor_enabled) {
+        return;
+    }
+
+    status = ctx->driver_api->get_value(
+        ctx->config->driver_id, &ctx->last_read.value);
+    ctx->last_read.status = status;
+    if (status == FWK_PENDING) {
+        ctx->sampling.pending = true;
+        return;
+    }
+
+    if (status == FWK_SUCCESS) {
+        sensor_reading_update(id, ctx);
+    }
+
+    sensor_history_push(ctx);
+}
+
+/*
+ * Read the sensors due on this tick. The sensors are visited grouped by
+ * driver, so the sensors of a device due on the same tick are read back to
+ * back.
+ */
+static int sensor_sampling_process(void)
+{
+    unsigned int i, sensor_idx;
+    uint32_t interval_ticks;
+
+    sensor_mod_ctx.sampling_tick++;
+
+    for (i = 0; i < sensor_mod_ctx.sampling_count; i++) {
+        sensor_idx = sensor_mod_ctx.sampling_order[i];
+        interval_ticks = ctx_table[sensor_idx].sampling.interval_ticks;
+
+        if ((interval_ticks != 0) &&
+            ((sensor_mod_ctx.sampling_tick % interval_ticks) == 0)) {
+            sensor_sample(sensor_idx);
+        }
+    }
+
+    return FWK_SUCCESS;
+}
+
+static void sensor_sampling_alarm_callback(uintptr_t param)
+{
+    struct fwk_event_light event = {
+        .id = mod_sensor_event_id_sample,
+        .source_id = fwk_module_id_sensor,
+        .target_id = fwk_module_id_sensor,
+    };
+
+    /* A tick lost because the event queue is full is only a late sample */
+    (void)fwk_put_event(&event);
+}
+
+static bool sensor_sampling_precedes(unsigned int idx_a, unsigned int idx_b)
+{
+    fwk_id_t driver_a = ctx_table[idx_a].config->driver_id;
+    fwk_id_t driver_b = ctx_table[idx_b].config->driver_id;
+
+    if (fwk_id_get_module_idx(driver_a) != fwk_id_get_module_idx(driver_b)) {
+        return fwk_id_get_module_idx(driver_a) <
+            fwk_id_get_module_idx(driver_b);
+    }
+
+    return fwk_id_get_element_idx(driver_a) < fwk_id_get_element_idx(driver_b);
+}
+
+static int sensor_sampling_start(void)
+{
+    unsigned int i, j, element_count;
+    unsigned int *order;
+
+    if (sensor_mod_ctx.alarm_api == NULL) {
+        return FWK_SUCCESS;
+    }
+
+    if (sensor_mod_ctx.config->sampling_period_ms == 0) {
+        return FWK_E_PARAM;
+    }
+
+    element_count =
+        (unsigned int)fwk_module_get_element_count(fwk_module_id_sensor);
+    if (element_count == 0) {
+        return FWK_SUCCESS;
+    }
+
+    order = fwk_mm_calloc(element_count, sizeof(order[0]));
+
+    /* Sort the sampled sensors by driver */
+    for (i = 0; i < element_count; i++) {
+        if (ctx_table[i].sampling.history == NULL) {
+            continue;
+        }
+
+        for (j = sensor_mod_ctx.sampling_count;
+             (j > 0) && sensor_sampling_precedes(i, order[j - 1]);
+             j--) {
+            order[j] = order[j - 1];
+        }
+        order[j] = i;
+        sensor_mod_ctx.sampling_count++;
+    }
+
+    sensor_mod_ctx.sampling_order = order;
+
+    return sensor_mod_ctx.alarm_api->start(
+        sensor_mod_ctx.config->sampling_alarm_id,
+        sensor_mod_ctx.config->sampling_period_ms,
+        MOD_TIMER_ALARM_TYPE_PERIODIC,
+        sensor_sampling_alarm_callback,
+        (uintptr_t)0);
+}
+#endif
+
 /*
  * Module API
  */
@@ -191,17 +762,25 @@ static int get_data(fwk_id_t id, struct mod_sensor_data *data)
         return ctx->last_read.status;
     }
 
-    if (ctx->concurrency_readings.pending_requests == 0) {
+#ifdef BUILD_HAS_SENSOR_CACHE
+    if (sensor_cache_is_enabled(ctx)) {
+        if (sensor_cache_is_fresh(ctx)) {
+            ctx->cache_stats.hit_count++;
+            sensor_data_copy(data, &ctx->last_read);
+            return FWK_SUCCESS;
+        }
+
+        /* Stale readings join the refresh in progress, if any */
+        ctx->cache_stats.miss_count++;
+    }
+#endif
+
+    if (sensor_driver_is_idle(ctx)) {
         status = ctx->driver_api->get_value(
             ctx->config->driver_id, &ctx->last_read.value);
         ctx->last_read.status = status;
         if (status == FWK_SUCCESS) {
-#ifdef BUILD_HAS_SCMI_SENSOR_EVENTS
-            trip_point_process(id, &ctx->last_read);
-#endif
-#ifdef BUILD_HAS_SENSOR_TIMESTAMP
-            ctx->last_read.timestamp = sensor_get_timestamp(id);
-#endif
+            sensor_reading_update(id, ctx);
             sensor_data_copy(data, &ctx->last_read);
 
             return status;
@@ -313,6 +892,12 @@ static int sensor_set_trip_point(
 
     /* Clear the trip point flag */
     ctx->trip_point_ctx[trip_point_idx].above_threshold = false;
+
+#ifdef BUILD_HAS_SCMI_SENSOR_EVENTS
+    trip_point_sort(ctx);
+    ctx->trip_point_band.resync = true;
+#endif
+
     return FWK_SUCCESS;
 }
 
@@ -348,6 +933,9 @@ static int sensor_set_update_interval(
     int time_interval_multiplier)
 {
     struct sensor_dev_ctx *ctx;
+#ifdef BUILD_HAS_SENSOR_SAMPLING
+    int status;
+#endif
 
     if (!fwk_id_is_type(id, FWK_ID_TYPE_ELEMENT)) {
         return FWK_E_PARAM;
@@ -359,8 +947,18 @@ static int sensor_set_update_interval(
         return FWK_E_SUPPORT;
     }
 
+#ifdef BUILD_HAS_SENSOR_SAMPLING
+    status = ctx->driver_api->set_update_interval(
+        id, time_interval, time_interval_multiplier);
+    if (status == FWK_SUCCESS) {
+        sensor_sampling_configure(ctx);
+    }
+
+    return status;
+#else
     return ctx->driver_api->set_update_interval(
         id, time_interval, time_interval_multiplier);
+#endif
 }
 
 static int sensor_get_update_interval(
@@ -392,6 +990,83 @@ static int sensor_get_update_interval(
     return FWK_SUCCESS;
 }
 
+#ifdef BUILD_HAS_SENSOR_SAMPLING
+static int sensor_get_history(
+    fwk_id_t id,
+    struct mod_sensor_sample *samples,
+    unsigned int *count)
+{
+    int status;
+    unsigned int i, sample_idx;
+    uint8_t length;
+    struct sensor_dev_ctx *ctx;
+
+    if (count == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    status = get_ctx_if_valid_call(id, samples, &ctx);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    if (ctx->sampling.history == NULL) {
+        return FWK_E_SUPPORT;
+    }
+
+    length = ctx->config->history_length;
+    if (*count > ctx->sampling.count) {
+        *count = ctx->sampling.count;
+    }
+
+    sample_idx = ctx->sampling.head;
+    for (i = 0; i < *count; i++) {
+        sample_idx = (sample_idx + length - 1u) % length;
+        samples[i] = ctx->sampling.history[sample_idx];
+    }
+
+    return FWK_SUCCESS;
+}
+#endif
+
+#ifdef BUILD_HAS_SCMI_SENSOR_EVENTS
+static int sensor_get_trip_point_stats(
+    fwk_id_t id,
+    struct mod_sensor_trip_point_stats *stats)
+{
+    int status;
+    struct sensor_dev_ctx *ctx;
+
+    status = get_ctx_if_valid_call(id, stats, &ctx);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    *stats = ctx->trip_point_band.stats;
+
+    return FWK_SUCCESS;
+}
+#endif
+
+#ifdef BUILD_HAS_SENSOR_CACHE
+static int sensor_get_cache_stats(
+    fwk_id_t id,
+    struct mod_sensor_cache_stats *stats)
+{
+    int status;
+    struct sensor_dev_ctx *ctx;
+
+    status = get_ctx_if_valid_call(id, stats, &ctx);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    *stats = ctx->cache_stats;
+
+    return FWK_SUCCESS;
+}
+#endif
+
 static struct mod_sensor_api sensor_api = {
     .get_data = get_data,
     .get_info = get_info,
@@ -408,6 +1083,15 @@ static struct mod_sensor_api sensor_api = {
 #ifdef BUILD_HAS_SENSOR_MULTI_AXIS
     .get_axis_info = sensor_get_axis_info,
 #endif
+#ifdef BUILD_HAS_SENSOR_CACHE
+    .get_cache_stats = sensor_get_cache_stats,
+#endif
+#ifdef BUILD_HAS_SENSOR_SAMPLING
+    .get_history = sensor_get_history,
+#endif
+#ifdef BUILD_HAS_SCMI_SENSOR_EVENTS
+    .get_trip_point_stats = sensor_get_trip_point_stats,
+#endif
 };
 
 /*
@@ -433,6 +1117,9 @@ static void reading_complete(fwk_id_t dev_id,
 
     if (response != NULL) {
         ctx->last_read.status = response->status;
+#ifdef BUILD_HAS_SENSOR_CACHE
+        sensor_cache_update(ctx);
+#endif
 
 #ifdef BUILD_HAS_SENSOR_TIMESTAMP
         ctx->last_read.timestamp = sensor_get_timestamp(dev_id);
@@ -450,6 +1137,12 @@ static void reading_complete(fwk_id_t dev_id,
         ctx->last_read.value = response->value;
 #endif
 
+#ifdef BUILD_HAS_SENSOR_FILTER
+        if (response->status == FWK_SUCCESS) {
+            sensor_filter_apply(ctx);
+        }
+#endif
+
 #ifdef BUILD_HAS_SCMI_SENSOR_EVENTS
         trip_point_process(dev_id, &ctx->last_read);
 #endif
@@ -491,6 +1184,9 @@ static int sensor_dev_init(fwk_id_t element_id,
 {
     struct sensor_dev_ctx *ctx;
     struct mod_sensor_dev_config *config;
+#ifdef BUILD_HAS_SCMI_SENSOR_EVENTS
+    uint32_t i;
+#endif
 
     ctx = ctx_table + fwk_id_get_element_idx(element_id);
 
@@ -503,6 +1199,15 @@ static int sensor_dev_init(fwk_id_t element_id,
         ctx->trip_point_ctx = fwk_mm_calloc(
             config->trip_point.count, sizeof(struct sensor_trip_point_ctx));
         ctx->trip_point_ctx->enabled = true;
+
+#ifdef BUILD_HAS_SCMI_SENSOR_EVENTS
+        /* All the trip points start at zero, so are already sorted */
+        ctx->trip_point_band.order = fwk_mm_calloc(
+            config->trip_point.count, sizeof(ctx->trip_point_band.order[0]));
+        for (i = 0; i < config->trip_point.count; i++) {
+            ctx->trip_point_band.order[i] = i;
+        }
+#endif
     } else {
         ctx->trip_point_ctx = NULL;
     }
@@ -510,6 +1215,34 @@ static int sensor_dev_init(fwk_id_t element_id,
     /* Pre-init last read with an invalid status */
     ctx->last_read.status = FWK_E_DEVICE;
 
+#ifdef BUILD_HAS_SENSOR_SAMPLING
+    if (config->history_length > 0) {
+        ctx->sampling.history = fwk_mm_calloc(
+            config->history_length, sizeof(ctx->sampling.history[0]));
+    }
+#endif
+
+#ifdef BUILD_HAS_SENSOR_FILTER
+    if (config->filter.ema_shift > MOD_SENSOR_FILTER_EMA_SHIFT_MAX) {
+        return FWK_E_PARAM;
+    }
+
+    if ((config->filter.type == MOD_SENSOR_FILTER_MOVING_AVERAGE) ||
+        (config->filter.type == MOD_SENSOR_FILTER_MEDIAN)) {
+        if (config->filter.window_length == 0) {
+            return FWK_E_PARAM;
+        }
+
+        ctx->filter.window = fwk_mm_calloc(
+            config->filter.window_length, sizeof(ctx->filter.window[0]));
+    }
+
+    if (config->filter.type == MOD_SENSOR_FILTER_MEDIAN) {
+        ctx->filter.sorted = fwk_mm_calloc(
+            config->filter.window_length, sizeof(ctx->filter.sorted[0]));
+    }
+#endif
+
 #ifndef BUILD_HAS_SENSOR_MULTI_AXIS
     ctx->axis_count = 1;
 #endif
@@ -537,6 +1270,21 @@ static int sensor_bind(fwk_id_t id, unsigned int round)
             return FWK_SUCCESS;
         }
 
+#ifdef BUILD_HAS_SENSOR_SAMPLING
+        if (fwk_optional_id_is_defined(
+                sensor_mod_ctx.config->sampling_alarm_id) &&
+            !fwk_id_is_equal(
+                sensor_mod_ctx.config->sampling_alarm_id, FWK_ID_NONE)) {
+            status = fwk_module_bind(
+                sensor_mod_ctx.config->sampling_alarm_id,
+                MOD_TIMER_API_ID_ALARM,
+                &sensor_mod_ctx.alarm_api);
+            if (status != FWK_SUCCESS) {
+                return status;
+            }
+        }
+#endif
+
 #ifdef BUILD_HAS_NOTIFICATION
         if (fwk_id_is_equal(
                 sensor_mod_ctx.config->notification_id, FWK_ID_NONE)) {
@@ -570,18 +1318,29 @@ static int sensor_bind(fwk_id_t id, unsigned int round)
     return FWK_SUCCESS;
 }
 
-#ifdef BUILD_HAS_SENSOR_MULTI_AXIS
+#if defined(BUILD_HAS_SENSOR_MULTI_AXIS) || defined(BUILD_HAS_SENSOR_SAMPLING)
 int sensor_start(fwk_id_t id)
 {
+#    ifdef BUILD_HAS_SENSOR_MULTI_AXIS
     int status;
+#    endif
 
     if (fwk_id_is_type(id, FWK_ID_TYPE_MODULE)) {
+#    ifdef BUILD_HAS_SENSOR_SAMPLING
+        return sensor_sampling_start();
+#    else
         return FWK_SUCCESS;
+#    endif
     }
+#    ifdef BUILD_HAS_SENSOR_MULTI_AXIS
     status = sensor_axis_start(id);
     if (status != FWK_SUCCESS) {
         return status;
     }
+#    endif
+#    ifdef BUILD_HAS_SENSOR_SAMPLING
+    sensor_sampling_configure(sensor_get_ctx(id));
+#    endif
 
     return FWK_SUCCESS;
 }
@@ -680,6 +1439,12 @@ static int sensor_process_event(const struct fwk_event *event,
         (struct mod_sensor_event_params *)read_req_event.params;
     enum mod_sensor_event_idx event_id_type;
 
+#ifdef BUILD_HAS_SENSOR_SAMPLING
+    if (fwk_id_is_equal(event->id, mod_sensor_event_id_sample)) {
+        return sensor_sampling_process();
+    }
+#endif
+
     if (!fwk_module_is_valid_element_id(event->target_id)) {
         return FWK_E_PARAM;
     }
@@ -702,6 +1467,18 @@ static int sensor_process_event(const struct fwk_event *event,
         return FWK_SUCCESS;
 
     case SENSOR_EVENT_IDX_READ_COMPLETE:
+#ifdef BUILD_HAS_SENSOR_SAMPLING
+        if (ctx->sampling.pending) {
+            ctx->sampling.pending = false;
+            sensor_history_push(ctx);
+
+            if (ctx->concurrency_readings.pending_requests == 0) {
+                /* The reading was started by the background sampling */
+                ctx->concurrency_readings.dequeuing = false;
+                return FWK_SUCCESS;
+            }
+        }
+#endif
         status = fwk_get_delayed_response(
             event->target_id, ctx->cookie, &read_req_event);
         if (status != FWK_SUCCESS) {
@@ -737,7 +1514,7 @@ const struct fwk_module module_sensor = {
     .init = sensor_init,
     .element_init = sensor_dev_init,
     .bind = sensor_bind,
-#ifdef BUILD_HAS_SENSOR_MULTI_AXIS
+#if defined(BUILD_HAS_SENSOR_MULTI_AXIS) || defined(BUILD_HAS_SENSOR_SAMPLING)
     .start = sensor_start,
 #endif
     .process_bind_request = sensor_process_bind_request,
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2019-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2019-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -11,6 +11,12 @@
 #include <mod_sensor.h>
 
 #include <fwk_id.h>
+#if defined(BUILD_HAS_SENSOR_CACHE) || defined(BUILD_HAS_SENSOR_SAMPLING)
+#    include <fwk_time.h>
+#endif
+#ifdef BUILD_HAS_SENSOR_SAMPLING
+#    include <mod_timer.h>
+#endif
 
 #include <stdint.h>
 
@@ -37,6 +43,86 @@ struct sensor_trip_point_ctx {
     bool enabled;
 };
 
+#ifdef BUILD_HAS_SCMI_SENSOR_EVENTS
+/*
+ * Sensor trip point evaluation context
+ */
+struct sensor_trip_point_band_ctx {
+    /* Trip point indices, sorted by increasing trip point value */
+    uint32_t *order;
+
+    /*
+     * Current band: the trip points order[0] to order[band - 1] are those the
+     * value is above.
+     */
+    uint32_t band;
+
+    /* Band of the last reading, without the hysteresis */
+    uint32_t raw_band;
+
+    /* Band the value is moving to, while debouncing */
+    uint32_t pending_band;
+
+    /* Number of consecutive readings which agreed on pending_band */
+    uint32_t pending_count;
+
+    /* Trip points were changed, the band must be recomputed */
+    bool resync;
+
+    struct mod_sensor_trip_point_stats stats;
+};
+#endif
+
+#ifdef BUILD_HAS_SENSOR_FILTER
+/*
+ * Sensor reading filter context
+ */
+struct sensor_filter_ctx {
+    /* Last readings, for the moving average and median filters */
+    mod_sensor_value_t *window;
+
+    /* Same readings sorted by value, for the median filter */
+    mod_sensor_value_t *sorted;
+
+    /*
+     * Sum of the window for the moving average filter, or filtered value
+     * scaled by 2^ema_shift for the exponential moving average filter.
+     */
+    mod_sensor_value_t accumulator;
+
+    /* Last filtered value */
+    mod_sensor_value_t value;
+
+    /* Index of the oldest reading of the window */
+    uint8_t head;
+
+    /* Number of readings in the window, or non-zero once primed */
+    uint8_t count;
+};
+#endif
+
+#ifdef BUILD_HAS_SENSOR_SAMPLING
+/*
+ * Sensor background sampling context
+ */
+struct sensor_sampling_ctx {
+    /* Sampling interval, in ticks, zero when the sensor is not sampled */
+    uint32_t interval_ticks;
+
+    /* A reading whose result is to be recorded is pending on the driver */
+    bool pending;
+
+    /* History ring of the samples */
+    struct mod_sensor_sample *history;
+
+    /* Index of the next sample to write */
+    uint8_t head;
+
+    /* Number of samples in the history */
+    uint8_t count;
+};
+#endif
+
 /*
  * Sensor element context
  */
@@ -46,6 +132,9 @@ struct sensor_dev_ctx {
     struct mod_sensor_driver_api *driver_api;
 
     struct sensor_trip_point_ctx *trip_point_ctx;
+#ifdef BUILD_HAS_SCMI_SENSOR_EVENTS
+    struct sensor_trip_point_band_ctx trip_point_band;
+#endif
     uint32_t cookie;
 
     struct {
@@ -55,6 +144,21 @@ struct sensor_dev_ctx {
 
     struct mod_sensor_data last_read;
 
+#ifdef BUILD_HAS_SENSOR_CACHE
+    /* Time of the last reading, when the cache is enabled */
+    fwk_timestamp_t last_read_time;
+
+    struct mod_sensor_cache_stats cache_stats;
+#endif
+
+#ifdef BUILD_HAS_SENSOR_SAMPLING
+    struct sensor_sampling_ctx sampling;
+#endif
+
+#ifdef BUILD_HAS_SENSOR_FILTER
+    struct sensor_filter_ctx filter;
+#endif
+
     unsigned int axis_count;
 
 #ifdef BUILD_HAS_SENSOR_TIMESTAMP
@@ -71,6 +175,19 @@ struct sensor_dev_ctx {
 struct mod_sensor_ctx {
     struct mod_sensor_config *config;
     struct mod_sensor_trip_point_api *sensor_trip_point_api;
+
+#ifdef BUILD_HAS_SENSOR_SAMPLING
+    const struct mod_timer_alarm_api *alarm_api;
+
+    /* Indices of the sampled sensors, grouped by driver */
+    unsigned int *sampling_order;
+
+    /* Number of entries in sampling_order */
+    unsigned int sampling_count;
+
+    /* Number of sampling ticks since the sampling started */
+    uint32_t sampling_tick;
+#endif
 };
 
 struct sensor_dev_ctx *sensor_get_ctx(fwk_id_t id);
@@ -81,6 +198,9 @@ struct sensor_dev_ctx *sensor_get_ctx(fwk_id_t id);
 enum mod_sensor_event_idx {
     SENSOR_EVENT_IDX_READ_REQUEST = MOD_SENSOR_EVENT_IDX_READ_REQUEST,
     SENSOR_EVENT_IDX_READ_COMPLETE,
+#ifdef BUILD_HAS_SENSOR_SAMPLING
+    SENSOR_EVENT_IDX_SAMPLE,
+#endif
     SENSOR_EVENT_IDX_COUNT
 };
 
@@ -91,6 +211,11 @@ static const fwk_id_t mod_sensor_event_id_read_complete =
     FWK_ID_EVENT_INIT(FWK_MODULE_IDX_SENSOR,
                       SENSOR_EVENT_IDX_READ_COMPLETE);
 
+#ifdef BUILD_HAS_SENSOR_SAMPLING
+static const fwk_id_t mod_sensor_event_id_sample =
+    FWK_ID_EVENT_INIT(FWK_MODULE_IDX_SENSOR, SENSOR_EVENT_IDX_SAMPLE);
+#endif
+
 #ifdef BUILD_HAS_SENSOR_TIMESTAMP
 
 int sensor_timestamp_dev_init(fwk_id_t id, struct sensor_dev_ctx *ctx);
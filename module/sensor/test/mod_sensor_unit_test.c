@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2024-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -13,6 +13,9 @@
 #include <Mockfwk_mm.h>
 #include <Mockfwk_module.h>
 #include <Mockfwk_string.h>
+#ifdef BUILD_HAS_SENSOR_CACHE
+#    include <Mockfwk_time.h>
+#endif
 #include <internal/Mockfwk_core_internal.h>
 
 #include <fwk_assert.h>
@@ -1172,6 +1175,133 @@ void utest_sensor_set_time_interval_valid_func_ptr_ret_error(void)
     TEST_ASSERT_EQUAL(status, FWK_E_PARAM);
 }
 
+#ifdef BUILD_HAS_SENSOR_CACHE
+#    define CACHE_MAX_AGE_US 1000
+
+static unsigned int cache_get_value_count;
+
+static int sensor_driver_get_value_counted(
+    fwk_id_t id,
+    mod_sensor_value_t *value)
+{
+    cache_get_value_count++;
+    *value = FAKE_RETURN_VALUE + cache_get_value_count;
+
+    return FWK_SUCCESS;
+}
+
+static struct mod_sensor_driver_api sensor_driver_api_cached = {
+    .get_value = sensor_driver_get_value_counted,
+    .get_info = sensor_driver_get_info_enabled,
+};
+
+static struct mod_sensor_dev_config sensor_dev_config_cached = {
+    .driver_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_REG_SENSOR, 0),
+    .driver_api_id = FWK_ID_API_INIT(FWK_MODULE_IDX_REG_SENSOR, 0),
+    .cache_max_age_us = CACHE_MAX_AGE_US,
+};
+
+static fwk_duration_ns_t time_elapsed_callback(
+    fwk_timestamp_t start,
+    fwk_timestamp_t end,
+    int NumCalls)
+{
+    return (end > start) ? (end - start) : 0;
+}
+
+static int cache_get_data(fwk_id_t elem_id, struct mod_sensor_data *data)
+{
+    fwk_id_is_type_ExpectAndReturn(elem_id, FWK_ID_TYPE_ELEMENT, true);
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id, SENSOR_FAKE_INDEX_0);
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id, SENSOR_FAKE_INDEX_0);
+
+    return get_data(elem_id, data);
+}
+
+void utest_sensor_get_data_cache_hit(void)
+{
+    int status;
+    struct mod_sensor_data returned_data = { 0 };
+    struct mod_sensor_cache_stats stats;
+
+    fwk_id_t elem_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, SENSOR_FAKE_INDEX_0);
+
+    ctx_table[SENSOR_FAKE_INDEX_0].config = &sensor_dev_config_cached;
+    ctx_table[SENSOR_FAKE_INDEX_0].driver_api = &sensor_driver_api_cached;
+    ctx_table[SENSOR_FAKE_INDEX_0].last_read.status = FWK_E_DEVICE;
+    cache_get_value_count = 0;
+
+    fwk_str_memcpy_StubWithCallback(memcpy_callback);
+    fwk_time_elapsed_StubWithCallback(time_elapsed_callback);
+
+    /* The first reading fills the cache */
+    fwk_time_current_ExpectAndReturn(FWK_US(5));
+    status = cache_get_data(elem_id, &returned_data);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(FAKE_RETURN_VALUE + 1, returned_data.value);
+
+    /* A reading requested at the same time is served from the cache */
+    memset(&returned_data, 0, sizeof(returned_data));
+    fwk_time_current_ExpectAndReturn(FWK_US(5));
+    status = cache_get_data(elem_id, &returned_data);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(FAKE_RETURN_VALUE + 1, returned_data.value);
+
+    /* Served from the cache until the reading is older than the maximum */
+    memset(&returned_data, 0, sizeof(returned_data));
+    fwk_time_current_ExpectAndReturn(FWK_US(CACHE_MAX_AGE_US + 5));
+    status = cache_get_data(elem_id, &returned_data);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(FAKE_RETURN_VALUE + 1, returned_data.value);
+    TEST_ASSERT_EQUAL(1, cache_get_value_count);
+
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id, SENSOR_FAKE_INDEX_0);
+    status = sensor_get_cache_stats(elem_id, &stats);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(2, stats.hit_count);
+    TEST_ASSERT_EQUAL(1, stats.miss_count);
+
+    fwk_time_elapsed_Stub(NULL);
+}
+
+void utest_sensor_get_data_cache_stale(void)
+{
+    int status;
+    struct mod_sensor_data returned_data = { 0 };
+
+    fwk_id_t elem_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, SENSOR_FAKE_INDEX_0);
+
+    ctx_table[SENSOR_FAKE_INDEX_0].config = &sensor_dev_config_cached;
+    ctx_table[SENSOR_FAKE_INDEX_0].driver_api = &sensor_driver_api_cached;
+    ctx_table[SENSOR_FAKE_INDEX_0].last_read.status = FWK_SUCCESS;
+    ctx_table[SENSOR_FAKE_INDEX_0].last_read.value = FAKE_RETURN_VALUE;
+    ctx_table[SENSOR_FAKE_INDEX_0].last_read_time = FWK_US(5);
+    cache_get_value_count = 0;
+
+    fwk_str_memcpy_StubWithCallback(memcpy_callback);
+    fwk_time_elapsed_StubWithCallback(time_elapsed_callback);
+
+    /* A stale reading is refreshed by the driver */
+    fwk_time_current_ExpectAndReturn(FWK_US(CACHE_MAX_AGE_US + 6));
+    fwk_time_current_ExpectAndReturn(FWK_US(CACHE_MAX_AGE_US + 6));
+    status = cache_get_data(elem_id, &returned_data);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(FAKE_RETURN_VALUE + 1, returned_data.value);
+    TEST_ASSERT_EQUAL(1, cache_get_value_count);
+    TEST_ASSERT_EQUAL(
+        FWK_US(CACHE_MAX_AGE_US + 6),
+        ctx_table[SENSOR_FAKE_INDEX_0].last_read_time);
+    TEST_ASSERT_EQUAL(
+        0, ctx_table[SENSOR_FAKE_INDEX_0].cache_stats.hit_count);
+    TEST_ASSERT_EQUAL(
+        1, ctx_table[SENSOR_FAKE_INDEX_0].cache_stats.miss_count);
+
+    fwk_time_elapsed_Stub(NULL);
+}
+#endif
+
 int sensor_test_main(void)
 {
     UNITY_BEGIN();
@@ -1201,6 +1331,10 @@ int sensor_test_main(void)
     RUN_TEST(utest_sensor_get_data_sensor_disabled);
     RUN_TEST(utest_sensor_get_data_valid_dequeue);
     RUN_TEST(utest_sensor_get_data_valid_call_zero_pending_requests);
+#ifdef BUILD_HAS_SENSOR_CACHE
+    RUN_TEST(utest_sensor_get_data_cache_hit);
+    RUN_TEST(utest_sensor_get_data_cache_stale);
+#endif
 
     RUN_TEST(utest_sensor_get_info_get_ctx_if_valid_call_returns_error);
     RUN_TEST(utest_sensor_get_info_driver_api_get_info_returns_error);
@@ -0,0 +1,165 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_core.h>
+#include <Mockfwk_id.h>
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+#include <Mockfwk_string.h>
+#include <internal/Mockfwk_core_internal.h>
+
+#include <fwk_element.h>
+#include <fwk_id.h>
+#include <fwk_module_idx.h>
+#include <fwk_status.h>
+
+#include UNIT_TEST_SRC
+
+#define WINDOW_LENGTH 3
+
+static struct sensor_dev_ctx sensor_dev_context;
+static struct mod_sensor_dev_config sensor_dev_config;
+
+static mod_sensor_value_t window[WINDOW_LENGTH];
+static mod_sensor_value_t sorted[WINDOW_LENGTH];
+
+static mod_sensor_value_t filter(mod_sensor_value_t value)
+{
+    sensor_dev_context.last_read.value = value;
+    sensor_filter_apply(&sensor_dev_context);
+
+    TEST_ASSERT_EQUAL(value, sensor_dev_context.last_read.raw_value);
+
+    return sensor_dev_context.last_read.value;
+}
+
+void setUp(void)
+{
+    ctx_table = &sensor_dev_context;
+    memset(&sensor_dev_context, 0, sizeof(sensor_dev_context));
+    memset(&sensor_dev_config, 0, sizeof(sensor_dev_config));
+
+    sensor_dev_context.config = &sensor_dev_config;
+    sensor_dev_context.axis_count = 1;
+    sensor_dev_context.filter.window = window;
+    sensor_dev_context.filter.sorted = sorted;
+}
+
+void tearDown(void)
+{
+}
+
+void utest_sensor_filter_none(void)
+{
+    TEST_ASSERT_EQUAL(10, filter(10));
+    TEST_ASSERT_EQUAL(1000, filter(1000));
+}
+
+void utest_sensor_filter_ema(void)
+{
+    sensor_dev_config.filter.type = MOD_SENSOR_FILTER_EMA;
+    sensor_dev_config.filter.ema_shift = 2;
+
+    /* The first reading primes the filter */
+    TEST_ASSERT_EQUAL(100, filter(100));
+
+    /* Each step covers a quarter of the remaining distance */
+    TEST_ASSERT_EQUAL(125, filter(200));
+    TEST_ASSERT_EQUAL(143, filter(200));
+    TEST_ASSERT_EQUAL(126, filter(72));
+}
+
+void utest_sensor_filter_moving_average(void)
+{
+    sensor_dev_config.filter.type = MOD_SENSOR_FILTER_MOVING_AVERAGE;
+    sensor_dev_config.filter.window_length = WINDOW_LENGTH;
+
+    TEST_ASSERT_EQUAL(30, filter(30));
+    TEST_ASSERT_EQUAL(45, filter(60));
+    TEST_ASSERT_EQUAL(50, filter(60));
+
+    /* The oldest reading leaves the window */
+    TEST_ASSERT_EQUAL(70, filter(90));
+    TEST_ASSERT_EQUAL(60, filter(30));
+}
+
+void utest_sensor_filter_median(void)
+{
+    sensor_dev_config.filter.type = MOD_SENSOR_FILTER_MEDIAN;
+    sensor_dev_config.filter.window_length = WINDOW_LENGTH;
+
+    TEST_ASSERT_EQUAL(40, filter(40));
+    TEST_ASSERT_EQUAL(45, filter(50));
+
+    /* A single spike is rejected */
+    TEST_ASSERT_EQUAL(50, filter(1000));
+    TEST_ASSERT_EQUAL(60, filter(60));
+    TEST_ASSERT_EQUAL(60, filter(55));
+    TEST_ASSERT_EQUAL(55, filter(20));
+}
+
+void utest_sensor_filter_clamp(void)
+{
+    sensor_dev_config.filter.max_step = 10;
+
+    TEST_ASSERT_EQUAL(100, filter(100));
+    TEST_ASSERT_EQUAL(110, filter(500));
+    TEST_ASSERT_EQUAL(115, filter(115));
+    TEST_ASSERT_EQUAL(105, filter(0));
+}
+
+void utest_sensor_filter_dev_init_no_window(void)
+{
+    int status;
+    fwk_id_t elem_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, 0);
+
+    sensor_dev_config.filter.type = MOD_SENSOR_FILTER_MEDIAN;
+
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id, 0);
+
+    status = sensor_dev_init(elem_id, 0, &sensor_dev_config);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+void utest_sensor_filter_dev_init_ema_shift(void)
+{
+    int status;
+    fwk_id_t elem_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, 0);
+
+    sensor_dev_config.filter.type = MOD_SENSOR_FILTER_EMA;
+    sensor_dev_config.filter.ema_shift = MOD_SENSOR_FILTER_EMA_SHIFT_MAX + 1;
+
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id, 0);
+
+    status = sensor_dev_init(elem_id, 0, &sensor_dev_config);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+int sensor_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(utest_sensor_filter_none);
+    RUN_TEST(utest_sensor_filter_ema);
+    RUN_TEST(utest_sensor_filter_moving_average);
+    RUN_TEST(utest_sensor_filter_median);
+    RUN_TEST(utest_sensor_filter_clamp);
+    RUN_TEST(utest_sensor_filter_dev_init_no_window);
+    RUN_TEST(utest_sensor_filter_dev_init_ema_shift);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return sensor_test_main();
+}
+#endif
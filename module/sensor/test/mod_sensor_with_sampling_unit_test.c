@@ -0,0 +1,365 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_core.h>
+#include <Mockfwk_id.h>
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+#include <Mockfwk_string.h>
+#include <Mockfwk_time.h>
+#include <internal/Mockfwk_core_internal.h>
+
+#include <fwk_element.h>
+#include <fwk_id.h>
+#include <fwk_module_idx.h>
+#include <fwk_status.h>
+
+#include UNIT_TEST_SRC
+
+#define SAMPLING_SENSOR_COUNT 3
+#define SAMPLING_PERIOD_MS    10
+#define HISTORY_LENGTH        2
+#define FAKE_TIMESTAMP        0x1234
+
+enum {
+    SENSOR_FAKE_INDEX_0,
+    SENSOR_FAKE_INDEX_1,
+    SENSOR_FAKE_INDEX_2,
+};
+
+static struct sensor_dev_ctx sensor_dev_context[SAMPLING_SENSOR_COUNT];
+
+static struct mod_sensor_sample history_table[SAMPLING_SENSOR_COUNT]
+                                             [HISTORY_LENGTH];
+
+static unsigned int sampling_order_table[SAMPLING_SENSOR_COUNT];
+
+/* Sensors 0 and 2 share a driver element, sensor 1 is on another driver */
+static struct mod_sensor_dev_config sensor_dev_config_table[] = {
+    [SENSOR_FAKE_INDEX_0] = {
+        .driver_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_FAKE_MODULE, 0),
+        .history_length = HISTORY_LENGTH,
+    },
+    [SENSOR_FAKE_INDEX_1] = {
+        .driver_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_REG_SENSOR, 0),
+        .history_length = HISTORY_LENGTH,
+    },
+    [SENSOR_FAKE_INDEX_2] = {
+        .driver_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_FAKE_MODULE, 0),
+        .history_length = HISTORY_LENGTH,
+    },
+};
+
+static struct mod_sensor_config sensor_config = {
+    .sampling_alarm_id = FWK_ID_SUB_ELEMENT_INIT(FWK_MODULE_IDX_TIMER, 0, 0),
+    .sampling_period_ms = SAMPLING_PERIOD_MS,
+};
+
+static unsigned int get_value_count[SAMPLING_SENSOR_COUNT];
+static int get_value_status;
+static unsigned int update_interval_ms;
+
+static unsigned int alarm_milliseconds;
+static enum mod_timer_alarm_type alarm_type;
+
+static unsigned int sensor_driver_idx(fwk_id_t id)
+{
+    return (id.common.module_idx == FWK_MODULE_IDX_REG_SENSOR) ?
+        SENSOR_FAKE_INDEX_1 :
+        SENSOR_FAKE_INDEX_0;
+}
+
+static int sensor_driver_get_value(fwk_id_t id, mod_sensor_value_t *value)
+{
+    get_value_count[sensor_driver_idx(id)]++;
+    *value = get_value_count[sensor_driver_idx(id)];
+
+    return get_value_status;
+}
+
+static int sensor_driver_get_info(fwk_id_t id, struct mod_sensor_info *info)
+{
+    *info = (struct mod_sensor_info){
+        .update_interval = update_interval_ms,
+        .update_interval_multiplier = -3,
+    };
+
+    return FWK_SUCCESS;
+}
+
+static struct mod_sensor_driver_api sensor_driver_api = {
+    .get_value = sensor_driver_get_value,
+    .get_info = sensor_driver_get_info,
+};
+
+static int alarm_start(
+    fwk_id_t alarm_id,
+    unsigned int milliseconds,
+    enum mod_timer_alarm_type type,
+    void (*callback)(uintptr_t param),
+    uintptr_t param)
+{
+    alarm_milliseconds = milliseconds;
+    alarm_type = type;
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_timer_alarm_api alarm_api = {
+    .start = alarm_start,
+};
+
+static unsigned int get_module_idx_callback(fwk_id_t id, int NumCalls)
+{
+    return id.common.module_idx;
+}
+
+static unsigned int get_element_idx_callback(fwk_id_t id, int NumCalls)
+{
+    return id.element.element_idx;
+}
+
+static fwk_id_t build_element_id_callback(
+    fwk_id_t id,
+    unsigned int element_idx,
+    int NumCalls)
+{
+    return FWK_ID_ELEMENT(id.common.module_idx, element_idx);
+}
+
+void setUp(void)
+{
+    unsigned int i;
+
+    ctx_table = sensor_dev_context;
+    memset(sensor_dev_context, 0, sizeof(sensor_dev_context));
+    memset(get_value_count, 0, sizeof(get_value_count));
+
+    for (i = 0; i < SAMPLING_SENSOR_COUNT; i++) {
+        sensor_dev_context[i].config = &sensor_dev_config_table[i];
+        sensor_dev_context[i].driver_api = &sensor_driver_api;
+        sensor_dev_context[i].axis_count = 1;
+        sensor_dev_context[i].sampling.history = history_table[i];
+    }
+
+    memset(&sensor_mod_ctx, 0, sizeof(sensor_mod_ctx));
+    sensor_mod_ctx.config = &sensor_config;
+    sensor_mod_ctx.alarm_api = &alarm_api;
+
+    get_value_status = FWK_SUCCESS;
+    update_interval_ms = SAMPLING_PERIOD_MS;
+
+    fwk_id_get_module_idx_StubWithCallback(get_module_idx_callback);
+    fwk_id_get_element_idx_StubWithCallback(get_element_idx_callback);
+    fwk_id_build_element_id_StubWithCallback(build_element_id_callback);
+    fwk_id_is_type_IgnoreAndReturn(true);
+    fwk_time_current_IgnoreAndReturn(FAKE_TIMESTAMP);
+}
+
+void tearDown(void)
+{
+}
+
+void utest_sensor_sampling_interval_ticks(void)
+{
+    struct mod_sensor_info info = {
+        .update_interval = 5,
+        .update_interval_multiplier = -2,
+    };
+
+    /* 50ms */
+    TEST_ASSERT_EQUAL(5, sensor_sampling_interval_ticks(&info));
+
+    /* 1s */
+    info.update_interval = 1;
+    info.update_interval_multiplier = 0;
+    TEST_ASSERT_EQUAL(100, sensor_sampling_interval_ticks(&info));
+
+    /* 15ms, rounded up */
+    info.update_interval = 15;
+    info.update_interval_multiplier = -3;
+    TEST_ASSERT_EQUAL(2, sensor_sampling_interval_ticks(&info));
+
+    /* 1us */
+    info.update_interval = 1;
+    info.update_interval_multiplier = -6;
+    TEST_ASSERT_EQUAL(1, sensor_sampling_interval_ticks(&info));
+
+    /* Too long to count */
+    info.update_interval = UINT32_MAX;
+    info.update_interval_multiplier = 30;
+    TEST_ASSERT_EQUAL(UINT32_MAX, sensor_sampling_interval_ticks(&info));
+
+    info.update_interval = 0;
+    TEST_ASSERT_EQUAL(0, sensor_sampling_interval_ticks(&info));
+}
+
+void utest_sensor_sampling_start_groups_by_driver(void)
+{
+    int status;
+
+    fwk_module_get_element_count_ExpectAndReturn(
+        fwk_module_id_sensor, SAMPLING_SENSOR_COUNT);
+    fwk_mm_calloc_ExpectAndReturn(
+        SAMPLING_SENSOR_COUNT,
+        sizeof(unsigned int),
+        sampling_order_table);
+
+    status = sensor_start(fwk_module_id_sensor);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(SAMPLING_SENSOR_COUNT, sensor_mod_ctx.sampling_count);
+    TEST_ASSERT_EQUAL(SENSOR_FAKE_INDEX_1, sampling_order_table[0]);
+    TEST_ASSERT_EQUAL(SENSOR_FAKE_INDEX_0, sampling_order_table[1]);
+    TEST_ASSERT_EQUAL(SENSOR_FAKE_INDEX_2, sampling_order_table[2]);
+    TEST_ASSERT_EQUAL(SAMPLING_PERIOD_MS, alarm_milliseconds);
+    TEST_ASSERT_EQUAL(MOD_TIMER_ALARM_TYPE_PERIODIC, alarm_type);
+}
+
+void utest_sensor_sampling_process_due_sensors(void)
+{
+    int status;
+    unsigned int tick;
+    struct mod_sensor_sample samples[HISTORY_LENGTH + 1];
+    unsigned int count = HISTORY_LENGTH + 1;
+    fwk_id_t elem_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, SENSOR_FAKE_INDEX_0);
+
+    /* Sensor 0 is sampled on every tick, sensor 1 every other tick */
+    sensor_dev_context[SENSOR_FAKE_INDEX_0].sampling.interval_ticks = 1;
+    sensor_dev_context[SENSOR_FAKE_INDEX_1].sampling.interval_ticks = 2;
+    sampling_order_table[0] = SENSOR_FAKE_INDEX_0;
+    sampling_order_table[1] = SENSOR_FAKE_INDEX_1;
+    sensor_mod_ctx.sampling_order = sampling_order_table;
+    sensor_mod_ctx.sampling_count = 2;
+
+    for (tick = 0; tick < 3; tick++) {
+        status = sensor_sampling_process();
+        TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    }
+
+    TEST_ASSERT_EQUAL(3, get_value_count[SENSOR_FAKE_INDEX_0]);
+    TEST_ASSERT_EQUAL(1, get_value_count[SENSOR_FAKE_INDEX_1]);
+    TEST_ASSERT_EQUAL(
+        HISTORY_LENGTH, sensor_dev_context[SENSOR_FAKE_INDEX_0].sampling.count);
+    TEST_ASSERT_EQUAL(
+        1, sensor_dev_context[SENSOR_FAKE_INDEX_1].sampling.count);
+    TEST_ASSERT_EQUAL(
+        3, sensor_dev_context[SENSOR_FAKE_INDEX_0].last_read.value);
+
+    /* The history holds the most recent samples, most recent first */
+    status = sensor_get_history(elem_id, samples, &count);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(HISTORY_LENGTH, count);
+    TEST_ASSERT_EQUAL(3, samples[0].value);
+    TEST_ASSERT_EQUAL(2, samples[1].value);
+    TEST_ASSERT_EQUAL(FAKE_TIMESTAMP, samples[0].timestamp);
+}
+
+void utest_sensor_sampling_pending_read_complete(void)
+{
+    int status;
+    struct fwk_event event = {
+        .id = FWK_ID_EVENT_INIT(
+            FWK_MODULE_IDX_SENSOR, SENSOR_EVENT_IDX_READ_COMPLETE),
+        .target_id =
+            FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_SENSOR, SENSOR_FAKE_INDEX_0),
+    };
+    struct sensor_dev_ctx *ctx = &sensor_dev_context[SENSOR_FAKE_INDEX_0];
+
+    ctx->sampling.interval_ticks = 1;
+    sampling_order_table[0] = SENSOR_FAKE_INDEX_0;
+    sensor_mod_ctx.sampling_order = sampling_order_table;
+    sensor_mod_ctx.sampling_count = 1;
+
+    /* The driver defers the reading */
+    get_value_status = FWK_PENDING;
+    status = sensor_sampling_process();
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_TRUE(ctx->sampling.pending);
+    TEST_ASSERT_EQUAL(0, ctx->sampling.count);
+
+    /* No new reading is started while the previous one is pending */
+    status = sensor_sampling_process();
+    TEST_ASSERT_EQUAL(1, get_value_count[SENSOR_FAKE_INDEX_0]);
+
+    /* The reading completes, with no get_data() request waiting for it */
+    ctx->last_read.status = FWK_SUCCESS;
+    ctx->last_read.value = 42;
+    ctx->concurrency_readings.dequeuing = true;
+
+    fwk_id_is_equal_ExpectAnyArgsAndReturn(false);
+    fwk_module_is_valid_element_id_ExpectAnyArgsAndReturn(true);
+    fwk_id_get_event_idx_ExpectAnyArgsAndReturn(
+        SENSOR_EVENT_IDX_READ_COMPLETE);
+
+    status = sensor_process_event(&event, NULL);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_FALSE(ctx->sampling.pending);
+    TEST_ASSERT_FALSE(ctx->concurrency_readings.dequeuing);
+    TEST_ASSERT_EQUAL(1, ctx->sampling.count);
+    TEST_ASSERT_EQUAL(42, history_table[SENSOR_FAKE_INDEX_0][0].value);
+}
+
+/*
+ * Test that the module only binds to the alarm when its identifier is defined,
+ * so that a zero-initialised configuration disables the background sampling
+ */
+void utest_sensor_sampling_bind_alarm(void)
+{
+    struct mod_sensor_config config = { 0 };
+    int status;
+
+    sensor_mod_ctx.config = &config;
+    sensor_mod_ctx.alarm_api = NULL;
+
+    fwk_optional_id_is_defined_ExpectAndReturn(config.sampling_alarm_id, false);
+    status = sensor_bind(fwk_module_id_sensor, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    config.sampling_alarm_id = FWK_ID_NONE;
+    fwk_optional_id_is_defined_ExpectAndReturn(config.sampling_alarm_id, true);
+    fwk_id_is_equal_ExpectAndReturn(
+        config.sampling_alarm_id, FWK_ID_NONE, true);
+    status = sensor_bind(fwk_module_id_sensor, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    config.sampling_alarm_id = sensor_config.sampling_alarm_id;
+    fwk_optional_id_is_defined_ExpectAndReturn(config.sampling_alarm_id, true);
+    fwk_id_is_equal_ExpectAndReturn(
+        config.sampling_alarm_id, FWK_ID_NONE, false);
+    fwk_module_bind_ExpectAndReturn(
+        config.sampling_alarm_id,
+        MOD_TIMER_API_ID_ALARM,
+        &sensor_mod_ctx.alarm_api,
+        FWK_SUCCESS);
+    status = sensor_bind(fwk_module_id_sensor, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+int sensor_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(utest_sensor_sampling_interval_ticks);
+    RUN_TEST(utest_sensor_sampling_start_groups_by_driver);
+    RUN_TEST(utest_sensor_sampling_process_due_sensors);
+    RUN_TEST(utest_sensor_sampling_pending_read_complete);
+    RUN_TEST(utest_sensor_sampling_bind_alarm);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return sensor_test_main();
+}
+#endif
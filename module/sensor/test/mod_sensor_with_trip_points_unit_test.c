@@ -0,0 +1,246 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_core.h>
+#include <Mockfwk_id.h>
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+#include <Mockfwk_string.h>
+#include <internal/Mockfwk_core_internal.h>
+
+#include <fwk_element.h>
+#include <fwk_id.h>
+#include <fwk_module_idx.h>
+#include <fwk_status.h>
+
+#include UNIT_TEST_SRC
+
+#define TRIP_POINT_COUNT 3
+#define MAX_NOTIFICATIONS 8
+
+struct notification {
+    bool above_threshold;
+    uint32_t trip_point_idx;
+};
+
+static struct sensor_dev_ctx sensor_dev_context;
+static struct sensor_trip_point_ctx trip_point_context[TRIP_POINT_COUNT];
+static uint32_t trip_point_order[TRIP_POINT_COUNT];
+
+static struct mod_sensor_dev_config sensor_dev_config = {
+    .trip_point = {
+        .count = TRIP_POINT_COUNT,
+    },
+};
+
+static struct notification notifications[MAX_NOTIFICATIONS];
+static unsigned int notification_count;
+
+static const fwk_id_t elem_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_SENSOR, 0);
+
+static void notify_sensor_trip_point(
+    fwk_id_t sensor_id,
+    uint32_t state,
+    uint32_t tp_id)
+{
+    TEST_ASSERT_LESS_THAN(MAX_NOTIFICATIONS, notification_count);
+
+    notifications[notification_count++] = (struct notification){
+        .above_threshold = state,
+        .trip_point_idx = tp_id,
+    };
+}
+
+static struct mod_sensor_trip_point_api trip_point_api = {
+    .notify_sensor_trip_point = notify_sensor_trip_point,
+};
+
+static void set_trip_point(
+    uint32_t trip_point_idx,
+    uint64_t value,
+    enum mod_sensor_trip_point_mode mode)
+{
+    struct mod_sensor_trip_point_params params = {
+        .tp_value = value,
+        .mode = mode,
+    };
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS, sensor_set_trip_point(elem_id, trip_point_idx, &params));
+}
+
+static void read_value(uint64_t value)
+{
+    struct mod_sensor_data data = {
+        .status = FWK_SUCCESS,
+        .value = value,
+    };
+
+    trip_point_process(elem_id, &data);
+}
+
+void setUp(void)
+{
+    uint32_t i;
+
+    ctx_table = &sensor_dev_context;
+    memset(&sensor_dev_context, 0, sizeof(sensor_dev_context));
+    memset(trip_point_context, 0, sizeof(trip_point_context));
+
+    for (i = 0; i < TRIP_POINT_COUNT; i++) {
+        trip_point_order[i] = i;
+        trip_point_context[i].params.mode = MOD_SENSOR_TRIP_POINT_MODE_DISABLED;
+    }
+    trip_point_context[0].enabled = true;
+
+    sensor_dev_config.trip_point.hysteresis = 0;
+    sensor_dev_config.trip_point.debounce_count = 0;
+
+    sensor_dev_context.config = &sensor_dev_config;
+    sensor_dev_context.trip_point_ctx = trip_point_context;
+    sensor_dev_context.trip_point_band.order = trip_point_order;
+
+    sensor_mod_ctx.sensor_trip_point_api = &trip_point_api;
+
+    memset(notifications, 0, sizeof(notifications));
+    notification_count = 0;
+
+    fwk_id_get_element_idx_IgnoreAndReturn(0);
+    fwk_id_is_equal_IgnoreAndReturn(false);
+}
+
+void tearDown(void)
+{
+}
+
+void utest_sensor_trip_point_sorted_bands(void)
+{
+    set_trip_point(0, 30, MOD_SENSOR_TRIP_POINT_MODE_TRANSITION);
+    set_trip_point(1, 10, MOD_SENSOR_TRIP_POINT_MODE_POSITIVE);
+    set_trip_point(2, 20, MOD_SENSOR_TRIP_POINT_MODE_NEGATIVE);
+
+    TEST_ASSERT_EQUAL(1, trip_point_order[0]);
+    TEST_ASSERT_EQUAL(2, trip_point_order[1]);
+    TEST_ASSERT_EQUAL(0, trip_point_order[2]);
+
+    /* The first reading after a change evaluates all the trip points */
+    read_value(5);
+    TEST_ASSERT_EQUAL(0, notification_count);
+    TEST_ASSERT_EQUAL(0, sensor_dev_context.trip_point_band.band);
+    TEST_ASSERT_FALSE(sensor_dev_context.trip_point_band.resync);
+
+    /* Rising above 10 and 20 only notifies the positive trip point */
+    read_value(25);
+    TEST_ASSERT_EQUAL(2, sensor_dev_context.trip_point_band.band);
+    TEST_ASSERT_EQUAL(1, notification_count);
+    TEST_ASSERT_TRUE(notifications[0].above_threshold);
+    TEST_ASSERT_EQUAL(1, notifications[0].trip_point_idx);
+    TEST_ASSERT_TRUE(trip_point_context[2].above_threshold);
+
+    read_value(35);
+    TEST_ASSERT_EQUAL(3, sensor_dev_context.trip_point_band.band);
+    TEST_ASSERT_EQUAL(2, notification_count);
+    TEST_ASSERT_TRUE(notifications[1].above_threshold);
+    TEST_ASSERT_EQUAL(0, notifications[1].trip_point_idx);
+
+    /* Falling below 30 and 20 is reported highest trip point first */
+    read_value(15);
+    TEST_ASSERT_EQUAL(1, sensor_dev_context.trip_point_band.band);
+    TEST_ASSERT_EQUAL(4, notification_count);
+    TEST_ASSERT_FALSE(notifications[2].above_threshold);
+    TEST_ASSERT_EQUAL(0, notifications[2].trip_point_idx);
+    TEST_ASSERT_FALSE(notifications[3].above_threshold);
+    TEST_ASSERT_EQUAL(2, notifications[3].trip_point_idx);
+}
+
+void utest_sensor_trip_point_hysteresis(void)
+{
+    struct mod_sensor_trip_point_stats stats;
+
+    sensor_dev_config.trip_point.hysteresis = 5;
+    set_trip_point(0, 20, MOD_SENSOR_TRIP_POINT_MODE_TRANSITION);
+
+    read_value(5);
+    read_value(25);
+    TEST_ASSERT_EQUAL(1, notification_count);
+
+    /* Within the hysteresis, the trip point is not crossed back */
+    read_value(18);
+    read_value(16);
+    read_value(21);
+    read_value(19);
+    TEST_ASSERT_EQUAL(1, notification_count);
+
+    read_value(15);
+    TEST_ASSERT_EQUAL(2, notification_count);
+    TEST_ASSERT_FALSE(notifications[1].above_threshold);
+
+    /* Readings below the trip point from below it are not held back */
+    read_value(18);
+    TEST_ASSERT_EQUAL(2, notification_count);
+
+    /* Only the readings that went below the trip point value were held back */
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS, sensor_get_trip_point_stats(elem_id, &stats));
+    TEST_ASSERT_EQUAL(2, stats.hysteresis_suppressed_count);
+    TEST_ASSERT_EQUAL(0, stats.debounce_suppressed_count);
+}
+
+void utest_sensor_trip_point_debounce(void)
+{
+    struct mod_sensor_trip_point_stats stats;
+
+    sensor_dev_config.trip_point.debounce_count = 3;
+    set_trip_point(0, 20, MOD_SENSOR_TRIP_POINT_MODE_TRANSITION);
+
+    read_value(5);
+
+    /* A glitch shorter than the debounce is ignored */
+    read_value(25);
+    read_value(25);
+    read_value(5);
+    TEST_ASSERT_EQUAL(0, notification_count);
+
+    read_value(25);
+    read_value(25);
+    TEST_ASSERT_EQUAL(0, notification_count);
+    read_value(25);
+    TEST_ASSERT_EQUAL(1, notification_count);
+    TEST_ASSERT_TRUE(notifications[0].above_threshold);
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS, sensor_get_trip_point_stats(elem_id, &stats));
+    TEST_ASSERT_EQUAL(0, stats.hysteresis_suppressed_count);
+    TEST_ASSERT_EQUAL(4, stats.debounce_suppressed_count);
+}
+
+void utest_sensor_trip_point_stats_null(void)
+{
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, sensor_get_trip_point_stats(elem_id, NULL));
+}
+
+int sensor_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(utest_sensor_trip_point_sorted_bands);
+    RUN_TEST(utest_sensor_trip_point_hysteresis);
+    RUN_TEST(utest_sensor_trip_point_debounce);
+    RUN_TEST(utest_sensor_trip_point_stats_null);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return sensor_test_main();
+}
+#endif
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2017-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -69,6 +69,17 @@ enum mod_timer_alarm_type {
     /*! Alarm that will trigger at regular intervals */
     MOD_TIMER_ALARM_TYPE_PERIODIC,
 
+#ifdef BUILD_HAS_TIMER_DEFERRED_ALARMS
+    /*! Alarm that will trigger once, with its callback run in thread context */
+    MOD_TIMER_ALARM_TYPE_ONCE_DEFERRED,
+
+    /*!
+     * Alarm that will trigger at regular intervals, with its callback run in
+     * thread context
+     */
+    MOD_TIMER_ALARM_TYPE_PERIODIC_DEFERRED,
+#endif
+
     /*! Number of alarm types */
     MOD_TIMER_ALARM_TYPE_COUNT,
 };
@@ -129,6 +140,34 @@ struct mod_timer_driver_api {
     void (*overflow_handler)(fwk_id_t dev_id);
 };
 
+#ifdef BUILD_HAS_TIMER_ALARM_COALESCING
+/*!
+ * \brief Alarm statistics of a timer device.
+ */
+struct mod_timer_alarm_stats {
+    /*! Number of timer interrupts which processed alarms */
+    uint32_t interrupt_count;
+
+    /*! Number of alarms processed */
+    uint32_t alarm_count;
+
+    /*!
+     * \brief Number of alarms processed in the interrupt of another alarm,
+     *      that is the number of interrupts saved.
+     */
+    uint32_t coalesced_count;
+
+    /*!
+     * \brief Sum of the delays, in timer ticks, between the time the alarms
+     *      were due and the time they were processed.
+     */
+    uint64_t total_delay;
+
+    /*! Largest delay, in timer ticks, of an alarm */
+    uint64_t max_delay;
+};
+#endif
+
 /*!
  * \brief Timer HAL interface
  */
@@ -265,6 +304,21 @@ struct mod_timer_api {
     int (*get_next_alarm_remaining)(fwk_id_t dev_id,
                                     bool *has_alarm,
                                     uint64_t *remaining_ticks);
+
+#ifdef BUILD_HAS_TIMER_ALARM_COALESCING
+    /*!
+     * \brief Get the alarm statistics of a timer.
+     *
+     * \param dev_id Element identifier that identifies the timer device.
+     * \param [out] stats Alarm statistics.
+     *
+     * \retval ::FWK_SUCCESS Operation succeeded.
+     * \retval ::FWK_E_PARAM The \p stats parameter is a null pointer.
+     */
+    int (*get_alarm_stats)(
+        fwk_id_t dev_id,
+        struct mod_timer_alarm_stats *stats);
+#endif
 };
 
 /*!
@@ -284,7 +338,9 @@ struct mod_timer_alarm_api {
      *     the new configuration.
      *
      * \warning \p callback will be called from within an interrupt service
-     *      routine.
+     *      routine, unless the alarm type is one of the deferred types. The
+     *      callbacks of deferred alarms are called in thread context, from an
+     *      event of the Timer module, in the order the alarms triggered.
      *
      * \param alarm_id Sub-element identifier of the alarm.
      * \param milliseconds The time delay, given in milliseconds, until the
@@ -331,6 +387,45 @@ struct mod_timer_alarm_api {
      * \return One of the other specific error codes described by the framework.
      */
     int (*stop)(fwk_id_t alarm_id);
+
+#ifdef BUILD_HAS_TIMER_ALARM_COALESCING
+    /*!
+     * \brief Start an alarm which may trigger late, to share a timer
+     *      interrupt with other alarms.
+     *
+     * \details Behaves as ::mod_timer_alarm_api::start, except that the alarm
+     *     triggers at any time between \p milliseconds and \p milliseconds
+     *     plus \p slack_microseconds. Within this window, the alarm is
+     *     processed by the first interrupt raised for another alarm, and
+     *     only raises its own interrupt at the end of the window.
+     *
+     * \param alarm_id Sub-element identifier of the alarm.
+     * \param milliseconds The time delay, given in milliseconds, until the
+     *     alarm may trigger.
+     * \param slack_microseconds The time, given in microseconds, the alarm
+     *     may be delayed by.
+     * \param type ::MOD_TIMER_ALARM_TYPE_ONCE or
+     *     ::MOD_TIMER_ALARM_TYPE_PERIODIC.
+     * \param callback Pointer to the callback function.
+     * \param param Parameter given to the callback function when called.
+     *
+     * \pre \p alarm_id must be a valid sub-element alarm identifier that has
+     *     previously been bound to.
+     *
+     * \retval ::FWK_E_ACCESS The function was called from an interrupt handler
+     *      OR could not attain call context.
+     * \retval ::FWK_E_DEVICE The timer driver failed.
+     * \retval ::FWK_SUCCESS The alarm was started.
+     * \return One of the other specific error codes described by the framework.
+     */
+    int (*start_with_slack)(
+        fwk_id_t alarm_id,
+        unsigned int milliseconds,
+        uint32_t slack_microseconds,
+        enum mod_timer_alarm_type type,
+        void (*callback)(uintptr_t param),
+        uintptr_t param);
+#endif
 };
 
 /*!
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2017-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -11,10 +11,12 @@
 #include <mod_timer.h>
 
 #include <fwk_assert.h>
-#include <fwk_dlist.h>
+#ifdef BUILD_HAS_TIMER_DEFERRED_ALARMS
+#    include <fwk_core.h>
+#    include <fwk_event.h>
+#endif
 #include <fwk_id.h>
 #include <fwk_interrupt.h>
-#include <fwk_list.h>
 #include <fwk_log.h>
 #include <fwk_macros.h>
 #include <fwk_mm.h>
@@ -36,18 +38,41 @@ struct timer_dev_ctx {
     fwk_id_t driver_dev_id;
     /* Storage for all alarms */
     struct alarm_sub_element_ctx *alarm_pool;
-    /* Queue of active alarms */
-    struct fwk_dlist alarms_active;
+    /* Number of alarms in the pool */
+    unsigned int alarm_count;
+    /* Queue of active alarms, as a binary min-heap on the trigger time */
+    struct alarm_sub_element_ctx **alarms_active;
+    /* Number of alarms in the active queue */
+    unsigned int alarm_active_count;
+    /* Sequence number given to the next alarm put in the active queue */
+    uint32_t alarm_sequence;
+#ifdef BUILD_HAS_TIMER_ALARM_COALESCING
+    /* Alarm statistics */
+    struct mod_timer_alarm_stats alarm_stats;
+#endif
+#ifdef BUILD_HAS_TIMER_DEFERRED_ALARMS
+    /* Queue of the triggered deferred alarms, oldest first */
+    struct alarm_sub_element_ctx *deferred_head;
+    struct alarm_sub_element_ctx *deferred_tail;
+    /* Flag indicating if the event running the deferred alarms is pending */
+    bool deferred_event_pending;
+#endif
 };
 
 /* Alarm item context (sub-element) */
 struct alarm_sub_element_ctx {
-    /* List node */
-    struct fwk_dlist_node node;
+    /* Position of this alarm in the active queue */
+    unsigned int queue_idx;
+    /* Order of this alarm among the alarms put in the active queue */
+    uint32_t sequence;
     /* Time between starting this alarm and it triggering */
     uint32_t microseconds;
     /* Timestamp of the time this alarm will trigger */
     uint64_t timestamp;
+#ifdef BUILD_HAS_TIMER_ALARM_COALESCING
+    /* Number of ticks this alarm may trigger late by */
+    uint64_t slack;
+#endif
     /* Pointer to the callback function */
     void (*callback)(uintptr_t param);
     /* Parameter of the callback function */
@@ -60,8 +85,28 @@ struct alarm_sub_element_ctx {
     bool bound;
     /* Flag indicating if this alarm is started */
     bool started;
+#ifdef BUILD_HAS_TIMER_DEFERRED_ALARMS
+    /* Flag indicating if the callback of this alarm runs in thread context */
+    bool deferred;
+    /* Flag indicating if this alarm is in the deferred queue */
+    bool deferred_pending;
+    /* Next alarm in the deferred queue */
+    struct alarm_sub_element_ctx *deferred_next;
+#endif
 };
 
+#ifdef BUILD_HAS_TIMER_DEFERRED_ALARMS
+/* Timer event indices */
+enum timer_event_idx {
+    /* Run the callbacks of the triggered deferred alarms */
+    TIMER_EVENT_IDX_DEFERRED_ALARMS,
+    TIMER_EVENT_IDX_COUNT,
+};
+
+static const fwk_id_t timer_event_id_deferred_alarms =
+    FWK_ID_EVENT_INIT(FWK_MODULE_IDX_TIMER, TIMER_EVENT_IDX_DEFERRED_ALARMS);
+#endif
+
 /* Table of timer device context structures */
 static struct timer_dev_ctx *ctx_table;
 
@@ -148,6 +193,108 @@ static int _remaining(
     return FWK_SUCCESS;
 }
 
+/*
+ * Latest time an alarm can trigger at. The timer interrupt is raised for the
+ * alarm at this time, unless it has been processed before with another alarm.
+ */
+static uint64_t _alarm_expiry(const struct alarm_sub_element_ctx *alarm)
+{
+#ifdef BUILD_HAS_TIMER_ALARM_COALESCING
+    return alarm->timestamp + alarm->slack;
+#else
+    return alarm->timestamp;
+#endif
+}
+
+/*
+ * The active queue is a binary min-heap: the alarm expiring first is at the
+ * root and inserting or removing an alarm costs O(log n). Alarms expiring at
+ * the same time are ordered by the time they were put in the queue.
+ */
+static bool _alarm_precedes(
+    const struct alarm_sub_element_ctx *alarm,
+    const struct alarm_sub_element_ctx *other)
+{
+    uint64_t alarm_expiry = _alarm_expiry(alarm);
+    uint64_t other_expiry = _alarm_expiry(other);
+
+    if (alarm_expiry != other_expiry) {
+        return alarm_expiry < other_expiry;
+    }
+
+    return (int32_t)(alarm->sequence - other->sequence) < 0;
+}
+
+static void _active_queue_set(
+    struct timer_dev_ctx *ctx,
+    unsigned int queue_idx,
+    struct alarm_sub_element_ctx *alarm)
+{
+    ctx->alarms_active[queue_idx] = alarm;
+    alarm->queue_idx = queue_idx;
+}
+
+static void _active_queue_sift_up(
+    struct timer_dev_ctx *ctx,
+    unsigned int queue_idx)
+{
+    struct alarm_sub_element_ctx *alarm = ctx->alarms_active[queue_idx];
+    unsigned int parent_idx;
+
+    while (queue_idx > 0) {
+        parent_idx = (queue_idx - 1) / 2;
+        if (!_alarm_precedes(alarm, ctx->alarms_active[parent_idx])) {
+            break;
+        }
+
+        _active_queue_set(ctx, queue_idx, ctx->alarms_active[parent_idx]);
+        queue_idx = parent_idx;
+    }
+
+    _active_queue_set(ctx, queue_idx, alarm);
+}
+
+static void _active_queue_sift_down(
+    struct timer_dev_ctx *ctx,
+    unsigned int queue_idx)
+{
+    struct alarm_sub_element_ctx *alarm = ctx->alarms_active[queue_idx];
+    unsigned int child_idx;
+
+    while (true) {
+        child_idx = (2 * queue_idx) + 1;
+        if (child_idx >= ctx->alarm_active_count) {
+            break;
+        }
+
+        if (((child_idx + 1) < ctx->alarm_active_count) &&
+            _alarm_precedes(
+                ctx->alarms_active[child_idx + 1],
+                ctx->alarms_active[child_idx])) {
+            child_idx++;
+        }
+
+        if (!_alarm_precedes(ctx->alarms_active[child_idx], alarm)) {
+            break;
+        }
+
+        _active_queue_set(ctx, queue_idx, ctx->alarms_active[child_idx]);
+        queue_idx = child_idx;
+    }
+
+    _active_queue_set(ctx, queue_idx, alarm);
+}
+
+static struct alarm_sub_element_ctx *_active_queue_head(
+    const struct timer_dev_ctx *ctx)
+{
+    if (ctx->alarm_active_count == 0) {
+        return NULL;
+    }
+
+    return ctx->alarms_active[0];
+}
+
 static void _configure_timer_with_next_alarm(struct timer_dev_ctx *ctx)
 {
     int status;
@@ -155,12 +302,11 @@ static void _configure_timer_with_next_alarm(struct timer_dev_ctx *ctx)
 
     fwk_assert(ctx != NULL);
 
-    alarm_head =
-        (struct alarm_sub_element_ctx *)fwk_list_head(&ctx->alarms_active);
+    alarm_head = _active_queue_head(ctx);
     if (alarm_head != NULL) {
         /* Configure timer device */
-        status =
-            ctx->driver->set_timer(ctx->driver_dev_id, alarm_head->timestamp);
+        status = ctx->driver->set_timer(
+            ctx->driver_dev_id, _alarm_expiry(alarm_head));
         if (status != FWK_SUCCESS) {
             FWK_LOG_DEBUG("[Timer] %s @%d", __func__, __LINE__);
         }
@@ -176,32 +322,163 @@ static void _insert_alarm_ctx_into_active_queue(
     struct timer_dev_ctx *ctx,
     struct alarm_sub_element_ctx *alarm_new)
 {
-    struct fwk_dlist_node *alarm_node;
-    struct alarm_sub_element_ctx *alarm;
+    unsigned int queue_idx;
 
     fwk_assert(ctx != NULL);
     fwk_assert(alarm_new != NULL);
+    fwk_assert(ctx->alarm_active_count < ctx->alarm_count);
 
-    /*
-     * Search though the active queue to find the correct place to insert the
-     * new alarm item
-     */
-    alarm_node = fwk_list_head(&ctx->alarms_active);
-    alarm = FWK_LIST_GET(alarm_node, struct alarm_sub_element_ctx, node);
+    alarm_new->sequence = ctx->alarm_sequence++;
+
+    queue_idx = ctx->alarm_active_count++;
+    _active_queue_set(ctx, queue_idx, alarm_new);
+    _active_queue_sift_up(ctx, queue_idx);
+
+    alarm_new->activated = true;
+}
+
+static void _remove_alarm_ctx_from_active_queue(
+    struct timer_dev_ctx *ctx,
+    struct alarm_sub_element_ctx *alarm)
+{
+    struct alarm_sub_element_ctx *alarm_last;
 
-    while ((alarm_node != NULL) && (alarm_new->timestamp > alarm->timestamp)) {
-        alarm_node = fwk_list_next(&ctx->alarms_active, alarm_node);
-        alarm = FWK_LIST_GET(alarm_node, struct alarm_sub_element_ctx, node);
+    fwk_assert(ctx != NULL);
+    fwk_assert(alarm != NULL);
+    fwk_assert(alarm->activated);
+
+    /* Move the last alarm of the queue into the hole and restore the order */
+    alarm_last = ctx->alarms_active[--ctx->alarm_active_count];
+    if (alarm_last != alarm) {
+        _active_queue_set(ctx, alarm->queue_idx, alarm_last);
+        _active_queue_sift_up(ctx, alarm_last->queue_idx);
+        _active_queue_sift_down(ctx, alarm_last->queue_idx);
     }
 
-    /* Insert alarm_new just BEFORE the alarm that was found */
-    fwk_list_insert(&ctx->alarms_active,
-                    &(alarm_new->node),
-                    alarm_node);
+    alarm->activated = false;
+}
 
-    alarm_new->activated = true;
+#ifdef BUILD_HAS_TIMER_DEFERRED_ALARMS
+/*
+ * Queue the callback of a triggered deferred alarm. Called from the timer
+ * interrupt, which puts the event running the queued callbacks once the alarms
+ * have been processed.
+ */
+static void _defer_alarm_callback(
+    struct timer_dev_ctx *ctx,
+    struct alarm_sub_element_ctx *alarm)
+{
+    /* A callback already queued serves all the triggers until it runs */
+    if (alarm->deferred_pending) {
+        return;
+    }
+
+    alarm->deferred_pending = true;
+    alarm->deferred_next = NULL;
+
+    if (ctx->deferred_tail == NULL) {
+        ctx->deferred_head = alarm;
+    } else {
+        ctx->deferred_tail->deferred_next = alarm;
+    }
+    ctx->deferred_tail = alarm;
+}
+
+/*
+ * Make sure an event is pending to run the queued callbacks. Called from the
+ * timer interrupt. If the event cannot be put, the queued callbacks are kept
+ * and putting the event is retried on the next timer interrupt.
+ */
+static void _put_deferred_event(struct timer_dev_ctx *ctx)
+{
+    int status;
+    fwk_id_t dev_id;
+    struct fwk_event_light event;
+
+    if ((ctx->deferred_head == NULL) || ctx->deferred_event_pending) {
+        return;
+    }
+
+    dev_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_TIMER, (unsigned int)(ctx - ctx_table));
+    event = (struct fwk_event_light){
+        .id = timer_event_id_deferred_alarms,
+        .source_id = dev_id,
+        .target_id = dev_id,
+    };
+
+    status = fwk_put_event(&event);
+    if (status == FWK_SUCCESS) {
+        ctx->deferred_event_pending = true;
+    } else {
+        FWK_LOG_ERR(
+            "[Timer] Error: Deferred alarms event could not be put (%d)",
+            status);
+    }
 }
 
+/*
+ * Remove an alarm from the deferred queue. Called with the timer interrupt
+ * disabled.
+ */
+static void _deferred_queue_remove(
+    struct timer_dev_ctx *ctx,
+    struct alarm_sub_element_ctx *alarm)
+{
+    struct alarm_sub_element_ctx **link = &ctx->deferred_head;
+    struct alarm_sub_element_ctx *previous = NULL;
+
+    if (!alarm->deferred_pending) {
+        return;
+    }
+
+    while (*link != alarm) {
+        previous = *link;
+        link = &previous->deferred_next;
+    }
+
+    *link = alarm->deferred_next;
+    if (ctx->deferred_tail == alarm) {
+        ctx->deferred_tail = previous;
+    }
+
+    alarm->deferred_pending = false;
+}
+
+/*
+ * Take the oldest callback from the deferred queue, with the timer interrupt
+ * disabled. When the queue is empty, the event is no longer pending.
+ */
+static bool _deferred_queue_pop(
+    struct timer_dev_ctx *ctx,
+    void (**callback)(uintptr_t param),
+    uintptr_t *param)
+{
+    int status;
+    struct alarm_sub_element_ctx *alarm;
+
+    status = ctx->driver->disable(ctx->driver_dev_id);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[Timer] %s @%d", __func__, __LINE__);
+    }
+
+    alarm = ctx->deferred_head;
+    if (alarm != NULL) {
+        *callback = alarm->callback;
+        *param = alarm->param;
+        _deferred_queue_remove(ctx, alarm);
+    } else {
+        ctx->deferred_event_pending = false;
+    }
+
+    status = ctx->driver->enable(ctx->driver_dev_id);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[Timer] %s @%d", __func__, __LINE__);
+    }
+
+    return alarm != NULL;
+}
+#endif
 
 /*
  * Functions fulfilling the timer API
@@ -333,7 +610,6 @@ static int get_next_alarm_remaining(fwk_id_t dev_id,
     int status, exit_status;
     const struct timer_dev_ctx *ctx;
     const struct alarm_sub_element_ctx *alarm_ctx;
-    const struct fwk_dlist_node *alarm_ctx_node;
     if (has_alarm == NULL) {
         return FWK_E_PARAM;
     }
@@ -353,14 +629,12 @@ static int get_next_alarm_remaining(fwk_id_t dev_id,
         return FWK_E_DEVICE;
     }
 
-    *has_alarm = !fwk_list_is_empty(&ctx->alarms_active);
+    alarm_ctx = _active_queue_head(ctx);
+    *has_alarm = (alarm_ctx != NULL);
 
     if (*has_alarm) {
-        alarm_ctx_node = fwk_list_head(&ctx->alarms_active);
-        alarm_ctx =
-            FWK_LIST_GET(alarm_ctx_node, struct alarm_sub_element_ctx, node);
-
-        exit_status = _remaining(ctx, alarm_ctx->timestamp, remaining_ticks);
+        exit_status =
+            _remaining(ctx, _alarm_expiry(alarm_ctx), remaining_ticks);
     } else {
         exit_status = FWK_E_PARAM;
     }
@@ -373,6 +647,35 @@ static int get_next_alarm_remaining(fwk_id_t dev_id,
     return exit_status;
 }
 
+#ifdef BUILD_HAS_TIMER_ALARM_COALESCING
+static int get_alarm_stats(fwk_id_t dev_id, struct mod_timer_alarm_stats *stats)
+{
+    int status;
+    struct timer_dev_ctx *ctx;
+
+    if (stats == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    ctx = &ctx_table[fwk_id_get_element_idx(dev_id)];
+
+    /* The statistics are updated by the timer interrupt */
+    status = ctx->driver->disable(ctx->driver_dev_id);
+    if (status != FWK_SUCCESS) {
+        return FWK_E_DEVICE;
+    }
+
+    *stats = ctx->alarm_stats;
+
+    status = ctx->driver->enable(ctx->driver_dev_id);
+    if (status != FWK_SUCCESS) {
+        return FWK_E_DEVICE;
+    }
+
+    return FWK_SUCCESS;
+}
+#endif
+
 static const struct mod_timer_api timer_api = {
     .get_frequency = get_frequency,
     .time_to_timestamp = time_to_timestamp,
@@ -381,6 +684,9 @@ static const struct mod_timer_api timer_api = {
     .wait = wait,
     .remaining = remaining,
     .get_next_alarm_remaining = get_next_alarm_remaining,
+#ifdef BUILD_HAS_TIMER_ALARM_COALESCING
+    .get_alarm_stats = get_alarm_stats,
+#endif
 };
 
 /*
@@ -439,6 +745,10 @@ static int alarm_stop(fwk_id_t alarm_id)
 
     alarm->started = false;
 
+#ifdef BUILD_HAS_TIMER_DEFERRED_ALARMS
+    _deferred_queue_remove(ctx, alarm);
+#endif
+
     if (!alarm->activated) {
         return FWK_SUCCESS;
     }
@@ -457,19 +767,20 @@ static int alarm_stop(fwk_id_t alarm_id)
         return status;
     }
 
-    fwk_list_remove(&ctx->alarms_active, (struct fwk_dlist_node *)alarm);
-    alarm->activated = false;
+    _remove_alarm_ctx_from_active_queue(ctx, alarm);
 
     _configure_timer_with_next_alarm(ctx);
 
     return FWK_SUCCESS;
 }
 
-static int alarm_start(fwk_id_t alarm_id,
-                       unsigned int milliseconds,
-                       enum mod_timer_alarm_type type,
-                       void (*callback)(uintptr_t param),
-                       uintptr_t param)
+static int _alarm_start(
+    fwk_id_t alarm_id,
+    unsigned int milliseconds,
+    uint32_t slack_microseconds,
+    enum mod_timer_alarm_type type,
+    void (*callback)(uintptr_t param),
+    uintptr_t param)
 {
     int status;
     struct timer_dev_ctx *ctx;
@@ -505,8 +816,15 @@ static int alarm_start(fwk_id_t alarm_id,
     /* Populate alarm item */
     alarm->callback = callback;
     alarm->param = param;
+#ifdef BUILD_HAS_TIMER_DEFERRED_ALARMS
+    alarm->periodic = (type == MOD_TIMER_ALARM_TYPE_PERIODIC) ||
+        (type == MOD_TIMER_ALARM_TYPE_PERIODIC_DEFERRED);
+    alarm->deferred = (type == MOD_TIMER_ALARM_TYPE_ONCE_DEFERRED) ||
+        (type == MOD_TIMER_ALARM_TYPE_PERIODIC_DEFERRED);
+#else
     alarm->periodic =
         (type == MOD_TIMER_ALARM_TYPE_PERIODIC ? true : false);
+#endif
     alarm->microseconds = milliseconds * 1000;
     status = _timestamp_from_now(ctx,
                                  alarm->microseconds,
@@ -515,6 +833,13 @@ static int alarm_start(fwk_id_t alarm_id,
         return status;
     }
 
+#ifdef BUILD_HAS_TIMER_ALARM_COALESCING
+    status = _time_to_timestamp(ctx, slack_microseconds, &alarm->slack);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+#endif
+
     /* Disable timer interrupts to work with the active queue */
     status = ctx->driver->disable(ctx->driver_dev_id);
     if (status != FWK_SUCCESS) {
@@ -528,17 +853,170 @@ static int alarm_start(fwk_id_t alarm_id,
     return FWK_SUCCESS;
 }
 
+static int alarm_start(fwk_id_t alarm_id,
+                       unsigned int milliseconds,
+                       enum mod_timer_alarm_type type,
+                       void (*callback)(uintptr_t param),
+                       uintptr_t param)
+{
+    return _alarm_start(alarm_id, milliseconds, 0, type, callback, param);
+}
+
+#ifdef BUILD_HAS_TIMER_ALARM_COALESCING
+static int alarm_start_with_slack(
+    fwk_id_t alarm_id,
+    unsigned int milliseconds,
+    uint32_t slack_microseconds,
+    enum mod_timer_alarm_type type,
+    void (*callback)(uintptr_t param),
+    uintptr_t param)
+{
+    return _alarm_start(
+        alarm_id, milliseconds, slack_microseconds, type, callback, param);
+}
+#endif
+
 static const struct mod_timer_alarm_api alarm_api = {
     .start = alarm_start,
     .stop = alarm_stop,
+#ifdef BUILD_HAS_TIMER_ALARM_COALESCING
+    .start_with_slack = alarm_start_with_slack,
+#endif
 };
 
+static void _process_alarm(
+    struct timer_dev_ctx *ctx,
+    struct alarm_sub_element_ctx *alarm)
+{
+    int status;
+    uint64_t timestamp = 0;
+
+    _remove_alarm_ctx_from_active_queue(ctx, alarm);
+
+#ifdef BUILD_HAS_TIMER_DEFERRED_ALARMS
+    if (alarm->deferred) {
+        _defer_alarm_callback(ctx, alarm);
+    } else {
+        alarm->callback(alarm->param);
+    }
+#else
+    /* Execute the callback function */
+    alarm->callback(alarm->param);
+#endif
+
+    if (alarm->periodic && alarm->started) {
+        /* Put this alarm back into the active queue */
+        status = _time_to_timestamp(ctx, alarm->microseconds, &timestamp);
+
+        if (status == FWK_SUCCESS) {
+            alarm->timestamp += timestamp;
+            _insert_alarm_ctx_into_active_queue(ctx, alarm);
+        } else {
+            FWK_LOG_ERR(
+                "[Timer] Error: Periodic alarm could not be added "
+                "back into queue.");
+        }
+    }
+}
+
+#ifdef BUILD_HAS_TIMER_ALARM_COALESCING
+static void _alarm_stats_update(
+    struct timer_dev_ctx *ctx,
+    const struct alarm_sub_element_ctx *alarm,
+    uint64_t counter)
+{
+    struct mod_timer_alarm_stats *stats = &ctx->alarm_stats;
+    uint64_t delay;
+
+    delay = (counter > alarm->timestamp) ? counter - alarm->timestamp : 0;
+
+    stats->alarm_count++;
+    stats->total_delay += delay;
+    stats->max_delay = FWK_MAX(stats->max_delay, delay);
+}
+
+/*
+ * An alarm is due once its trigger time has passed. Alarms put in the active
+ * queue after sequence_limit, that is re-armed or started by the callbacks, are
+ * left for a later interrupt.
+ */
+static bool _alarm_is_due(
+    const struct alarm_sub_element_ctx *alarm,
+    uint64_t counter,
+    uint32_t sequence_limit)
+{
+    return (alarm->timestamp <= counter) &&
+        ((int32_t)(alarm->sequence - sequence_limit) < 0);
+}
+
+/*
+ * Find the due alarm with the earliest trigger time. The active queue is
+ * ordered on the expiry of the alarms, so an alarm with a large slack can be
+ * due behind alarms which are not. All the active alarms are looked at.
+ */
+static struct alarm_sub_element_ctx *_active_queue_find_due(
+    const struct timer_dev_ctx *ctx,
+    uint64_t counter,
+    uint32_t sequence_limit)
+{
+    struct alarm_sub_element_ctx *alarm;
+    struct alarm_sub_element_ctx *alarm_due = NULL;
+    unsigned int queue_idx;
+
+    for (queue_idx = 0; queue_idx < ctx->alarm_active_count; queue_idx++) {
+        alarm = ctx->alarms_active[queue_idx];
+        if (!_alarm_is_due(alarm, counter, sequence_limit)) {
+            continue;
+        }
+
+        if ((alarm_due == NULL) || (alarm->timestamp < alarm_due->timestamp) ||
+            ((alarm->timestamp == alarm_due->timestamp) &&
+             ((int32_t)(alarm->sequence - alarm_due->sequence) < 0))) {
+            alarm_due = alarm;
+        }
+    }
+
+    return alarm_due;
+}
+
+/*
+ * Process the alarm the interrupt was raised for, and all the other alarms
+ * which are due, in the order of their trigger times.
+ */
+static void _process_due_alarms(
+    struct timer_dev_ctx *ctx,
+    struct alarm_sub_element_ctx *alarm)
+{
+    int status;
+    uint64_t counter;
+    uint32_t sequence_limit = ctx->alarm_sequence;
+
+    status = ctx->driver->get_counter(ctx->driver_dev_id, &counter);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[Timer] %s @%d", __func__, __LINE__);
+        _process_alarm(ctx, alarm);
+        return;
+    }
+
+    ctx->alarm_stats.interrupt_count++;
+
+    while (alarm != NULL) {
+        _alarm_stats_update(ctx, alarm, counter);
+        _process_alarm(ctx, alarm);
+
+        alarm = _active_queue_find_due(ctx, counter, sequence_limit);
+        if (alarm != NULL) {
+            ctx->alarm_stats.coalesced_count++;
+        }
+    }
+}
+#endif
+
 static void timer_isr(uintptr_t ctx_ptr)
 {
     int status;
     struct alarm_sub_element_ctx *alarm;
     struct timer_dev_ctx *ctx = (struct timer_dev_ctx *)ctx_ptr;
-    uint64_t timestamp = 0;
 
     fwk_assert(ctx != NULL);
 
@@ -553,8 +1031,7 @@ static void timer_isr(uintptr_t ctx_ptr)
         FWK_LOG_DEBUG("[Timer] %s @%d", __func__, __LINE__);
     }
 
-    alarm =
-        (struct alarm_sub_element_ctx *)fwk_list_pop_head(&ctx->alarms_active);
+    alarm = _active_queue_head(ctx);
 
     if (alarm == NULL) {
         if (ctx->driver->overflow_handler != NULL) {
@@ -566,29 +1043,19 @@ static void timer_isr(uintptr_t ctx_ptr)
              */
             fwk_unexpected();
         }
-        return;
-    }
-
-    alarm->activated = false;
-
-    /* Execute the callback function */
-    alarm->callback(alarm->param);
-
-    if (alarm->periodic && alarm->started) {
-        /* Put this alarm back into the active queue */
-        status = _time_to_timestamp(ctx, alarm->microseconds, &timestamp);
+    } else {
+#ifdef BUILD_HAS_TIMER_ALARM_COALESCING
+        _process_due_alarms(ctx, alarm);
+#else
+        _process_alarm(ctx, alarm);
+#endif
 
-        if (status == FWK_SUCCESS) {
-            alarm->timestamp += timestamp;
-            _insert_alarm_ctx_into_active_queue(ctx, alarm);
-        } else {
-            FWK_LOG_ERR(
-                "[Timer] Error: Periodic alarm could not be added "
-                "back into queue.");
-        }
+        _configure_timer_with_next_alarm(ctx);
     }
 
-    _configure_timer_with_next_alarm(ctx);
+#ifdef BUILD_HAS_TIMER_DEFERRED_ALARMS
+    _put_deferred_event(ctx);
+#endif
 }
 
 /*
@@ -617,6 +1084,9 @@ static int timer_device_init(fwk_id_t element_id, unsigned int alarm_count,
     if (alarm_count > 0) {
         ctx->alarm_pool =
             fwk_mm_calloc(alarm_count, sizeof(struct alarm_sub_element_ctx));
+        ctx->alarms_active = fwk_mm_calloc(
+            alarm_count, sizeof(struct alarm_sub_element_ctx *));
+        ctx->alarm_count = alarm_count;
     }
 
     return FWK_SUCCESS;
@@ -711,7 +1181,7 @@ static int timer_start(fwk_id_t id)
 
     ctx = ctx_table + fwk_id_get_element_idx(id);
 
-    fwk_list_init(&ctx->alarms_active);
+    ctx->alarm_active_count = 0;
 
     status = fwk_interrupt_set_isr_param(
         ctx->config->timer_irq, timer_isr, (uintptr_t)ctx);
@@ -722,9 +1192,37 @@ static int timer_start(fwk_id_t id)
     return fwk_interrupt_enable(ctx->config->timer_irq);
 }
 
+#ifdef BUILD_HAS_TIMER_DEFERRED_ALARMS
+static int timer_process_event(
+    const struct fwk_event *event,
+    struct fwk_event *resp_event)
+{
+    struct timer_dev_ctx *ctx;
+    void (*callback)(uintptr_t param);
+    uintptr_t param;
+
+    if (fwk_id_get_event_idx(event->id) != TIMER_EVENT_IDX_DEFERRED_ALARMS) {
+        return FWK_E_PARAM;
+    }
+
+    ctx = ctx_table + fwk_id_get_element_idx(event->target_id);
+
+    /* Run the callbacks in the order the alarms triggered */
+    while (_deferred_queue_pop(ctx, &callback, &param)) {
+        callback(param);
+    }
+
+    return FWK_SUCCESS;
+}
+#endif
+
 /* Module descriptor */
 const struct fwk_module module_timer = {
     .api_count = (unsigned int)MOD_TIMER_API_COUNT,
+#ifdef BUILD_HAS_TIMER_DEFERRED_ALARMS
+    .event_count = (unsigned int)TIMER_EVENT_IDX_COUNT,
+    .process_event = timer_process_event,
+#endif
     .type = FWK_MODULE_TYPE_HAL,
     .init = timer_init,
     .element_init = timer_device_init,
@@ -0,0 +1,335 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_id.h>
+#include <Mockfwk_interrupt.h>
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+
+#include <string.h>
+
+#include UNIT_TEST_SRC
+
+#define TIMER_IRQ       42
+#define ALARM_COUNT     256
+#define TIMER_FREQUENCY 1000000
+
+static struct timer_dev_ctx timer_ctx;
+static struct alarm_sub_element_ctx alarm_pool[ALARM_COUNT];
+static struct alarm_sub_element_ctx *alarms_active[ALARM_COUNT];
+
+static const struct mod_timer_dev_config timer_config = {
+    .timer_irq = TIMER_IRQ,
+};
+
+static uint64_t counter;
+static uint64_t timer_timestamp;
+static unsigned int callback_count;
+
+static int driver_enable(fwk_id_t dev_id)
+{
+    return FWK_SUCCESS;
+}
+
+static int driver_disable(fwk_id_t dev_id)
+{
+    return FWK_SUCCESS;
+}
+
+static int driver_set_timer(fwk_id_t dev_id, uint64_t timestamp)
+{
+    timer_timestamp = timestamp;
+
+    return FWK_SUCCESS;
+}
+
+static int driver_get_counter(fwk_id_t dev_id, uint64_t *value)
+{
+    *value = counter;
+
+    return FWK_SUCCESS;
+}
+
+static int driver_get_frequency(fwk_id_t dev_id, uint32_t *value)
+{
+    *value = TIMER_FREQUENCY;
+
+    return FWK_SUCCESS;
+}
+
+static struct mod_timer_driver_api driver_api = {
+    .enable = driver_enable,
+    .disable = driver_disable,
+    .set_timer = driver_set_timer,
+    .get_counter = driver_get_counter,
+    .get_frequency = driver_get_frequency,
+};
+
+static void alarm_callback(uintptr_t param)
+{
+    callback_count++;
+}
+
+static fwk_id_t alarm_id(unsigned int alarm_idx)
+{
+    return FWK_ID_SUB_ELEMENT(FWK_MODULE_IDX_TIMER, 0, alarm_idx);
+}
+
+static unsigned int get_sub_element_idx_callback(fwk_id_t id, int NumCalls)
+{
+    return id.sub_element.sub_element_idx;
+}
+
+static void activate(unsigned int alarm_idx, uint64_t timestamp)
+{
+    alarm_pool[alarm_idx].timestamp = timestamp;
+    alarm_pool[alarm_idx].started = true;
+    _insert_alarm_ctx_into_active_queue(&timer_ctx, &alarm_pool[alarm_idx]);
+}
+
+static struct alarm_sub_element_ctx *pop(void)
+{
+    struct alarm_sub_element_ctx *alarm = _active_queue_head(&timer_ctx);
+
+    if (alarm != NULL) {
+        _remove_alarm_ctx_from_active_queue(&timer_ctx, alarm);
+    }
+
+    return alarm;
+}
+
+void setUp(void)
+{
+    memset(&timer_ctx, 0, sizeof(timer_ctx));
+    memset(alarm_pool, 0, sizeof(alarm_pool));
+
+    timer_ctx.config = &timer_config;
+    timer_ctx.driver = &driver_api;
+    timer_ctx.alarm_pool = alarm_pool;
+    timer_ctx.alarms_active = alarms_active;
+    timer_ctx.alarm_count = ALARM_COUNT;
+    ctx_table = &timer_ctx;
+
+    counter = 0;
+    timer_timestamp = 0;
+    callback_count = 0;
+
+    fwk_id_get_element_idx_IgnoreAndReturn(0);
+    fwk_id_get_sub_element_idx_StubWithCallback(get_sub_element_idx_callback);
+    fwk_module_is_valid_sub_element_id_IgnoreAndReturn(true);
+    fwk_interrupt_get_current_IgnoreAndReturn(FWK_E_STATE);
+    fwk_interrupt_clear_pending_IgnoreAndReturn(FWK_SUCCESS);
+}
+
+void tearDown(void)
+{
+    fwk_id_get_sub_element_idx_Stub(NULL);
+}
+
+void utest_timer_active_queue_order(void)
+{
+    struct alarm_sub_element_ctx *alarm;
+    uint64_t previous = 0;
+    uint32_t seed = 1;
+    unsigned int i;
+
+    for (i = 0; i < ALARM_COUNT; i++) {
+        seed = (seed * 1103515245) + 12345;
+        activate(i, seed % 1000);
+    }
+
+    for (i = 0; i < ALARM_COUNT; i++) {
+        alarm = pop();
+        TEST_ASSERT_NOT_NULL(alarm);
+        TEST_ASSERT_FALSE(alarm->activated);
+        TEST_ASSERT_TRUE(alarm->timestamp >= previous);
+        previous = alarm->timestamp;
+    }
+
+    TEST_ASSERT_NULL(pop());
+}
+
+void utest_timer_active_queue_same_time(void)
+{
+    activate(3, 100);
+    activate(1, 100);
+    activate(2, 50);
+    activate(0, 100);
+
+    TEST_ASSERT_EQUAL_PTR(&alarm_pool[2], pop());
+    TEST_ASSERT_EQUAL_PTR(&alarm_pool[3], pop());
+    TEST_ASSERT_EQUAL_PTR(&alarm_pool[1], pop());
+    TEST_ASSERT_EQUAL_PTR(&alarm_pool[0], pop());
+}
+
+void utest_timer_alarm_stop(void)
+{
+    int status;
+
+    activate(0, 10);
+    activate(1, 20);
+    activate(2, 30);
+    activate(3, 40);
+
+    status = alarm_stop(alarm_id(1));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_FALSE(alarm_pool[1].activated);
+    TEST_ASSERT_EQUAL(3, timer_ctx.alarm_active_count);
+    TEST_ASSERT_EQUAL(10, timer_timestamp);
+
+    status = alarm_stop(alarm_id(0));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(30, timer_timestamp);
+
+    TEST_ASSERT_EQUAL_PTR(&alarm_pool[2], pop());
+    TEST_ASSERT_EQUAL_PTR(&alarm_pool[3], pop());
+}
+
+void utest_timer_alarm_start(void)
+{
+    int status;
+
+    counter = 1000;
+
+    status = alarm_start(
+        alarm_id(5), 2, MOD_TIMER_ALARM_TYPE_ONCE, alarm_callback, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(3000, timer_timestamp);
+
+    status = alarm_start(
+        alarm_id(6), 1, MOD_TIMER_ALARM_TYPE_ONCE, alarm_callback, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(2000, timer_timestamp);
+
+    /* Restarting an alarm moves it in the queue */
+    status = alarm_start(
+        alarm_id(6), 3, MOD_TIMER_ALARM_TYPE_ONCE, alarm_callback, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(3000, timer_timestamp);
+    TEST_ASSERT_EQUAL(2, timer_ctx.alarm_active_count);
+}
+
+void utest_timer_isr_periodic(void)
+{
+    alarm_pool[0].callback = alarm_callback;
+    alarm_pool[0].periodic = true;
+    alarm_pool[0].microseconds = 100;
+    activate(0, 100);
+
+    alarm_pool[1].callback = alarm_callback;
+    activate(1, 150);
+
+    timer_isr((uintptr_t)&timer_ctx);
+    TEST_ASSERT_EQUAL(1, callback_count);
+    TEST_ASSERT_TRUE(alarm_pool[0].activated);
+    TEST_ASSERT_EQUAL(200, alarm_pool[0].timestamp);
+    TEST_ASSERT_EQUAL(150, timer_timestamp);
+
+    timer_isr((uintptr_t)&timer_ctx);
+    TEST_ASSERT_EQUAL(2, callback_count);
+    TEST_ASSERT_FALSE(alarm_pool[1].activated);
+    TEST_ASSERT_EQUAL(200, timer_timestamp);
+    TEST_ASSERT_EQUAL(1, timer_ctx.alarm_active_count);
+}
+
+#define REARM_ITERATIONS 1000
+
+static unsigned int heap_depth(unsigned int alarm_count)
+{
+    unsigned int depth = 0;
+
+    while ((alarm_count >>= 1) != 0) {
+        depth++;
+    }
+
+    return depth;
+}
+
+/* Check the heap order and the position recorded in each active alarm */
+static void check_active_queue(void)
+{
+    unsigned int i;
+
+    for (i = 0; i < timer_ctx.alarm_active_count; i++) {
+        TEST_ASSERT_EQUAL(i, alarms_active[i]->queue_idx);
+        if (i > 0) {
+            TEST_ASSERT_FALSE(
+                _alarm_precedes(alarms_active[i], alarms_active[(i - 1) / 2]));
+        }
+    }
+}
+
+/*
+ * Re-arm the first periodic alarm to trigger, as the timer ISR does, with
+ * alarm_count alarms in the active queue. Removing the head and inserting the
+ * alarm again each move the alarms along one path of the heap only, so no more
+ * than two paths of queue slots may change.
+ */
+static void rearm_sift_steps_check(unsigned int alarm_count)
+{
+    struct alarm_sub_element_ctx *before[ALARM_COUNT];
+    struct alarm_sub_element_ctx *alarm;
+    unsigned int max_changes = 2 * (heap_depth(alarm_count) + 1);
+    unsigned int changes;
+    unsigned int i, j;
+
+    for (i = 0; i < alarm_count; i++) {
+        alarm_pool[i].microseconds = 100 + (i * 7);
+        activate(i, alarm_pool[i].microseconds);
+    }
+
+    for (i = 0; i < REARM_ITERATIONS; i++) {
+        memcpy(before, alarms_active, alarm_count * sizeof(before[0]));
+
+        alarm = pop();
+        alarm->timestamp += alarm->microseconds;
+        _insert_alarm_ctx_into_active_queue(&timer_ctx, alarm);
+
+        changes = 0;
+        for (j = 0; j < alarm_count; j++) {
+            if (before[j] != alarms_active[j]) {
+                changes++;
+            }
+        }
+
+        TEST_ASSERT_LESS_OR_EQUAL(max_changes, changes);
+        check_active_queue();
+    }
+}
+
+void utest_timer_rearm_sift_steps(void)
+{
+    static const unsigned int alarm_counts[] = { 8, 64, ALARM_COUNT };
+    unsigned int i;
+
+    for (i = 0; i < FWK_ARRAY_SIZE(alarm_counts); i++) {
+        setUp();
+        rearm_sift_steps_check(alarm_counts[i]);
+    }
+}
+
+int timer_test_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(utest_timer_active_queue_order);
+    RUN_TEST(utest_timer_active_queue_same_time);
+    RUN_TEST(utest_timer_alarm_stop);
+    RUN_TEST(utest_timer_alarm_start);
+    RUN_TEST(utest_timer_isr_periodic);
+    RUN_TEST(utest_timer_rearm_sift_steps);
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return timer_test_main();
+}
+#endif
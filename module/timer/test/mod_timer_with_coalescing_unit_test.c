@@ -0,0 +1,257 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_id.h>
+#include <Mockfwk_interrupt.h>
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+
+#include <string.h>
+
+#include UNIT_TEST_SRC
+
+#define TIMER_IRQ       42
+#define ALARM_COUNT     4
+#define TIMER_FREQUENCY 1000000
+
+static struct timer_dev_ctx timer_ctx;
+static struct alarm_sub_element_ctx alarm_pool[ALARM_COUNT];
+static struct alarm_sub_element_ctx *alarms_active[ALARM_COUNT];
+
+static const struct mod_timer_dev_config timer_config = {
+    .timer_irq = TIMER_IRQ,
+};
+
+static uint64_t counter;
+static uint64_t timer_timestamp;
+static unsigned int callback_count[ALARM_COUNT];
+
+static int driver_enable(fwk_id_t dev_id)
+{
+    return FWK_SUCCESS;
+}
+
+static int driver_disable(fwk_id_t dev_id)
+{
+    return FWK_SUCCESS;
+}
+
+static int driver_set_timer(fwk_id_t dev_id, uint64_t timestamp)
+{
+    timer_timestamp = timestamp;
+
+    return FWK_SUCCESS;
+}
+
+static int driver_get_counter(fwk_id_t dev_id, uint64_t *value)
+{
+    *value = counter;
+
+    return FWK_SUCCESS;
+}
+
+static int driver_get_frequency(fwk_id_t dev_id, uint32_t *value)
+{
+    *value = TIMER_FREQUENCY;
+
+    return FWK_SUCCESS;
+}
+
+static struct mod_timer_driver_api driver_api = {
+    .enable = driver_enable,
+    .disable = driver_disable,
+    .set_timer = driver_set_timer,
+    .get_counter = driver_get_counter,
+    .get_frequency = driver_get_frequency,
+};
+
+static void alarm_callback(uintptr_t param)
+{
+    callback_count[param]++;
+}
+
+static fwk_id_t alarm_id(unsigned int alarm_idx)
+{
+    return FWK_ID_SUB_ELEMENT(FWK_MODULE_IDX_TIMER, 0, alarm_idx);
+}
+
+static unsigned int get_sub_element_idx_callback(fwk_id_t id, int NumCalls)
+{
+    return id.sub_element.sub_element_idx;
+}
+
+static void activate(unsigned int alarm_idx, uint64_t timestamp, uint64_t slack)
+{
+    struct alarm_sub_element_ctx *alarm = &alarm_pool[alarm_idx];
+
+    alarm->timestamp = timestamp;
+    alarm->slack = slack;
+    alarm->callback = alarm_callback;
+    alarm->param = alarm_idx;
+    alarm->started = true;
+    _insert_alarm_ctx_into_active_queue(&timer_ctx, alarm);
+}
+
+void setUp(void)
+{
+    memset(&timer_ctx, 0, sizeof(timer_ctx));
+    memset(alarm_pool, 0, sizeof(alarm_pool));
+    memset(callback_count, 0, sizeof(callback_count));
+
+    timer_ctx.config = &timer_config;
+    timer_ctx.driver = &driver_api;
+    timer_ctx.alarm_pool = alarm_pool;
+    timer_ctx.alarms_active = alarms_active;
+    timer_ctx.alarm_count = ALARM_COUNT;
+    ctx_table = &timer_ctx;
+
+    counter = 0;
+    timer_timestamp = 0;
+
+    fwk_id_get_element_idx_IgnoreAndReturn(0);
+    fwk_id_get_sub_element_idx_StubWithCallback(get_sub_element_idx_callback);
+    fwk_module_is_valid_sub_element_id_IgnoreAndReturn(true);
+    fwk_interrupt_get_current_IgnoreAndReturn(FWK_E_STATE);
+    fwk_interrupt_clear_pending_IgnoreAndReturn(FWK_SUCCESS);
+}
+
+void tearDown(void)
+{
+    fwk_id_get_sub_element_idx_Stub(NULL);
+}
+
+void utest_timer_alarm_start_with_slack(void)
+{
+    int status;
+
+    status = alarm_start_with_slack(
+        alarm_id(0), 1, 500, MOD_TIMER_ALARM_TYPE_ONCE, alarm_callback, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1000, alarm_pool[0].timestamp);
+    TEST_ASSERT_EQUAL(500, alarm_pool[0].slack);
+
+    /* The interrupt is raised at the end of the window */
+    TEST_ASSERT_EQUAL(1500, timer_timestamp);
+
+    status = alarm_start(
+        alarm_id(1), 2, MOD_TIMER_ALARM_TYPE_ONCE, alarm_callback, 1);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(0, alarm_pool[1].slack);
+    TEST_ASSERT_EQUAL(1500, timer_timestamp);
+}
+
+void utest_timer_isr_coalesces_due_alarms(void)
+{
+    int status;
+    struct mod_timer_alarm_stats stats;
+
+    activate(0, 1000, 500);
+    activate(1, 1400, 0);
+    activate(2, 1600, 0);
+
+    counter = 1400;
+    timer_isr((uintptr_t)&timer_ctx);
+
+    TEST_ASSERT_EQUAL(1, callback_count[0]);
+    TEST_ASSERT_EQUAL(1, callback_count[1]);
+    TEST_ASSERT_EQUAL(0, callback_count[2]);
+    TEST_ASSERT_EQUAL(1600, timer_timestamp);
+
+    status = get_alarm_stats(FWK_ID_ELEMENT(FWK_MODULE_IDX_TIMER, 0), &stats);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, stats.interrupt_count);
+    TEST_ASSERT_EQUAL(2, stats.alarm_count);
+    TEST_ASSERT_EQUAL(1, stats.coalesced_count);
+    TEST_ASSERT_EQUAL(400, stats.total_delay);
+    TEST_ASSERT_EQUAL(400, stats.max_delay);
+}
+
+/*
+ * Test that an alarm which is due is processed even when an alarm which is not
+ * due expires before it
+ */
+void utest_timer_isr_coalesces_due_alarm_behind_head(void)
+{
+    activate(0, 1000, 0);
+    activate(1, 1500, 0);
+    activate(2, 800, 1200);
+
+    /* The alarm not due comes first in the queue */
+    TEST_ASSERT_EQUAL_PTR(&alarm_pool[1], alarms_active[1]);
+    TEST_ASSERT_EQUAL_PTR(&alarm_pool[2], alarms_active[2]);
+
+    counter = 1000;
+    timer_isr((uintptr_t)&timer_ctx);
+
+    TEST_ASSERT_EQUAL(1, callback_count[0]);
+    TEST_ASSERT_EQUAL(0, callback_count[1]);
+    TEST_ASSERT_EQUAL(1, callback_count[2]);
+    TEST_ASSERT_TRUE(alarm_pool[1].activated);
+    TEST_ASSERT_FALSE(alarm_pool[2].activated);
+    TEST_ASSERT_EQUAL(1500, timer_timestamp);
+    TEST_ASSERT_EQUAL(1, timer_ctx.alarm_stats.coalesced_count);
+}
+
+void utest_timer_isr_leaves_alarms_not_due(void)
+{
+    activate(0, 1500, 500);
+    activate(1, 1400, 0);
+
+    counter = 1400;
+    timer_isr((uintptr_t)&timer_ctx);
+
+    TEST_ASSERT_EQUAL(0, callback_count[0]);
+    TEST_ASSERT_EQUAL(1, callback_count[1]);
+    TEST_ASSERT_TRUE(alarm_pool[0].activated);
+    TEST_ASSERT_EQUAL(2000, timer_timestamp);
+    TEST_ASSERT_EQUAL(0, timer_ctx.alarm_stats.coalesced_count);
+}
+
+void utest_timer_isr_rearmed_alarm_not_reprocessed(void)
+{
+    /* An alarm re-armed already due waits for the next interrupt */
+    activate(0, 1000, 0);
+    alarm_pool[0].periodic = true;
+    alarm_pool[0].microseconds = 0;
+
+    counter = 1000;
+    timer_isr((uintptr_t)&timer_ctx);
+
+    TEST_ASSERT_EQUAL(1, callback_count[0]);
+    TEST_ASSERT_TRUE(alarm_pool[0].activated);
+    TEST_ASSERT_EQUAL(1000, timer_timestamp);
+}
+
+void utest_timer_get_alarm_stats_null(void)
+{
+    int status;
+
+    status = get_alarm_stats(FWK_ID_ELEMENT(FWK_MODULE_IDX_TIMER, 0), NULL);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+int timer_test_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(utest_timer_alarm_start_with_slack);
+    RUN_TEST(utest_timer_isr_coalesces_due_alarms);
+    RUN_TEST(utest_timer_isr_coalesces_due_alarm_behind_head);
+    RUN_TEST(utest_timer_isr_leaves_alarms_not_due);
+    RUN_TEST(utest_timer_isr_rearmed_alarm_not_reprocessed);
+    RUN_TEST(utest_timer_get_alarm_stats_null);
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return timer_test_main();
+}
+#endif
@@ -0,0 +1,241 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_core.h>
+#include <Mockfwk_id.h>
+#include <Mockfwk_interrupt.h>
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+#include <internal/Mockfwk_core_internal.h>
+
+#include <string.h>
+
+#include UNIT_TEST_SRC
+
+#define TIMER_IRQ       42
+#define ALARM_COUNT     4
+#define TIMER_FREQUENCY 1000000
+
+static struct timer_dev_ctx timer_ctx;
+static struct alarm_sub_element_ctx alarm_pool[ALARM_COUNT];
+static struct alarm_sub_element_ctx *alarms_active[ALARM_COUNT];
+
+static const struct mod_timer_dev_config timer_config = {
+    .timer_irq = TIMER_IRQ,
+};
+
+static uint64_t counter;
+static unsigned int callback_order[ALARM_COUNT * 2];
+static unsigned int callback_count;
+
+static struct fwk_event deferred_event = {
+    .id = FWK_ID_EVENT_INIT(
+        FWK_MODULE_IDX_TIMER,
+        TIMER_EVENT_IDX_DEFERRED_ALARMS),
+    .target_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_TIMER, 0),
+};
+
+static int driver_enable(fwk_id_t dev_id)
+{
+    return FWK_SUCCESS;
+}
+
+static int driver_disable(fwk_id_t dev_id)
+{
+    return FWK_SUCCESS;
+}
+
+static int driver_set_timer(fwk_id_t dev_id, uint64_t timestamp)
+{
+    return FWK_SUCCESS;
+}
+
+static int driver_get_counter(fwk_id_t dev_id, uint64_t *value)
+{
+    *value = counter;
+
+    return FWK_SUCCESS;
+}
+
+static int driver_get_frequency(fwk_id_t dev_id, uint32_t *value)
+{
+    *value = TIMER_FREQUENCY;
+
+    return FWK_SUCCESS;
+}
+
+static struct mod_timer_driver_api driver_api = {
+    .enable = driver_enable,
+    .disable = driver_disable,
+    .set_timer = driver_set_timer,
+    .get_counter = driver_get_counter,
+    .get_frequency = driver_get_frequency,
+};
+
+static void alarm_callback(uintptr_t param)
+{
+    TEST_ASSERT_LESS_THAN(FWK_ARRAY_SIZE(callback_order), callback_count);
+
+    callback_order[callback_count++] = param;
+}
+
+static fwk_id_t alarm_id(unsigned int alarm_idx)
+{
+    return FWK_ID_SUB_ELEMENT(FWK_MODULE_IDX_TIMER, 0, alarm_idx);
+}
+
+static unsigned int get_sub_element_idx_callback(fwk_id_t id, int NumCalls)
+{
+    return id.sub_element.sub_element_idx;
+}
+
+static void start(
+    unsigned int alarm_idx,
+    unsigned int milliseconds,
+    enum mod_timer_alarm_type type)
+{
+    int status;
+
+    status = alarm_start(
+        alarm_id(alarm_idx), milliseconds, type, alarm_callback, alarm_idx);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+void setUp(void)
+{
+    memset(&timer_ctx, 0, sizeof(timer_ctx));
+    memset(alarm_pool, 0, sizeof(alarm_pool));
+
+    timer_ctx.config = &timer_config;
+    timer_ctx.driver = &driver_api;
+    timer_ctx.alarm_pool = alarm_pool;
+    timer_ctx.alarms_active = alarms_active;
+    timer_ctx.alarm_count = ALARM_COUNT;
+    ctx_table = &timer_ctx;
+
+    counter = 0;
+    callback_count = 0;
+
+    fwk_id_get_element_idx_IgnoreAndReturn(0);
+    fwk_id_get_event_idx_IgnoreAndReturn(TIMER_EVENT_IDX_DEFERRED_ALARMS);
+    fwk_id_get_sub_element_idx_StubWithCallback(get_sub_element_idx_callback);
+    fwk_module_is_valid_sub_element_id_IgnoreAndReturn(true);
+    fwk_interrupt_get_current_IgnoreAndReturn(FWK_E_STATE);
+    fwk_interrupt_clear_pending_IgnoreAndReturn(FWK_SUCCESS);
+}
+
+void tearDown(void)
+{
+    fwk_id_get_sub_element_idx_Stub(NULL);
+}
+
+void utest_timer_deferred_alarms_batched(void)
+{
+    int status;
+
+    start(0, 1, MOD_TIMER_ALARM_TYPE_PERIODIC_DEFERRED);
+    start(1, 2, MOD_TIMER_ALARM_TYPE_ONCE_DEFERRED);
+    start(2, 3, MOD_TIMER_ALARM_TYPE_ONCE);
+
+    /* A single event is put for all the deferred callbacks */
+    __fwk_put_event_light_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+
+    counter = 1000;
+    timer_isr((uintptr_t)&timer_ctx);
+    counter = 2000;
+    timer_isr((uintptr_t)&timer_ctx);
+
+    /* The periodic alarm triggers again while its callback is pending */
+    timer_isr((uintptr_t)&timer_ctx);
+    TEST_ASSERT_EQUAL(0, callback_count);
+    TEST_ASSERT_TRUE(alarm_pool[0].activated);
+
+    /* Non-deferred alarms still run in the interrupt */
+    counter = 3000;
+    timer_isr((uintptr_t)&timer_ctx);
+    TEST_ASSERT_EQUAL(1, callback_count);
+    TEST_ASSERT_EQUAL(2, callback_order[0]);
+
+    status = timer_process_event(&deferred_event, NULL);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(3, callback_count);
+    TEST_ASSERT_EQUAL(0, callback_order[1]);
+    TEST_ASSERT_EQUAL(1, callback_order[2]);
+    TEST_ASSERT_FALSE(timer_ctx.deferred_event_pending);
+    TEST_ASSERT_NULL(timer_ctx.deferred_head);
+
+    /* The next trigger puts a new event */
+    __fwk_put_event_light_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    timer_isr((uintptr_t)&timer_ctx);
+    TEST_ASSERT_TRUE(timer_ctx.deferred_event_pending);
+}
+
+void utest_timer_deferred_alarm_stopped(void)
+{
+    int status;
+
+    start(0, 1, MOD_TIMER_ALARM_TYPE_ONCE_DEFERRED);
+    start(1, 1, MOD_TIMER_ALARM_TYPE_ONCE_DEFERRED);
+
+    __fwk_put_event_light_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+
+    counter = 1000;
+    timer_isr((uintptr_t)&timer_ctx);
+    timer_isr((uintptr_t)&timer_ctx);
+
+    /* Stopping an alarm drops its pending callback */
+    status = alarm_stop(alarm_id(1));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL_PTR(&alarm_pool[0], timer_ctx.deferred_tail);
+
+    status = timer_process_event(&deferred_event, NULL);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, callback_count);
+    TEST_ASSERT_EQUAL(0, callback_order[0]);
+}
+
+void utest_timer_deferred_event_put_failure(void)
+{
+    start(0, 1, MOD_TIMER_ALARM_TYPE_ONCE_DEFERRED);
+    start(1, 2, MOD_TIMER_ALARM_TYPE_ONCE);
+
+    __fwk_put_event_light_ExpectAnyArgsAndReturn(FWK_E_NOMEM);
+
+    counter = 1000;
+    timer_isr((uintptr_t)&timer_ctx);
+    TEST_ASSERT_FALSE(timer_ctx.deferred_event_pending);
+    TEST_ASSERT_EQUAL_PTR(&alarm_pool[0], timer_ctx.deferred_head);
+
+    /* The event is put again on the next interrupt, even for another alarm */
+    __fwk_put_event_light_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+
+    counter = 2000;
+    timer_isr((uintptr_t)&timer_ctx);
+    TEST_ASSERT_EQUAL(1, callback_count);
+    TEST_ASSERT_EQUAL(1, callback_order[0]);
+    TEST_ASSERT_TRUE(timer_ctx.deferred_event_pending);
+    TEST_ASSERT_EQUAL_PTR(&alarm_pool[0], timer_ctx.deferred_head);
+}
+
+int timer_test_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(utest_timer_deferred_alarms_batched);
+    RUN_TEST(utest_timer_deferred_alarm_stopped);
+    RUN_TEST(utest_timer_deferred_event_put_failure);
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return timer_test_main();
+}
+#endif
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -24,4 +24,8 @@
 #define MOD_TRANSPORT_MAILBOX_STATUS_ERROR_MASK \
     (UINT32_C(0x1) << MOD_TRANSPORT_MAILBOX_STATUS_ERROR_POS)
 
+#define MOD_TRANSPORT_MESSAGE_HEADER_TOKEN_POS 18
+#define MOD_TRANSPORT_MESSAGE_HEADER_TOKEN_MASK \
+    (UINT32_C(0x3FF) << MOD_TRANSPORT_MESSAGE_HEADER_TOKEN_POS)
+
 #endif /* TRANSPORT_INTERNAL_H */
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2022-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -85,6 +85,15 @@ struct mod_transport_buffer {
  */
 #define MOD_TRANSPORT_POLICY_INIT_MAILBOX ((uint32_t)(1U << 1))
 
+/*!
+ * The response payload is written in place in the shared mailbox instead of
+ * being copied to an internal write buffer first. The request is still copied
+ * to the internal read buffer on reception, so the service reads a snapshot
+ * that the requester cannot modify and that is not overwritten by the
+ * response. Only relevant for out-band type transport channels.
+ */
+#define MOD_TRANSPORT_POLICY_ZERO_COPY ((uint32_t)(1U << 2))
+
 /*!
  * @}
  */
@@ -242,6 +251,19 @@ struct mod_transport_channel_config {
 
     /*! Identifier of the driver API to bind to */
     fwk_id_t driver_api_id;
+
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+    /*!
+     * \brief Number of message slots of the channel (optional).
+     *
+     * \details The out-band shared mailbox is made of `slot_count` consecutive
+     *      mailboxes of `out_band_mailbox_size` bytes each, allowing the
+     *      requester to have one message outstanding per slot. Zero or one
+     *      selects a single slot. Only relevant for out-band completer
+     *      channels.
+     */
+    unsigned int slot_count;
+#endif
 };
 
 /*!
@@ -537,6 +559,43 @@ struct mod_transport_firmware_api {
      *      errors
      */
     int (*trigger_interrupt)(fwk_id_t channel_id);
+
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+    /*!
+     * \brief Defer the response to the message being processed.
+     *
+     * \details The slot of the message stays reserved until the message is
+     *      resumed with ::mod_transport_firmware_api::resume_message and
+     *      responded to. Messages waiting in the other slots of the channel
+     *      are delivered in the meantime.
+     *
+     * \param channel_id Channel identifier.
+     *
+     * \retval ::FWK_SUCCESS The operation succeeded.
+     * \retval ::FWK_E_ACCESS No message is being processed.
+     * \retval ::FWK_E_SUPPORT The channel has a single message slot.
+     * \return One of the standard error codes for implementation-defined
+     *      errors.
+     */
+    int (*defer_message)(fwk_id_t channel_id);
+
+    /*!
+     * \brief Resume a deferred message so that it can be responded to.
+     *
+     * \details Once resumed, the message header, payload and response
+     *      functions of this API operate on the deferred message until it is
+     *      responded to or its lock is released.
+     *
+     * \param channel_id Channel identifier.
+     * \param token Token of the deferred message.
+     *
+     * \retval ::FWK_SUCCESS The operation succeeded.
+     * \retval ::FWK_E_PARAM No deferred message has the given token.
+     * \retval ::FWK_E_BUSY Another resumed message has not been completed.
+     * \retval ::FWK_E_SUPPORT The channel has a single message slot.
+     */
+    int (*resume_message)(fwk_id_t channel_id, uint32_t token);
+#endif
 };
 
 /*!
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2022-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -34,6 +34,7 @@
 #include <fwk_string.h>
 
 #include <stdbool.h>
+#include <stddef.h>
 
 #define MOD_NAME "[TRANSPORT]"
 
@@ -42,6 +43,38 @@
 #    error "Transport module used without outband or inband message support."
 #endif
 
+#if defined(BUILD_HAS_TRANSPORT_MULTI_SLOT) && \
+    !defined(BUILD_HAS_OUTBAND_MSG_SUPPORT)
+#    error "Transport multi-slot channels require outband message support."
+#endif
+
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+enum transport_slot_state {
+    /* The slot is owned by the requester */
+    TRANSPORT_SLOT_STATE_FREE,
+
+    /* The message in the slot is being processed */
+    TRANSPORT_SLOT_STATE_ACTIVE,
+
+    /* The response to the message in the slot has been deferred */
+    TRANSPORT_SLOT_STATE_DEFERRED,
+};
+
+struct transport_slot_ctx {
+    /* Shared mailbox of the slot */
+    struct mod_transport_buffer *mailbox;
+
+    /* Slot read and write buffer areas */
+    struct mod_transport_buffer *in, *out;
+
+    /* Slot state */
+    enum transport_slot_state state;
+
+    /* Token of the deferred message */
+    uint32_t token;
+};
+#endif
+
 struct transport_channel_ctx {
     /* Channel identifier */
     fwk_id_t id;
@@ -85,6 +118,23 @@ struct transport_channel_ctx {
      * the channel
      */
     unsigned int wait_on_notifications;
+
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+    /* Table of message slot contexts, NULL for single-slot channels */
+    struct transport_slot_ctx *slot_table;
+
+    /* Number of message slots */
+    unsigned int slot_count;
+
+    /* Index of the slot to look at first for the next incoming message */
+    unsigned int next_slot_idx;
+
+    /* Slot of the message being processed, in and out refer to its buffers */
+    struct transport_slot_ctx *current_slot;
+
+    /* Slot interrupted by the resumption of a deferred message */
+    struct transport_slot_ctx *preempted_slot;
+#endif
 };
 
 struct transport_context {
@@ -97,6 +147,140 @@ struct transport_context {
 
 static struct transport_context transport_ctx;
 
+#if defined(BUILD_HAS_OUTBAND_MSG_SUPPORT)
+static struct mod_transport_buffer *transport_get_mailbox(
+    struct transport_channel_ctx *channel_ctx)
+{
+#    ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+    if (channel_ctx->current_slot != NULL) {
+        return channel_ctx->current_slot->mailbox;
+    }
+#    endif
+
+    return (struct mod_transport_buffer *)
+        channel_ctx->config->out_band_mailbox_address;
+}
+
+static bool transport_is_zero_copy(struct transport_channel_ctx *channel_ctx)
+{
+    return (channel_ctx->config->transport_type ==
+            MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_OUT_BAND) &&
+        ((channel_ctx->config->policies & MOD_TRANSPORT_POLICY_ZERO_COPY) !=
+         (uint32_t)0);
+}
+
+/*
+ * Size of the write buffer of an out-band channel. Zero-copy channels write
+ * the response payload in place and only keep a copy of the message header.
+ */
+static size_t transport_out_band_write_buffer_size(
+    struct transport_channel_ctx *channel_ctx)
+{
+    if (transport_is_zero_copy(channel_ctx)) {
+        return sizeof(struct mod_transport_buffer);
+    }
+
+    return channel_ctx->config->out_band_mailbox_size;
+}
+#endif
+
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+static int transport_message_handler(struct transport_channel_ctx *channel_ctx);
+
+/*
+ * Make the preempted slot, if any, the slot being processed again. Must be
+ * called with interrupts disabled.
+ */
+static void transport_slot_restore(struct transport_channel_ctx *channel_ctx)
+{
+    struct transport_slot_ctx *slot = channel_ctx->preempted_slot;
+
+    channel_ctx->preempted_slot = NULL;
+    channel_ctx->current_slot = slot;
+
+    if (slot != NULL) {
+        channel_ctx->in = slot->in;
+        channel_ctx->out = slot->out;
+        channel_ctx->locked = true;
+    } else {
+        channel_ctx->locked = false;
+    }
+}
+
+/*
+ * Release the slot being processed once the message has been completed. Must
+ * be called with interrupts disabled.
+ */
+static void transport_slot_complete(struct transport_channel_ctx *channel_ctx)
+{
+    if (channel_ctx->current_slot == NULL) {
+        return;
+    }
+
+    channel_ctx->current_slot->state = TRANSPORT_SLOT_STATE_FREE;
+    transport_slot_restore(channel_ctx);
+}
+
+/*
+ * Deliver the next message waiting in a slot of the channel, if no other
+ * message is being processed. The slots are scanned round-robin so that a
+ * requester filling the low slots cannot starve the others.
+ */
+static int transport_slot_message_handler(
+    struct transport_channel_ctx *channel_ctx)
+{
+    struct transport_slot_ctx *slot = NULL;
+    unsigned int flags;
+    unsigned int i;
+    unsigned int slot_idx;
+    int status;
+
+    flags = fwk_interrupt_global_disable();
+
+    if (channel_ctx->current_slot != NULL) {
+        /* The message is picked up when the current one is completed */
+        fwk_interrupt_global_enable(flags);
+        return FWK_SUCCESS;
+    }
+
+    for (i = 0; i < channel_ctx->slot_count; i++) {
+        slot_idx = (channel_ctx->next_slot_idx + i) % channel_ctx->slot_count;
+        if ((channel_ctx->slot_table[slot_idx].state ==
+             TRANSPORT_SLOT_STATE_FREE) &&
+            ((channel_ctx->slot_table[slot_idx].mailbox->status &
+              MOD_TRANSPORT_MAILBOX_STATUS_FREE_MASK) == (uint32_t)0)) {
+            slot = &channel_ctx->slot_table[slot_idx];
+            channel_ctx->next_slot_idx =
+                (slot_idx + 1) % channel_ctx->slot_count;
+            break;
+        }
+    }
+
+    if (slot == NULL) {
+        fwk_interrupt_global_enable(flags);
+        return FWK_SUCCESS;
+    }
+
+    slot->state = TRANSPORT_SLOT_STATE_ACTIVE;
+    channel_ctx->current_slot = slot;
+    channel_ctx->in = slot->in;
+    channel_ctx->out = slot->out;
+
+    fwk_interrupt_global_enable(flags);
+
+    status = transport_message_handler(channel_ctx);
+    if ((status != FWK_SUCCESS) && !channel_ctx->locked) {
+        /* The message was not accepted, give the slot up */
+        flags = fwk_interrupt_global_disable();
+        slot->state = TRANSPORT_SLOT_STATE_FREE;
+        channel_ctx->current_slot = NULL;
+        fwk_interrupt_global_enable(flags);
+    }
+
+    return status;
+}
+#endif
+
 /*
  * SCMI module Transport API
  */
@@ -198,6 +382,7 @@ static int transport_write_payload(
     size_t size)
 {
     struct transport_channel_ctx *channel_ctx;
+    struct mod_transport_buffer *buffer;
 
     channel_ctx =
         &transport_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
@@ -216,8 +401,15 @@ static int transport_write_payload(
         return FWK_E_ACCESS;
     }
 
-    fwk_str_memcpy(
-        ((uint8_t *)channel_ctx->out->payload) + offset, payload, size);
+    buffer = channel_ctx->out;
+
+#if defined(BUILD_HAS_OUTBAND_MSG_SUPPORT)
+    if (transport_is_zero_copy(channel_ctx)) {
+        buffer = transport_get_mailbox(channel_ctx);
+    }
+#endif
+
+    fwk_str_memcpy(((uint8_t *)buffer->payload) + offset, payload, size);
 
     return FWK_SUCCESS;
 }
@@ -243,21 +435,35 @@ static int transport_respond(
 #if defined(BUILD_HAS_OUTBAND_MSG_SUPPORT)
     if (transport_type == MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_OUT_BAND) {
         /* Use shared mailbox for out-band messages */
-        buffer = ((struct mod_transport_buffer *)
-                      channel_ctx->config->out_band_mailbox_address);
-
-        /* Copy the header and other fields from the write buffer */
-        fwk_str_memcpy(
-            buffer, channel_ctx->out, sizeof(struct mod_transport_buffer));
+        buffer = transport_get_mailbox(channel_ctx);
 
         /*
-         * Copy the payload from either the write buffer or the payload
-         * parameter.
+         * Copy the header and other fields from the write buffer, leaving out
+         * the structure padding which overlaps the start of the payload.
          */
         fwk_str_memcpy(
-            buffer->payload,
-            (payload == NULL ? channel_ctx->out->payload : payload),
-            size);
+            buffer,
+            channel_ctx->out,
+            offsetof(struct mod_transport_buffer, payload));
+
+        if (transport_is_zero_copy(channel_ctx)) {
+            /*
+             * The payload written with write_payload() is already in place,
+             * only a payload given as parameter needs to be copied.
+             */
+            if ((payload != NULL) && (payload != buffer->payload)) {
+                fwk_str_memcpy(buffer->payload, payload, size);
+            }
+        } else {
+            /*
+             * Copy the payload from either the write buffer or the payload
+             * parameter.
+             */
+            fwk_str_memcpy(
+                buffer->payload,
+                (payload == NULL ? channel_ctx->out->payload : payload),
+                size);
+        }
     }
 #else
 #    if defined(BUILD_HAS_INBAND_MSG_SUPPORT)
@@ -292,6 +498,10 @@ static int transport_respond(
     /* The mailbox status is relevant for out-band transport only */
     buffer->status |= MOD_TRANSPORT_MAILBOX_STATUS_FREE_MASK;
 
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+    transport_slot_complete(channel_ctx);
+#endif
+
     fwk_interrupt_global_enable(flags);
 
 #if defined(BUILD_HAS_INBAND_MSG_SUPPORT)
@@ -311,6 +521,13 @@ static int transport_respond(
             channel_ctx->config->driver_id);
     }
 
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+    if ((status == FWK_SUCCESS) && (channel_ctx->slot_table != NULL)) {
+        /* Deliver a message that arrived while the slot was in use */
+        status = transport_slot_message_handler(channel_ctx);
+    }
+#endif
+
     return status;
 }
 
@@ -426,6 +643,23 @@ static int transport_release_channel_lock(fwk_id_t channel_id)
      * where the channel context is locked and never released since it is the
      * transport_respond() function that releases the channel context.
      */
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+    if (channel_ctx->slot_table != NULL) {
+        unsigned int flags;
+
+        /* Hand the slot back to the requester */
+        flags = fwk_interrupt_global_disable();
+        if (channel_ctx->current_slot != NULL) {
+            channel_ctx->current_slot->mailbox->status |=
+                MOD_TRANSPORT_MAILBOX_STATUS_FREE_MASK;
+            transport_slot_complete(channel_ctx);
+        }
+        fwk_interrupt_global_enable(flags);
+
+        return transport_slot_message_handler(channel_ctx);
+    }
+#endif
+
     channel_ctx->locked = false;
     return FWK_SUCCESS;
 }
@@ -445,6 +679,84 @@ static int transport_trigger_interrupt(fwk_id_t channel_id)
         channel_ctx->config->driver_id);
 }
 
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+static int transport_defer_message(fwk_id_t channel_id)
+{
+    struct transport_channel_ctx *channel_ctx;
+    struct transport_slot_ctx *slot;
+    unsigned int flags;
+
+    channel_ctx =
+        &transport_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+
+    if (channel_ctx->slot_table == NULL) {
+        return FWK_E_SUPPORT;
+    }
+
+    flags = fwk_interrupt_global_disable();
+
+    slot = channel_ctx->current_slot;
+    if (slot == NULL) {
+        fwk_interrupt_global_enable(flags);
+        return FWK_E_ACCESS;
+    }
+
+    slot->state = TRANSPORT_SLOT_STATE_DEFERRED;
+    slot->token =
+        (slot->in->message_header & MOD_TRANSPORT_MESSAGE_HEADER_TOKEN_MASK) >>
+        MOD_TRANSPORT_MESSAGE_HEADER_TOKEN_POS;
+    transport_slot_restore(channel_ctx);
+
+    fwk_interrupt_global_enable(flags);
+
+    return transport_slot_message_handler(channel_ctx);
+}
+
+static int transport_resume_message(fwk_id_t channel_id, uint32_t token)
+{
+    struct transport_channel_ctx *channel_ctx;
+    struct transport_slot_ctx *slot;
+    unsigned int flags;
+    unsigned int slot_idx;
+
+    channel_ctx =
+        &transport_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+
+    if (channel_ctx->slot_table == NULL) {
+        return FWK_E_SUPPORT;
+    }
+
+    if (channel_ctx->preempted_slot != NULL) {
+        return FWK_E_BUSY;
+    }
+
+    for (slot_idx = 0; slot_idx < channel_ctx->slot_count; slot_idx++) {
+        slot = &channel_ctx->slot_table[slot_idx];
+        if ((slot->state == TRANSPORT_SLOT_STATE_DEFERRED) &&
+            (slot->token == token)) {
+            break;
+        }
+    }
+
+    if (slot_idx == channel_ctx->slot_count) {
+        return FWK_E_PARAM;
+    }
+
+    flags = fwk_interrupt_global_disable();
+
+    slot->state = TRANSPORT_SLOT_STATE_ACTIVE;
+    channel_ctx->preempted_slot = channel_ctx->current_slot;
+    channel_ctx->current_slot = slot;
+    channel_ctx->in = slot->in;
+    channel_ctx->out = slot->out;
+    channel_ctx->locked = true;
+
+    fwk_interrupt_global_enable(flags);
+
+    return FWK_SUCCESS;
+}
+#endif
+
 #ifdef BUILD_HAS_MOD_SCMI
 static const struct mod_scmi_to_transport_api
     transport_mod_scmi_to_transport_api = {
@@ -456,6 +768,10 @@ static const struct mod_scmi_to_transport_api
         .respond = transport_respond,
         .transmit = transport_transmit,
         .release_transport_channel_lock = transport_release_channel_lock,
+#    ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+        .defer_message = transport_defer_message,
+        .resume_message = transport_resume_message,
+#    endif
     };
 #endif
 
@@ -469,6 +785,10 @@ static const struct mod_transport_firmware_api transport_firmware_api = {
     .transmit = transport_transmit,
     .release_transport_channel_lock = transport_release_channel_lock,
     .trigger_interrupt = transport_trigger_interrupt,
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+    .defer_message = transport_defer_message,
+    .resume_message = transport_resume_message,
+#endif
 };
 
 #ifdef BUILD_HAS_MOD_TRANSPORT_FC
@@ -611,8 +931,7 @@ static int transport_message_handler(struct transport_channel_ctx *channel_ctx)
     transport_type = channel_ctx->config->transport_type;
 #if defined(BUILD_HAS_OUTBAND_MSG_SUPPORT)
     if (transport_type == MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_OUT_BAND) {
-        shared_memory = ((struct mod_transport_buffer *)
-                             channel_ctx->config->out_band_mailbox_address);
+        shared_memory = transport_get_mailbox(channel_ctx);
 
         if (channel_ctx->config->channel_type ==
             MOD_TRANSPORT_CHANNEL_TYPE_COMPLETER) {
@@ -711,8 +1030,7 @@ static int transport_message_handler(struct transport_channel_ctx *channel_ctx)
 
 #if defined(BUILD_HAS_OUTBAND_MSG_SUPPORT)
     if (transport_type == MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_OUT_BAND) {
-        shared_memory = ((struct mod_transport_buffer *)
-                             channel_ctx->config->out_band_mailbox_address);
+        shared_memory = transport_get_mailbox(channel_ctx);
 
         payload_size = in->length - sizeof(in->message_header);
         if (payload_size != 0) {
@@ -784,6 +1102,12 @@ static int transport_signal_message(fwk_id_t channel_id)
     }
 #endif
 
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+    if (channel_ctx->slot_table != NULL) {
+        return transport_slot_message_handler(channel_ctx);
+    }
+#endif
+
     return transport_message_handler(channel_ctx);
 }
 
@@ -808,6 +1132,15 @@ static int transport_mailbox_init(struct transport_channel_ctx *channel_ctx)
                 (struct mod_transport_buffer){
                     .status = (1U << MOD_TRANSPORT_MAILBOX_STATUS_FREE_POS)
                 };
+
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+            for (unsigned int i = 1; i < channel_ctx->slot_count; i++) {
+                *channel_ctx->slot_table[i].mailbox =
+                    (struct mod_transport_buffer){
+                        .status = (1U << MOD_TRANSPORT_MAILBOX_STATUS_FREE_POS)
+                    };
+            }
+#endif
         }
         /* Notify that this mailbox is initialized */
         struct fwk_event transport_channel_initialized_notification = {
@@ -823,6 +1156,36 @@ static int transport_mailbox_init(struct transport_channel_ctx *channel_ctx)
     return status;
 }
 
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+static void transport_slot_init(struct transport_channel_ctx *channel_ctx)
+{
+    struct transport_slot_ctx *slot;
+    size_t mailbox_size = channel_ctx->config->out_band_mailbox_size;
+    unsigned int slot_idx;
+
+    channel_ctx->slot_count = channel_ctx->config->slot_count;
+    channel_ctx->slot_table = fwk_mm_calloc(
+        channel_ctx->slot_count, sizeof(channel_ctx->slot_table[0]));
+
+    for (slot_idx = 0; slot_idx < channel_ctx->slot_count; slot_idx++) {
+        slot = &channel_ctx->slot_table[slot_idx];
+        slot->mailbox = (struct mod_transport_buffer
+                             *)(channel_ctx->config->out_band_mailbox_address +
+                                (slot_idx * mailbox_size));
+
+        /* The first slot reuses the channel buffers */
+        if (slot_idx == 0) {
+            slot->in = channel_ctx->in;
+            slot->out = channel_ctx->out;
+        } else {
+            slot->in = fwk_mm_alloc(1, mailbox_size);
+            slot->out = fwk_mm_alloc(
+                1, transport_out_band_write_buffer_size(channel_ctx));
+        }
+    }
+}
+#endif
+
 /*
  * Framework API
  */
@@ -878,6 +1241,18 @@ static int transport_channel_init(
         return FWK_E_DATA;
     }
 #endif
+
+#ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+    /* Only out-band completer channels can have more than one slot */
+    if ((channel_ctx->config->slot_count > 1) &&
+        ((channel_ctx->config->transport_type !=
+          MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_OUT_BAND) ||
+         (channel_ctx->config->channel_type !=
+          MOD_TRANSPORT_CHANNEL_TYPE_COMPLETER))) {
+        fwk_unexpected();
+        return FWK_E_DATA;
+    }
+#endif
     channel_ctx->id = channel_id;
 
     switch (channel_ctx->config->transport_type) {
@@ -885,11 +1260,16 @@ static int transport_channel_init(
     case MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_OUT_BAND:
         channel_ctx->in =
             fwk_mm_alloc(1, channel_ctx->config->out_band_mailbox_size);
-        channel_ctx->out =
-            fwk_mm_alloc(1, channel_ctx->config->out_band_mailbox_size);
+        channel_ctx->out = fwk_mm_alloc(
+            1, transport_out_band_write_buffer_size(channel_ctx));
         channel_ctx->max_payload_size =
             channel_ctx->config->out_band_mailbox_size -
             sizeof(struct mod_transport_buffer);
+#    ifdef BUILD_HAS_TRANSPORT_MULTI_SLOT
+        if (channel_ctx->config->slot_count > 1) {
+            transport_slot_init(channel_ctx);
+        }
+#    endif
         break;
 #endif
 
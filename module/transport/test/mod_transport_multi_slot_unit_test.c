@@ -0,0 +1,313 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_id.h>
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include UNIT_TEST_SRC
+
+#define SLOT_COUNT   3
+#define MAILBOX_SIZE 64
+
+enum fake_channel_idx {
+    FAKE_CHANNEL_IDX_MULTI_SLOT,
+    FAKE_CHANNEL_IDX_SINGLE_SLOT,
+    FAKE_CHANNEL_IDX_COUNT,
+};
+
+static uint64_t shared_memory[FAKE_CHANNEL_IDX_COUNT]
+                             [SLOT_COUNT * MAILBOX_SIZE / sizeof(uint64_t)];
+
+static struct mod_transport_channel_config channel_config[] = {
+    [FAKE_CHANNEL_IDX_MULTI_SLOT] = {
+        .transport_type = MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_OUT_BAND,
+        .channel_type = MOD_TRANSPORT_CHANNEL_TYPE_COMPLETER,
+        .out_band_mailbox_address =
+            (uintptr_t)shared_memory[FAKE_CHANNEL_IDX_MULTI_SLOT],
+        .out_band_mailbox_size = MAILBOX_SIZE,
+        .slot_count = SLOT_COUNT,
+    },
+    [FAKE_CHANNEL_IDX_SINGLE_SLOT] = {
+        .transport_type = MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_OUT_BAND,
+        .channel_type = MOD_TRANSPORT_CHANNEL_TYPE_COMPLETER,
+        .out_band_mailbox_address =
+            (uintptr_t)shared_memory[FAKE_CHANNEL_IDX_SINGLE_SLOT],
+        .out_band_mailbox_size = MAILBOX_SIZE,
+    },
+};
+
+static const fwk_id_t multi_slot_id =
+    FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_TRANSPORT, FAKE_CHANNEL_IDX_MULTI_SLOT);
+static const fwk_id_t single_slot_id =
+    FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_TRANSPORT, FAKE_CHANNEL_IDX_SINGLE_SLOT);
+
+static unsigned int signal_count;
+static uint32_t signaled_token;
+
+static uint32_t header_token(uint32_t header)
+{
+    return (header & MOD_TRANSPORT_MESSAGE_HEADER_TOKEN_MASK) >>
+        MOD_TRANSPORT_MESSAGE_HEADER_TOKEN_POS;
+}
+
+static int signal_message(fwk_id_t service_id)
+{
+    uint32_t header;
+
+    signal_count++;
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS, transport_get_message_header(multi_slot_id, &header));
+    signaled_token = header_token(header);
+
+    return FWK_SUCCESS;
+}
+
+static int signal_error(fwk_id_t service_id)
+{
+    TEST_FAIL();
+
+    return FWK_E_STATE;
+}
+
+static struct mod_transport_firmware_signal_api signal_api = {
+    .signal_error = signal_error,
+    .signal_message = signal_message,
+};
+
+static int trigger_event(fwk_id_t device_id)
+{
+    return FWK_SUCCESS;
+}
+
+static struct mod_transport_driver_api driver_api = {
+    .trigger_event = trigger_event,
+};
+
+static void *alloc_callback(size_t num, size_t size, int NumCalls)
+{
+    return calloc(num, size);
+}
+
+static unsigned int get_element_idx_callback(fwk_id_t id, int NumCalls)
+{
+    return id.element.element_idx;
+}
+
+static struct mod_transport_buffer *slot_mailbox(unsigned int slot_idx)
+{
+    return (struct mod_transport_buffer
+                *)(channel_config[FAKE_CHANNEL_IDX_MULTI_SLOT]
+                       .out_band_mailbox_address +
+                   (slot_idx * MAILBOX_SIZE));
+}
+
+/* Requester side: post a message with a given token in a slot */
+static void post_message(unsigned int slot_idx, uint32_t token)
+{
+    struct mod_transport_buffer *mailbox = slot_mailbox(slot_idx);
+
+    mailbox->message_header = token << MOD_TRANSPORT_MESSAGE_HEADER_TOKEN_POS;
+    mailbox->payload[0] = token;
+    mailbox->length = sizeof(mailbox->message_header) + sizeof(uint32_t);
+    mailbox->flags = 0;
+    mailbox->status &= ~MOD_TRANSPORT_MAILBOX_STATUS_FREE_MASK;
+}
+
+static bool slot_is_free(unsigned int slot_idx)
+{
+    return (slot_mailbox(slot_idx)->status &
+            MOD_TRANSPORT_MAILBOX_STATUS_FREE_MASK) != 0;
+}
+
+static uint32_t current_token(void)
+{
+    uint32_t header;
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS, transport_get_message_header(multi_slot_id, &header));
+
+    return header_token(header);
+}
+
+static int respond(void)
+{
+    uint32_t response = 0;
+
+    return transport_respond(multi_slot_id, &response, sizeof(response));
+}
+
+void setUp(void)
+{
+    struct transport_channel_ctx *channel_ctx;
+    unsigned int channel_idx;
+    unsigned int slot_idx;
+
+    memset(shared_memory, 0, sizeof(shared_memory));
+    signal_count = 0;
+
+    fwk_mm_calloc_StubWithCallback(alloc_callback);
+    fwk_mm_alloc_StubWithCallback(alloc_callback);
+    fwk_id_get_element_idx_StubWithCallback(get_element_idx_callback);
+
+    transport_init(fwk_module_id_transport, FAKE_CHANNEL_IDX_COUNT, NULL);
+
+    for (channel_idx = 0; channel_idx < FAKE_CHANNEL_IDX_COUNT;
+         channel_idx++) {
+        TEST_ASSERT_EQUAL(
+            FWK_SUCCESS,
+            transport_channel_init(
+                FWK_ID_ELEMENT(FWK_MODULE_IDX_TRANSPORT, channel_idx),
+                0,
+                &channel_config[channel_idx]));
+
+        channel_ctx = &transport_ctx.channel_ctx_table[channel_idx];
+        channel_ctx->service_id = FWK_ID_MODULE(FWK_MODULE_IDX_FAKE_SERVICE);
+        channel_ctx->transport_signal.firmware_signal_api = &signal_api;
+        channel_ctx->driver_api = &driver_api;
+        channel_ctx->out_band_mailbox_ready = true;
+    }
+
+    /* The requester owns all the slots */
+    for (slot_idx = 0; slot_idx < SLOT_COUNT; slot_idx++) {
+        slot_mailbox(slot_idx)->status = MOD_TRANSPORT_MAILBOX_STATUS_FREE_MASK;
+    }
+}
+
+void tearDown(void)
+{
+    fwk_mm_calloc_Stub(NULL);
+    fwk_mm_alloc_Stub(NULL);
+    fwk_id_get_element_idx_Stub(NULL);
+}
+
+/*
+ * Test that a message waiting in a slot is delivered only once the message
+ * being processed is deferred
+ */
+void test_multi_slot_defer_delivers_next(void)
+{
+    post_message(0, 0x10);
+    post_message(1, 0x11);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, transport_signal_message(multi_slot_id));
+    TEST_ASSERT_EQUAL(1, signal_count);
+    TEST_ASSERT_EQUAL(0x10, signaled_token);
+
+    /* The channel is busy with the first message */
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, transport_signal_message(multi_slot_id));
+    TEST_ASSERT_EQUAL(1, signal_count);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, transport_defer_message(multi_slot_id));
+    TEST_ASSERT_EQUAL(2, signal_count);
+    TEST_ASSERT_EQUAL(0x11, signaled_token);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, respond());
+    TEST_ASSERT_TRUE(slot_is_free(1));
+    TEST_ASSERT_FALSE(slot_is_free(0));
+
+    /* The deferred message is responded to once resumed */
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS, transport_resume_message(multi_slot_id, 0x10));
+    TEST_ASSERT_EQUAL(0x10, current_token());
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, respond());
+    TEST_ASSERT_TRUE(slot_is_free(0));
+    TEST_ASSERT_FALSE(transport_ctx.channel_ctx_table[0].locked);
+}
+
+/*
+ * Test that resuming a deferred message preempts the message being processed,
+ * which is restored once the resumed message has been responded to
+ */
+void test_multi_slot_resume_preempts(void)
+{
+    post_message(0, 0x20);
+    post_message(1, 0x21);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, transport_signal_message(multi_slot_id));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, transport_defer_message(multi_slot_id));
+    TEST_ASSERT_EQUAL(0x21, current_token());
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS, transport_resume_message(multi_slot_id, 0x20));
+    TEST_ASSERT_EQUAL(0x20, current_token());
+
+    /* Only one message can be resumed at a time */
+    TEST_ASSERT_EQUAL(
+        FWK_E_BUSY, transport_resume_message(multi_slot_id, 0x20));
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, respond());
+    TEST_ASSERT_TRUE(slot_is_free(0));
+    TEST_ASSERT_FALSE(slot_is_free(1));
+    TEST_ASSERT_EQUAL(0x21, current_token());
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, respond());
+    TEST_ASSERT_TRUE(slot_is_free(1));
+    TEST_ASSERT_FALSE(transport_ctx.channel_ctx_table[0].locked);
+}
+
+/*
+ * Test that the slots are scanned round-robin, so that a message posted in a
+ * high slot is not starved by a requester refilling the low slots
+ */
+void test_multi_slot_round_robin(void)
+{
+    post_message(0, 0x30);
+    post_message(1, 0x31);
+    post_message(2, 0x32);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, transport_signal_message(multi_slot_id));
+    TEST_ASSERT_EQUAL(0x30, signaled_token);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, respond());
+    TEST_ASSERT_EQUAL(0x31, signaled_token);
+
+    /* The requester reuses the first slot straight away */
+    post_message(0, 0x33);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, respond());
+    TEST_ASSERT_EQUAL(0x32, signaled_token);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, respond());
+    TEST_ASSERT_EQUAL(0x33, signaled_token);
+    TEST_ASSERT_EQUAL(4, signal_count);
+}
+
+void test_multi_slot_errors(void)
+{
+    post_message(0, 0x40);
+
+    /* Nothing to defer before a message is delivered */
+    TEST_ASSERT_EQUAL(FWK_E_ACCESS, transport_defer_message(multi_slot_id));
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, transport_signal_message(multi_slot_id));
+    TEST_ASSERT_EQUAL(
+        FWK_E_PARAM, transport_resume_message(multi_slot_id, 0x41));
+
+    TEST_ASSERT_EQUAL(FWK_E_SUPPORT, transport_defer_message(single_slot_id));
+    TEST_ASSERT_EQUAL(
+        FWK_E_SUPPORT, transport_resume_message(single_slot_id, 0x40));
+}
+
+int transport_test_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_multi_slot_defer_delivers_next);
+    RUN_TEST(test_multi_slot_resume_preempts);
+    RUN_TEST(test_multi_slot_round_robin);
+    RUN_TEST(test_multi_slot_errors);
+    return UNITY_END();
+}
+
+int main(void)
+{
+    return transport_test_main();
+}
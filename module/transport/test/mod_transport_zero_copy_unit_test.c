@@ -0,0 +1,259 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_id.h>
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include UNIT_TEST_SRC
+
+#define MAILBOX_SIZE  128
+#define RESPONSE_SIZE (MAILBOX_SIZE - sizeof(struct mod_transport_buffer))
+
+enum fake_channel_idx {
+    FAKE_CHANNEL_IDX_ZERO_COPY,
+    FAKE_CHANNEL_IDX_COPY,
+    FAKE_CHANNEL_IDX_COUNT,
+};
+
+static uint64_t shared_memory[FAKE_CHANNEL_IDX_COUNT]
+                             [MAILBOX_SIZE / sizeof(uint64_t)];
+
+static struct mod_transport_channel_config channel_config[] = {
+    [FAKE_CHANNEL_IDX_ZERO_COPY] = {
+        .transport_type = MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_OUT_BAND,
+        .channel_type = MOD_TRANSPORT_CHANNEL_TYPE_COMPLETER,
+        .policies = MOD_TRANSPORT_POLICY_ZERO_COPY,
+        .out_band_mailbox_address =
+            (uintptr_t)shared_memory[FAKE_CHANNEL_IDX_ZERO_COPY],
+        .out_band_mailbox_size = MAILBOX_SIZE,
+    },
+    [FAKE_CHANNEL_IDX_COPY] = {
+        .transport_type = MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_OUT_BAND,
+        .channel_type = MOD_TRANSPORT_CHANNEL_TYPE_COMPLETER,
+        .out_band_mailbox_address =
+            (uintptr_t)shared_memory[FAKE_CHANNEL_IDX_COPY],
+        .out_band_mailbox_size = MAILBOX_SIZE,
+    },
+};
+
+static const fwk_id_t zero_copy_id =
+    FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_TRANSPORT, FAKE_CHANNEL_IDX_ZERO_COPY);
+static const fwk_id_t copy_id =
+    FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_TRANSPORT, FAKE_CHANNEL_IDX_COPY);
+
+static const uint32_t request[] = { 0x11, 0x22 };
+
+static int signal_message(fwk_id_t service_id)
+{
+    return FWK_SUCCESS;
+}
+
+static int signal_error(fwk_id_t service_id)
+{
+    TEST_FAIL();
+
+    return FWK_E_STATE;
+}
+
+static struct mod_transport_firmware_signal_api signal_api = {
+    .signal_error = signal_error,
+    .signal_message = signal_message,
+};
+
+static int trigger_event(fwk_id_t device_id)
+{
+    return FWK_SUCCESS;
+}
+
+static struct mod_transport_driver_api driver_api = {
+    .trigger_event = trigger_event,
+};
+
+static void *alloc_callback(size_t num, size_t size, int NumCalls)
+{
+    return calloc(num, size);
+}
+
+static unsigned int get_element_idx_callback(fwk_id_t id, int NumCalls)
+{
+    return id.element.element_idx;
+}
+
+static struct mod_transport_buffer *mailbox(enum fake_channel_idx channel_idx)
+{
+    return (struct mod_transport_buffer *)shared_memory[channel_idx];
+}
+
+/* Requester side: post the request and signal the completer */
+static void post_request(enum fake_channel_idx channel_idx)
+{
+    struct mod_transport_buffer *buffer = mailbox(channel_idx);
+
+    memcpy(buffer->payload, request, sizeof(request));
+    buffer->length = sizeof(buffer->message_header) + sizeof(request);
+    buffer->status &= ~MOD_TRANSPORT_MAILBOX_STATUS_FREE_MASK;
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        transport_signal_message(
+            FWK_ID_ELEMENT(FWK_MODULE_IDX_TRANSPORT, channel_idx)));
+}
+
+static void assert_request(fwk_id_t channel_id)
+{
+    const void *payload;
+    size_t size;
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS, transport_get_payload(channel_id, &payload, &size));
+    TEST_ASSERT_EQUAL(sizeof(request), size);
+    TEST_ASSERT_EQUAL_HEX32_ARRAY(request, payload, FWK_ARRAY_SIZE(request));
+}
+
+void setUp(void)
+{
+    struct transport_channel_ctx *channel_ctx;
+    unsigned int channel_idx;
+
+    memset(shared_memory, 0, sizeof(shared_memory));
+
+    fwk_mm_calloc_StubWithCallback(alloc_callback);
+    fwk_mm_alloc_StubWithCallback(alloc_callback);
+    fwk_id_get_element_idx_StubWithCallback(get_element_idx_callback);
+
+    transport_init(fwk_module_id_transport, FAKE_CHANNEL_IDX_COUNT, NULL);
+
+    for (channel_idx = 0; channel_idx < FAKE_CHANNEL_IDX_COUNT;
+         channel_idx++) {
+        TEST_ASSERT_EQUAL(
+            FWK_SUCCESS,
+            transport_channel_init(
+                FWK_ID_ELEMENT(FWK_MODULE_IDX_TRANSPORT, channel_idx),
+                0,
+                &channel_config[channel_idx]));
+
+        channel_ctx = &transport_ctx.channel_ctx_table[channel_idx];
+        channel_ctx->service_id = FWK_ID_MODULE(FWK_MODULE_IDX_FAKE_SERVICE);
+        channel_ctx->transport_signal.firmware_signal_api = &signal_api;
+        channel_ctx->driver_api = &driver_api;
+        channel_ctx->out_band_mailbox_ready = true;
+
+        mailbox(channel_idx)->status = MOD_TRANSPORT_MAILBOX_STATUS_FREE_MASK;
+    }
+}
+
+void tearDown(void)
+{
+    fwk_mm_calloc_Stub(NULL);
+    fwk_mm_alloc_Stub(NULL);
+    fwk_id_get_element_idx_Stub(NULL);
+}
+
+/*
+ * Test that the service reads a snapshot of the request, which the requester
+ * cannot modify while the message is being processed
+ */
+void test_zero_copy_request_snapshot(void)
+{
+    post_request(FAKE_CHANNEL_IDX_ZERO_COPY);
+
+    mailbox(FAKE_CHANNEL_IDX_ZERO_COPY)->payload[0] = 0xdead;
+    mailbox(FAKE_CHANNEL_IDX_ZERO_COPY)->length = MAILBOX_SIZE * 2;
+
+    assert_request(zero_copy_id);
+}
+
+/*
+ * Test that the response is written in place and that the request can still be
+ * read after the response payload has been written
+ */
+void test_zero_copy_write_in_place(void)
+{
+    struct mod_transport_buffer *buffer = mailbox(FAKE_CHANNEL_IDX_ZERO_COPY);
+    uint8_t response[RESPONSE_SIZE];
+
+    memset(response, 0xa5, sizeof(response));
+
+    post_request(FAKE_CHANNEL_IDX_ZERO_COPY);
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        transport_write_payload(zero_copy_id, 0, response, sizeof(response)));
+    TEST_ASSERT_EQUAL_MEMORY(response, buffer->payload, sizeof(response));
+
+    assert_request(zero_copy_id);
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS, transport_respond(zero_copy_id, NULL, sizeof(response)));
+    TEST_ASSERT_EQUAL_MEMORY(response, buffer->payload, sizeof(response));
+    TEST_ASSERT_EQUAL(
+        sizeof(buffer->message_header) + sizeof(response), buffer->length);
+    TEST_ASSERT_TRUE(buffer->status & MOD_TRANSPORT_MAILBOX_STATUS_FREE_MASK);
+}
+
+/* Test that a response given to respond() is copied to the mailbox */
+void test_zero_copy_respond_payload(void)
+{
+    struct mod_transport_buffer *buffer = mailbox(FAKE_CHANNEL_IDX_ZERO_COPY);
+    const uint32_t response[] = { 0x33, 0x44, 0x55 };
+
+    post_request(FAKE_CHANNEL_IDX_ZERO_COPY);
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        transport_respond(zero_copy_id, response, sizeof(response)));
+    TEST_ASSERT_EQUAL_HEX32_ARRAY(
+        response, buffer->payload, FWK_ARRAY_SIZE(response));
+    TEST_ASSERT_EQUAL(
+        sizeof(buffer->message_header) + sizeof(response), buffer->length);
+}
+
+/*
+ * Test that a channel without the zero-copy policy only updates the mailbox
+ * when responding
+ */
+void test_copy_write_buffered(void)
+{
+    struct mod_transport_buffer *buffer = mailbox(FAKE_CHANNEL_IDX_COPY);
+    uint8_t response[RESPONSE_SIZE];
+
+    memset(response, 0xa5, sizeof(response));
+
+    post_request(FAKE_CHANNEL_IDX_COPY);
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        transport_write_payload(copy_id, 0, response, sizeof(response)));
+    TEST_ASSERT_EQUAL_HEX32_ARRAY(
+        request, buffer->payload, FWK_ARRAY_SIZE(request));
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS, transport_respond(copy_id, NULL, sizeof(response)));
+    TEST_ASSERT_EQUAL_MEMORY(response, buffer->payload, sizeof(response));
+}
+
+int transport_test_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_zero_copy_request_snapshot);
+    RUN_TEST(test_zero_copy_write_in_place);
+    RUN_TEST(test_zero_copy_respond_payload);
+    RUN_TEST(test_copy_write_buffered);
+    return UNITY_END();
+}
+
+int main(void)
+{
+    return transport_test_main();
+}
@@ -1,9 +1,10 @@
 #
 # Arm SCP/MCP Software
-# Copyright (c) 2015-2021, Arm Limited and Contributors. All rights reserved.
+# Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
 
 BS_PRODUCT_NAME := Host
-BS_FIRMWARE_LIST := fw
+BS_FIRMWARE_LIST := fw \
+                    scmi_fw
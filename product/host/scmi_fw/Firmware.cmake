@@ -0,0 +1,22 @@
+#
+# Arm SCP/MCP Software
+# Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+set(SCP_FIRMWARE "host-scmi")
+set(SCP_FIRMWARE_TARGET "host-scmi")
+
+set(SCP_ARCHITECTURE "none")
+
+set(SCP_ENABLE_NOTIFICATIONS_INIT TRUE)
+
+set(SCP_ENABLE_OUTBAND_MSG_SUPPORT_INIT TRUE)
+
+# The host mailbox maps the shared memory before the transport module
+# initializes the mailboxes.
+list(APPEND SCP_MODULES "stdio")
+list(APPEND SCP_MODULES "host-mbx")
+list(APPEND SCP_MODULES "transport")
+list(APPEND SCP_MODULES "scmi")
@@ -0,0 +1,36 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "host_scmi.h"
+
+#include <mod_host_mbx.h>
+
+#include <fwk_element.h>
+#include <fwk_module.h>
+
+#include <stdint.h>
+
+static const struct fwk_element host_mbx_element_table[] = {
+    [HOST_SCMI_SERVICE_IDX_OSPM_A2P] = {
+        .name = "OSPM-A2P",
+        .data = &(struct mod_host_mbx_channel_config) {
+            .shm_name = HOST_SCMI_OSPM_A2P_SHM_NAME,
+            .shm_address = (uintptr_t)HOST_SCMI_OSPM_A2P_SHM_ADDRESS,
+            .shm_size = HOST_SCMI_PAYLOAD_SIZE,
+            .peer_socket_path = HOST_SCMI_OSPM_A2P_SOCKET,
+        },
+    },
+    [HOST_SCMI_SERVICE_IDX_COUNT] = { 0 },
+};
+
+const struct fwk_module_config config_host_mbx = {
+    .data = &(struct mod_host_mbx_config) {
+        .socket_path = HOST_SCMI_FIRMWARE_SOCKET,
+        .poll_timeout_ms = -1,
+    },
+    .elements = FWK_MODULE_STATIC_ELEMENTS_PTR(host_mbx_element_table),
+};
@@ -0,0 +1,53 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "host_scmi.h"
+
+#include <mod_scmi.h>
+#include <mod_transport.h>
+
+#include <fwk_element.h>
+#include <fwk_id.h>
+#include <fwk_macros.h>
+#include <fwk_module.h>
+#include <fwk_module_idx.h>
+
+static const struct fwk_element scmi_element_table[] = {
+    [HOST_SCMI_SERVICE_IDX_OSPM_A2P] = {
+        .name = "OSPM-A2P",
+        .data = &(struct mod_scmi_service_config) {
+            .transport_id = FWK_ID_ELEMENT_INIT(
+                FWK_MODULE_IDX_TRANSPORT,
+                HOST_SCMI_SERVICE_IDX_OSPM_A2P),
+            .transport_api_id = FWK_ID_API_INIT(
+                FWK_MODULE_IDX_TRANSPORT,
+                MOD_TRANSPORT_API_IDX_SCMI_TO_TRANSPORT),
+            .transport_notification_init_id = FWK_ID_NONE_INIT,
+            .scmi_agent_id = (unsigned int)HOST_SCMI_AGENT_IDX_OSPM,
+            .scmi_p2a_id = FWK_ID_NONE_INIT,
+        },
+    },
+    [HOST_SCMI_SERVICE_IDX_COUNT] = { 0 },
+};
+
+static const struct mod_scmi_agent agent_table[] = {
+    [HOST_SCMI_AGENT_IDX_OSPM] = {
+        .type = SCMI_AGENT_TYPE_OSPM,
+        .name = "OSPM",
+    },
+};
+
+const struct fwk_module_config config_scmi = {
+    .data = &(struct mod_scmi_config) {
+        .protocol_count_max = 1,
+        .agent_count = FWK_ARRAY_SIZE(agent_table) - 1,
+        .agent_table = agent_table,
+        .vendor_identifier = "arm",
+        .sub_vendor_identifier = "arm",
+    },
+    .elements = FWK_MODULE_STATIC_ELEMENTS_PTR(scmi_element_table),
+};
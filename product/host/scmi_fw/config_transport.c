@@ -0,0 +1,43 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "host_scmi.h"
+
+#include <mod_host_mbx.h>
+#include <mod_transport.h>
+
+#include <fwk_element.h>
+#include <fwk_id.h>
+#include <fwk_module.h>
+#include <fwk_module_idx.h>
+
+#include <stdint.h>
+
+static const struct fwk_element transport_element_table[] = {
+    [HOST_SCMI_SERVICE_IDX_OSPM_A2P] = {
+        .name = "OSPM-A2P",
+        .data = &(struct mod_transport_channel_config) {
+            .channel_type = MOD_TRANSPORT_CHANNEL_TYPE_COMPLETER,
+            .transport_type = MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_OUT_BAND,
+            .policies = MOD_TRANSPORT_POLICY_INIT_MAILBOX,
+            .out_band_mailbox_address =
+                (uintptr_t)HOST_SCMI_OSPM_A2P_SHM_ADDRESS,
+            .out_band_mailbox_size = HOST_SCMI_PAYLOAD_SIZE,
+            .driver_id = FWK_ID_ELEMENT_INIT(
+                FWK_MODULE_IDX_HOST_MBX,
+                HOST_SCMI_SERVICE_IDX_OSPM_A2P),
+            .driver_api_id = FWK_ID_API_INIT(
+                FWK_MODULE_IDX_HOST_MBX,
+                MOD_HOST_MBX_API_IDX_TRANSPORT_DRIVER),
+        },
+    },
+    [HOST_SCMI_SERVICE_IDX_COUNT] = { 0 },
+};
+
+const struct fwk_module_config config_transport = {
+    .elements = FWK_MODULE_STATIC_ELEMENTS_PTR(transport_element_table),
+};
@@ -0,0 +1,39 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *      Definitions shared by the SCMI host firmware configurations.
+ */
+
+#ifndef HOST_SCMI_H
+#define HOST_SCMI_H
+
+/* SCMI agents */
+enum host_scmi_agent_idx {
+    /* 0 is reserved for the platform */
+    HOST_SCMI_AGENT_IDX_OSPM = 1,
+    HOST_SCMI_AGENT_IDX_COUNT,
+};
+
+/* SCMI services, with one transport channel and one host mailbox each */
+enum host_scmi_service_idx {
+    HOST_SCMI_SERVICE_IDX_OSPM_A2P,
+    HOST_SCMI_SERVICE_IDX_COUNT,
+};
+
+/*
+ * Shared memory of the OSPM A2P mailbox, mapped far above the executable and
+ * below the shared libraries of the firmware process.
+ */
+#define HOST_SCMI_OSPM_A2P_SHM_NAME    "/scp-ospm"
+#define HOST_SCMI_OSPM_A2P_SHM_ADDRESS UINT64_C(0x7e0000000000)
+#define HOST_SCMI_PAYLOAD_SIZE         128
+
+/* Doorbell sockets */
+#define HOST_SCMI_FIRMWARE_SOCKET  "/tmp/scp.sock"
+#define HOST_SCMI_OSPM_A2P_SOCKET  "/tmp/scp-ospm.sock"
+
+#endif /* HOST_SCMI_H */
@@ -0,0 +1,494 @@
+#!/usr/bin/env python3
+#
+# Arm SCP/MCP Software
+# Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+"""
+    SCMI traffic generator and replay benchmark.
+
+    Acts as an SCMI agent against firmware built for the host architecture
+    with the host_mbx mailbox driver. It sends synthetic workloads or replays
+    a captured message trace, and reports the throughput, the latency
+    percentiles and the error rate of each protocol.
+
+    Generate a cpufreq-like storm on performance domains 0 to 3:
+
+        scmi_traffic.py --workload perf-storm --domains 0-3 --count 10000
+
+    Record the messages sent and replay them with their original timing:
+
+        scmi_traffic.py --workload sensor-poll --record trace.jsonl
+        scmi_traffic.py --replay trace.jsonl --timed
+
+    Gate a release on the 99th percentile latency:
+
+        scmi_traffic.py --workload clock-churn --max-p99-us 50
+"""
+
+import argparse
+import json
+import mmap
+import os
+import random
+import socket
+import struct
+import sys
+import time
+
+#
+# SCMI protocol identifiers
+#
+PROTOCOL_BASE = 0x10
+PROTOCOL_POWER_DOMAIN = 0x11
+PROTOCOL_PERF = 0x13
+PROTOCOL_CLOCK = 0x14
+PROTOCOL_SENSOR = 0x15
+
+PROTOCOL_NAMES = {
+    PROTOCOL_BASE: 'base',
+    PROTOCOL_POWER_DOMAIN: 'power_domain',
+    0x12: 'sys_power',
+    PROTOCOL_PERF: 'perf',
+    PROTOCOL_CLOCK: 'clock',
+    PROTOCOL_SENSOR: 'sensor',
+    0x16: 'reset_domain',
+    0x17: 'voltage_domain',
+    0x18: 'power_capping',
+}
+
+#
+# SCMI message identifiers used by the workloads
+#
+BASE_PROTOCOL_VERSION = 0x0
+POWER_DOMAIN_STATE_SET = 0x4
+PERF_LEVEL_SET = 0x7
+PERF_LEVEL_GET = 0x8
+CLOCK_CONFIG_SET = 0x7
+SENSOR_READING_GET = 0x6
+
+POWER_DOMAIN_STATE_ON = 0x0
+POWER_DOMAIN_STATE_OFF = 0x40000000
+
+#
+# Shared memory transport layout (struct mod_transport_buffer)
+#
+MAILBOX_STATUS_OFFSET = 4
+MAILBOX_FLAGS_OFFSET = 16
+MAILBOX_LENGTH_OFFSET = 20
+MAILBOX_HEADER_OFFSET = 24
+MAILBOX_PAYLOAD_OFFSET = 28
+MAILBOX_STATUS_FREE = 0x1
+MAILBOX_STATUS_ERROR = 0x2
+MAILBOX_FLAGS_IENABLED = 0x1
+
+PERCENTILES = [50, 99, 99.9]
+
+
+class TransportError(Exception):
+    pass
+
+
+class HostMailbox:
+    """
+    Agent side of a host_mbx channel: the shared memory mailbox and the
+    doorbell sockets.
+    """
+
+    def __init__(self, shm_name, shm_size, firmware_socket, agent_socket,
+                 channel, timeout):
+        fd = os.open(os.path.join('/dev/shm', shm_name.lstrip('/')),
+                     os.O_RDWR)
+        try:
+            self.mailbox = mmap.mmap(fd, shm_size)
+        finally:
+            os.close(fd)
+
+        self.firmware_socket = firmware_socket
+        self.agent_socket = agent_socket
+        self.doorbell = struct.pack('<I', channel)
+        self.timeout = timeout
+
+        if os.path.exists(agent_socket):
+            os.unlink(agent_socket)
+        self.socket = socket.socket(socket.AF_UNIX, socket.SOCK_DGRAM)
+        self.socket.bind(agent_socket)
+
+    def close(self):
+        self.socket.close()
+        os.unlink(self.agent_socket)
+        self.mailbox.close()
+
+    def _read32(self, offset):
+        return struct.unpack_from('<I', self.mailbox, offset)[0]
+
+    def _write32(self, offset, value):
+        struct.pack_into('<I', self.mailbox, offset, value)
+
+    def _drain(self):
+        """
+        Discard the doorbells left over by the previous messages, for example
+        the late response to a message which timed out.
+        """
+        self.socket.setblocking(False)
+        try:
+            while True:
+                self.socket.recv(len(self.doorbell))
+        except BlockingIOError:
+            pass
+
+    def _wait_free(self, deadline):
+        """
+        Wait until the firmware hands the mailbox back to the agent. A doorbell
+        alone does not mean the mailbox is free, it may be a stale one.
+        """
+        while not self._read32(MAILBOX_STATUS_OFFSET) & MAILBOX_STATUS_FREE:
+            remaining = deadline - time.monotonic()
+            if remaining <= 0:
+                return False
+            self.socket.settimeout(remaining)
+            try:
+                self.socket.recv(len(self.doorbell))
+            except socket.timeout:
+                return False
+        return True
+
+    def call(self, header, payload):
+        """
+        Send a command and wait for its response. Return the response header
+        and payload.
+        """
+        deadline = time.monotonic() + self.timeout
+
+        if not self._wait_free(deadline):
+            raise TransportError('channel busy')
+        self._drain()
+
+        self._write32(MAILBOX_FLAGS_OFFSET, MAILBOX_FLAGS_IENABLED)
+        self._write32(MAILBOX_LENGTH_OFFSET, 4 + len(payload))
+        self._write32(MAILBOX_HEADER_OFFSET, header)
+        end = MAILBOX_PAYLOAD_OFFSET + len(payload)
+        self.mailbox[MAILBOX_PAYLOAD_OFFSET:end] = payload
+        self._write32(MAILBOX_STATUS_OFFSET, 0)
+
+        self.socket.sendto(self.doorbell, self.firmware_socket)
+        if not self._wait_free(deadline):
+            raise TransportError('response timeout')
+
+        status = self._read32(MAILBOX_STATUS_OFFSET)
+        if status & MAILBOX_STATUS_ERROR:
+            raise TransportError('channel error')
+
+        length = self._read32(MAILBOX_LENGTH_OFFSET)
+        end = MAILBOX_HEADER_OFFSET + length
+        return (self._read32(MAILBOX_HEADER_OFFSET),
+                bytes(self.mailbox[MAILBOX_PAYLOAD_OFFSET:end]))
+
+
+def message_header(protocol, message, token):
+    return (message & 0xff) | ((protocol & 0xff) << 10) | \
+        ((token & 0x3ff) << 18)
+
+
+def parse_range(text):
+    """ Parse '0-3,7' as [0, 1, 2, 3, 7]. """
+    values = []
+    for part in text.split(','):
+        if '-' in part:
+            first, last = part.split('-')
+            values.extend(range(int(first, 0), int(last, 0) + 1))
+        else:
+            values.append(int(part, 0))
+    return values
+
+
+#
+# Workloads. Each one yields (protocol, message, payload words) forever.
+#
+def workload_base(args, rng):
+    while True:
+        yield PROTOCOL_BASE, BASE_PROTOCOL_VERSION, []
+
+
+def workload_perf_storm(args, rng):
+    """
+    Level requests from every CPU policy, as cpufreq governors issue them on
+    load changes, with the occasional read back.
+    """
+    levels = parse_range(args.levels)
+    while True:
+        domain = rng.choice(args.domains)
+        if rng.random() < 0.1:
+            yield PROTOCOL_PERF, PERF_LEVEL_GET, [domain]
+        else:
+            yield PROTOCOL_PERF, PERF_LEVEL_SET, [domain, rng.choice(levels)]
+
+
+def workload_sensor_poll(args, rng):
+    """ Round-robin synchronous readings of all the sensors. """
+    while True:
+        for sensor in args.domains:
+            yield PROTOCOL_SENSOR, SENSOR_READING_GET, [sensor, 0]
+
+
+def workload_clock_churn(args, rng):
+    """ Clocks enabled and disabled in random order, as runtime PM does. """
+    enabled = set()
+    while True:
+        clock = rng.choice(args.domains)
+        attributes = 0 if clock in enabled else 1
+        enabled ^= {clock}
+        yield PROTOCOL_CLOCK, CLOCK_CONFIG_SET, [clock, attributes]
+
+
+def workload_pd_hotplug(args, rng):
+    """
+    Power domains taken off then brought back on line one after another, as
+    CPU hotplug does.
+    """
+    while True:
+        for domain in args.domains:
+            yield PROTOCOL_POWER_DOMAIN, POWER_DOMAIN_STATE_SET, \
+                [0, domain, POWER_DOMAIN_STATE_OFF]
+        for domain in args.domains:
+            yield PROTOCOL_POWER_DOMAIN, POWER_DOMAIN_STATE_SET, \
+                [0, domain, POWER_DOMAIN_STATE_ON]
+
+
+WORKLOADS = {
+    'base': workload_base,
+    'perf-storm': workload_perf_storm,
+    'sensor-poll': workload_sensor_poll,
+    'clock-churn': workload_clock_churn,
+    'pd-hotplug': workload_pd_hotplug,
+}
+
+
+def workload_messages(args):
+    rng = random.Random(args.seed)
+    messages = WORKLOADS[args.workload](args, rng)
+    for _ in range(args.count):
+        protocol, message, payload = next(messages)
+        yield 0, protocol, message, payload
+
+
+def replay_messages(path):
+    """
+    Read a trace: one JSON object per line with the offset in microseconds
+    from the start of the trace, the protocol and message identifiers and the
+    payload as a list of 32-bit words.
+    """
+    with open(path) as trace:
+        for line in trace:
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+            entry = json.loads(line)
+            yield (int(entry.get('t_us', 0)), int(entry['protocol']),
+                   int(entry['message']), entry.get('payload', []))
+
+
+class ProtocolStats:
+    def __init__(self):
+        self.latencies = []
+        self.transport_errors = 0
+        self.scmi_errors = 0
+        # Time spent waiting for the messages of the protocol, in seconds
+        self.active_time = 0.0
+
+    @property
+    def count(self):
+        return len(self.latencies) + self.transport_errors
+
+    def percentile(self, percentile):
+        if not self.latencies:
+            return 0.0
+        latencies = sorted(self.latencies)
+        index = int(round(percentile / 100.0 * (len(latencies) - 1)))
+        return latencies[index]
+
+    def report(self):
+        """
+        The throughput is computed over the time the protocol kept the channel
+        busy, so that the protocols of a mixed trace do not share the time
+        spent on each other.
+        """
+        errors = self.transport_errors + self.scmi_errors
+        report = {
+            'count': self.count,
+            'throughput':
+                self.count / self.active_time if self.active_time else 0.0,
+            'error_rate': errors / self.count if self.count else 0.0,
+            'transport_errors': self.transport_errors,
+            'scmi_errors': self.scmi_errors,
+        }
+        for percentile in PERCENTILES:
+            key = 'p{}_us'.format(str(percentile).replace('.', ''))
+            report[key] = self.percentile(percentile)
+        return report
+
+
+def run(args, channel, messages, record):
+    stats = {}
+    token = 0
+    start = time.perf_counter()
+
+    for offset_us, protocol, message, payload in messages:
+        if args.timed:
+            delay = start + offset_us / 1e6 - time.perf_counter()
+            if delay > 0:
+                time.sleep(delay)
+
+        if record:
+            record.write(json.dumps({
+                't_us': int((time.perf_counter() - start) * 1e6),
+                'protocol': protocol,
+                'message': message,
+                'payload': payload,
+            }) + '\n')
+
+        protocol_stats = stats.setdefault(protocol, ProtocolStats())
+        header = message_header(protocol, message, token)
+        token = (token + 1) & 0x3ff
+
+        sent = time.perf_counter()
+        try:
+            response_header, response = channel.call(
+                header, struct.pack('<{}I'.format(len(payload)), *payload))
+            if response_header != header:
+                raise TransportError(
+                    'unexpected response 0x{:08x}'.format(response_header))
+        except TransportError as error:
+            protocol_stats.active_time += time.perf_counter() - sent
+            protocol_stats.transport_errors += 1
+            if args.verbose:
+                print('0x{:08x}: {}'.format(header, error), file=sys.stderr)
+            continue
+
+        latency = time.perf_counter() - sent
+        protocol_stats.active_time += latency
+        protocol_stats.latencies.append(latency * 1e6)
+        if len(response) < 4 or struct.unpack_from('<i', response)[0] != 0:
+            protocol_stats.scmi_errors += 1
+
+    return stats, time.perf_counter() - start
+
+
+def print_report(report):
+    columns = ['count', 'throughput', 'error_rate', 'p50_us', 'p99_us',
+               'p999_us']
+    print('{:<16}'.format('protocol') +
+          ''.join('{:>12}'.format(column) for column in columns))
+    for name, protocol_report in report['protocols'].items():
+        print('{:<16}'.format(name) +
+              '{:>12}'.format(protocol_report['count']) +
+              ''.join('{:>12.2f}'.format(protocol_report[column])
+                      for column in columns[1:]))
+    print('duration {:.3f}s'.format(report['duration']))
+
+
+def check_limits(args, report):
+    success = True
+    for name, protocol_report in report['protocols'].items():
+        if args.max_p99_us is not None and \
+                protocol_report['p99_us'] > args.max_p99_us:
+            print('{}: p99 {:.2f}us over {}us'.format(
+                name, protocol_report['p99_us'], args.max_p99_us))
+            success = False
+        if args.max_error_rate is not None and \
+                protocol_report['error_rate'] > args.max_error_rate:
+            print('{}: error rate {:.4f} over {}'.format(
+                name, protocol_report['error_rate'], args.max_error_rate))
+            success = False
+    return success
+
+
+def parse_args(argv):
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+
+    source = parser.add_mutually_exclusive_group()
+    source.add_argument('--workload', choices=sorted(WORKLOADS),
+                        default='base', help='Synthetic workload to send')
+    source.add_argument('--replay', metavar='TRACE',
+                        help='Trace of messages to replay')
+
+    parser.add_argument('--count', type=int, default=1000,
+                        help='Number of messages of the workload')
+    parser.add_argument('--domains', type=parse_range, default='0',
+                        help='Domains, clocks or sensors to target, '
+                             'e.g. 0-3,7')
+    parser.add_argument('--levels', default='0-4',
+                        help='Performance levels of the perf-storm workload')
+    parser.add_argument('--seed', type=int, default=0,
+                        help='Seed of the workload random generator')
+    parser.add_argument('--timed', action='store_true',
+                        help='Replay the trace with its original timing')
+    parser.add_argument('--record', metavar='TRACE',
+                        help='Record the messages sent into a trace')
+
+    parser.add_argument('--shm', default='/scp-ospm',
+                        help='Shared memory object of the channel')
+    parser.add_argument('--shm-size', type=int, default=128,
+                        help='Size of the shared memory object')
+    parser.add_argument('--firmware-socket', default='/tmp/scp.sock',
+                        help='Doorbell socket of the firmware')
+    parser.add_argument('--agent-socket', default='/tmp/scp-ospm.sock',
+                        help='Doorbell socket of the agent')
+    parser.add_argument('--channel', type=int, default=0,
+                        help='Index of the channel in the firmware')
+    parser.add_argument('--timeout', type=float, default=1.0,
+                        help='Response timeout in seconds')
+
+    parser.add_argument('--json', metavar='REPORT',
+                        help='Write the report as JSON')
+    parser.add_argument('--max-p99-us', type=float,
+                        help='Fail if the p99 latency of a protocol is over')
+    parser.add_argument('--max-error-rate', type=float,
+                        help='Fail if the error rate of a protocol is over')
+    parser.add_argument('--verbose', action='store_true',
+                        help='Print the failed messages')
+
+    return parser.parse_args(argv)
+
+
+def main(argv=sys.argv[1:]):
+    args = parse_args(argv)
+
+    if args.replay:
+        messages = replay_messages(args.replay)
+    else:
+        messages = workload_messages(args)
+
+    channel = HostMailbox(args.shm, args.shm_size, args.firmware_socket,
+                          args.agent_socket, args.channel, args.timeout)
+    record = open(args.record, 'w') if args.record else None
+    try:
+        stats, duration = run(args, channel, messages, record)
+    finally:
+        channel.close()
+        if record:
+            record.close()
+
+    report = {
+        'duration': duration,
+        'protocols': {
+            PROTOCOL_NAMES.get(protocol, hex(protocol)):
+                protocol_stats.report()
+            for protocol, protocol_stats in sorted(stats.items())
+        },
+    }
+
+    print_report(report)
+    if args.json:
+        with open(args.json, 'w') as output:
+            json.dump(report, output, indent=4)
+
+    return 0 if check_limits(args, report) else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -16,6 +16,7 @@ static const char* CMockString_fwk_time_duration_m = "fwk_time_duration_m";
 static const char* CMockString_fwk_time_duration_ms = "fwk_time_duration_ms";
 static const char* CMockString_fwk_time_duration_s = "fwk_time_duration_s";
 static const char* CMockString_fwk_time_duration_us = "fwk_time_duration_us";
+static const char* CMockString_fwk_time_elapsed = "fwk_time_elapsed";
 static const char* CMockString_fwk_time_stamp_duration = "fwk_time_stamp_duration";
 static const char* CMockString_start = "start";
 static const char* CMockString_timestamp = "timestamp";
@@ -50,6 +51,18 @@ typedef struct _CMOCK_fwk_time_duration_CALL_INSTANCE
 
 } CMOCK_fwk_time_duration_CALL_INSTANCE;
 
+typedef struct _CMOCK_fwk_time_elapsed_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  char ExpectAnyArgsBool;
+  fwk_duration_ns_t ReturnVal;
+  fwk_timestamp_t Expected_start;
+  fwk_timestamp_t Expected_end;
+  char IgnoreArg_start;
+  char IgnoreArg_end;
+
+} CMOCK_fwk_time_elapsed_CALL_INSTANCE;
+
 typedef struct _CMOCK_fwk_time_duration_us_CALL_INSTANCE
 {
   UNITY_LINE_TYPE LineNumber;
@@ -134,6 +147,12 @@ static struct Mockfwk_timeInstance
   CMOCK_fwk_time_duration_CALLBACK fwk_time_duration_CallbackFunctionPointer;
   int fwk_time_duration_CallbackCalls;
   CMOCK_MEM_INDEX_TYPE fwk_time_duration_CallInstance;
+  char fwk_time_elapsed_IgnoreBool;
+  fwk_duration_ns_t fwk_time_elapsed_FinalReturn;
+  char fwk_time_elapsed_CallbackBool;
+  CMOCK_fwk_time_elapsed_CALLBACK fwk_time_elapsed_CallbackFunctionPointer;
+  int fwk_time_elapsed_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE fwk_time_elapsed_CallInstance;
   char fwk_time_duration_us_IgnoreBool;
   fwk_duration_us_t fwk_time_duration_us_FinalReturn;
   char fwk_time_duration_us_CallbackBool;
@@ -217,6 +236,19 @@ void Mockfwk_time_Verify(void)
     call_instance = CMOCK_GUTS_NONE;
     (void)call_instance;
   }
+  call_instance = Mock.fwk_time_elapsed_CallInstance;
+  if (Mock.fwk_time_elapsed_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_fwk_time_elapsed);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.fwk_time_elapsed_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
   call_instance = Mock.fwk_time_duration_us_CallInstance;
   if (Mock.fwk_time_duration_us_IgnoreBool)
     call_instance = CMOCK_GUTS_NONE;
@@ -645,6 +677,141 @@ void fwk_time_duration_CMockIgnoreArg_end(UNITY_LINE_TYPE cmock_line)
   cmock_call_instance->IgnoreArg_end = 1;
 }
 
+fwk_duration_ns_t fwk_time_elapsed(fwk_timestamp_t start, fwk_timestamp_t end)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_fwk_time_elapsed_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_fwk_time_elapsed);
+  cmock_call_instance = (CMOCK_fwk_time_elapsed_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.fwk_time_elapsed_CallInstance);
+  Mock.fwk_time_elapsed_CallInstance = CMock_Guts_MemNext(Mock.fwk_time_elapsed_CallInstance);
+  if (Mock.fwk_time_elapsed_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.fwk_time_elapsed_FinalReturn;
+    memcpy((void*)(&Mock.fwk_time_elapsed_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(fwk_duration_ns_t[sizeof(cmock_call_instance->ReturnVal) == sizeof(fwk_duration_ns_t) ? 1 : -1])); /* add fwk_duration_ns_t to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.fwk_time_elapsed_CallbackBool &&
+      Mock.fwk_time_elapsed_CallbackFunctionPointer != NULL)
+  {
+    fwk_duration_ns_t cmock_cb_ret = Mock.fwk_time_elapsed_CallbackFunctionPointer(start, end, Mock.fwk_time_elapsed_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (!cmock_call_instance->ExpectAnyArgsBool)
+  {
+  if (!cmock_call_instance->IgnoreArg_start)
+  {
+    UNITY_SET_DETAILS(CMockString_fwk_time_elapsed,CMockString_start);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_start), (void*)(&start), sizeof(fwk_timestamp_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_end)
+  {
+    UNITY_SET_DETAILS(CMockString_fwk_time_elapsed,CMockString_end);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_end), (void*)(&end), sizeof(fwk_timestamp_t), cmock_line, CMockStringMismatch);
+  }
+  }
+  if (Mock.fwk_time_elapsed_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.fwk_time_elapsed_CallbackFunctionPointer(start, end, Mock.fwk_time_elapsed_CallbackCalls++);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_fwk_time_elapsed(CMOCK_fwk_time_elapsed_CALL_INSTANCE* cmock_call_instance, fwk_timestamp_t start, fwk_timestamp_t end);
+void CMockExpectParameters_fwk_time_elapsed(CMOCK_fwk_time_elapsed_CALL_INSTANCE* cmock_call_instance, fwk_timestamp_t start, fwk_timestamp_t end)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_start), (void*)(&start),
+         sizeof(fwk_timestamp_t[sizeof(start) == sizeof(fwk_timestamp_t) ? 1 : -1])); /* add fwk_timestamp_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_start = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_end), (void*)(&end),
+         sizeof(fwk_timestamp_t[sizeof(end) == sizeof(fwk_timestamp_t) ? 1 : -1])); /* add fwk_timestamp_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_end = 0;
+}
+
+void fwk_time_elapsed_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, fwk_duration_ns_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_fwk_time_elapsed_CALL_INSTANCE));
+  CMOCK_fwk_time_elapsed_CALL_INSTANCE* cmock_call_instance = (CMOCK_fwk_time_elapsed_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.fwk_time_elapsed_CallInstance = CMock_Guts_MemChain(Mock.fwk_time_elapsed_CallInstance, cmock_guts_index);
+  Mock.fwk_time_elapsed_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.fwk_time_elapsed_IgnoreBool = (char)1;
+}
+
+void fwk_time_elapsed_CMockStopIgnore(void)
+{
+  if(Mock.fwk_time_elapsed_IgnoreBool)
+    Mock.fwk_time_elapsed_CallInstance = CMock_Guts_MemNext(Mock.fwk_time_elapsed_CallInstance);
+  Mock.fwk_time_elapsed_IgnoreBool = (char)0;
+}
+
+void fwk_time_elapsed_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, fwk_duration_ns_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_fwk_time_elapsed_CALL_INSTANCE));
+  CMOCK_fwk_time_elapsed_CALL_INSTANCE* cmock_call_instance = (CMOCK_fwk_time_elapsed_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.fwk_time_elapsed_CallInstance = CMock_Guts_MemChain(Mock.fwk_time_elapsed_CallInstance, cmock_guts_index);
+  Mock.fwk_time_elapsed_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  cmock_call_instance->ExpectAnyArgsBool = (char)1;
+}
+
+void fwk_time_elapsed_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, fwk_timestamp_t start, fwk_timestamp_t end, fwk_duration_ns_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_fwk_time_elapsed_CALL_INSTANCE));
+  CMOCK_fwk_time_elapsed_CALL_INSTANCE* cmock_call_instance = (CMOCK_fwk_time_elapsed_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.fwk_time_elapsed_CallInstance = CMock_Guts_MemChain(Mock.fwk_time_elapsed_CallInstance, cmock_guts_index);
+  Mock.fwk_time_elapsed_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  CMockExpectParameters_fwk_time_elapsed(cmock_call_instance, start, end);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(fwk_duration_ns_t[sizeof(cmock_to_return) == sizeof(fwk_duration_ns_t) ? 1 : -1])); /* add fwk_duration_ns_t to :treat_as_array if this causes an error */
+}
+
+void fwk_time_elapsed_AddCallback(CMOCK_fwk_time_elapsed_CALLBACK Callback)
+{
+  Mock.fwk_time_elapsed_IgnoreBool = (char)0;
+  Mock.fwk_time_elapsed_CallbackBool = (char)1;
+  Mock.fwk_time_elapsed_CallbackFunctionPointer = Callback;
+}
+
+void fwk_time_elapsed_Stub(CMOCK_fwk_time_elapsed_CALLBACK Callback)
+{
+  Mock.fwk_time_elapsed_IgnoreBool = (char)0;
+  Mock.fwk_time_elapsed_CallbackBool = (char)0;
+  Mock.fwk_time_elapsed_CallbackFunctionPointer = Callback;
+}
+
+void fwk_time_elapsed_CMockIgnoreArg_start(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_fwk_time_elapsed_CALL_INSTANCE* cmock_call_instance = (CMOCK_fwk_time_elapsed_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.fwk_time_elapsed_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_start = 1;
+}
+
+void fwk_time_elapsed_CMockIgnoreArg_end(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_fwk_time_elapsed_CALL_INSTANCE* cmock_call_instance = (CMOCK_fwk_time_elapsed_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.fwk_time_elapsed_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_end = 1;
+}
+
 fwk_duration_us_t fwk_time_duration_us(fwk_duration_ns_t duration)
 {
   UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
@@ -64,6 +64,22 @@ void fwk_time_duration_Stub(CMOCK_fwk_time_duration_CALLBACK Callback);
 void fwk_time_duration_CMockIgnoreArg_start(UNITY_LINE_TYPE cmock_line);
 #define fwk_time_duration_IgnoreArg_end() fwk_time_duration_CMockIgnoreArg_end(__LINE__)
 void fwk_time_duration_CMockIgnoreArg_end(UNITY_LINE_TYPE cmock_line);
+#define fwk_time_elapsed_IgnoreAndReturn(cmock_retval) fwk_time_elapsed_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void fwk_time_elapsed_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, fwk_duration_ns_t cmock_to_return);
+#define fwk_time_elapsed_StopIgnore() fwk_time_elapsed_CMockStopIgnore()
+void fwk_time_elapsed_CMockStopIgnore(void);
+#define fwk_time_elapsed_ExpectAnyArgsAndReturn(cmock_retval) fwk_time_elapsed_CMockExpectAnyArgsAndReturn(__LINE__, cmock_retval)
+void fwk_time_elapsed_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, fwk_duration_ns_t cmock_to_return);
+#define fwk_time_elapsed_ExpectAndReturn(start, end, cmock_retval) fwk_time_elapsed_CMockExpectAndReturn(__LINE__, start, end, cmock_retval)
+void fwk_time_elapsed_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, fwk_timestamp_t start, fwk_timestamp_t end, fwk_duration_ns_t cmock_to_return);
+typedef fwk_duration_ns_t (* CMOCK_fwk_time_elapsed_CALLBACK)(fwk_timestamp_t start, fwk_timestamp_t end, int cmock_num_calls);
+void fwk_time_elapsed_AddCallback(CMOCK_fwk_time_elapsed_CALLBACK Callback);
+void fwk_time_elapsed_Stub(CMOCK_fwk_time_elapsed_CALLBACK Callback);
+#define fwk_time_elapsed_StubWithCallback fwk_time_elapsed_Stub
+#define fwk_time_elapsed_IgnoreArg_start() fwk_time_elapsed_CMockIgnoreArg_start(__LINE__)
+void fwk_time_elapsed_CMockIgnoreArg_start(UNITY_LINE_TYPE cmock_line);
+#define fwk_time_elapsed_IgnoreArg_end() fwk_time_elapsed_CMockIgnoreArg_end(__LINE__)
+void fwk_time_elapsed_CMockIgnoreArg_end(UNITY_LINE_TYPE cmock_line);
 #define fwk_time_duration_us_IgnoreAndReturn(cmock_retval) fwk_time_duration_us_CMockIgnoreAndReturn(__LINE__, cmock_retval)
 void fwk_time_duration_us_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, fwk_duration_us_t cmock_to_return);
 #define fwk_time_duration_us_StopIgnore() fwk_time_duration_us_CMockStopIgnore()